@@ -1,6 +1,9 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+
+#include "Dictionary.h"
 
 namespace faker
 {
@@ -18,6 +21,29 @@ public:
      */
     static std::string title();
 
+    /**
+     * @brief Returns a random book title as a view of static storage.
+     *
+     * @returns Book title.
+     *
+     * @code
+     * Book::titleView() // "Romeo and Juliet"
+     * @endcode
+     */
+    static std::string_view titleView();
+
+    /**
+     * @brief Returns the dataset `title()` picks its values from.
+     *
+     * @returns Dictionary of all values `title()` can return.
+     *
+     * @code
+     * const auto dictionary = Book::titleDictionary();
+     * dictionary[dictionary.randomIndex()] // "Romeo and Juliet"
+     * @endcode
+     */
+    static Dictionary titleDictionary();
+
     /**
      * @brief Returns a random book genre.
      *
@@ -29,6 +55,29 @@ public:
      */
     static std::string genre();
 
+    /**
+     * @brief Returns a random book genre as a view of static storage.
+     *
+     * @returns Book genre.
+     *
+     * @code
+     * Book::genreView() // "Fantasy"
+     * @endcode
+     */
+    static std::string_view genreView();
+
+    /**
+     * @brief Returns the dataset `genre()` picks its values from.
+     *
+     * @returns Dictionary of all values `genre()` can return.
+     *
+     * @code
+     * const auto dictionary = Book::genreDictionary();
+     * dictionary[dictionary.randomIndex()] // "Fantasy"
+     * @endcode
+     */
+    static Dictionary genreDictionary();
+
     /**
      * @brief Returns a random book author.
      *
@@ -40,6 +89,29 @@ public:
      */
     static std::string author();
 
+    /**
+     * @brief Returns a random book author as a view of static storage.
+     *
+     * @returns Book author.
+     *
+     * @code
+     * Book::authorView() // "Shakespeare, William"
+     * @endcode
+     */
+    static std::string_view authorView();
+
+    /**
+     * @brief Returns the dataset `author()` picks its values from.
+     *
+     * @returns Dictionary of all values `author()` can return.
+     *
+     * @code
+     * const auto dictionary = Book::authorDictionary();
+     * dictionary[dictionary.randomIndex()] // "Shakespeare, William"
+     * @endcode
+     */
+    static Dictionary authorDictionary();
+
     /**
      * @brief Returns a random book publisher.
      *
@@ -51,6 +123,29 @@ public:
      */
     static std::string publisher();
 
+    /**
+     * @brief Returns a random book publisher as a view of static storage.
+     *
+     * @returns Book publisher.
+     *
+     * @code
+     * Book::publisherView() // "Addison-Wesley"
+     * @endcode
+     */
+    static std::string_view publisherView();
+
+    /**
+     * @brief Returns the dataset `publisher()` picks its values from.
+     *
+     * @returns Dictionary of all values `publisher()` can return.
+     *
+     * @code
+     * const auto dictionary = Book::publisherDictionary();
+     * dictionary[dictionary.randomIndex()] // "Addison-Wesley"
+     * @endcode
+     */
+    static Dictionary publisherDictionary();
+
     /**
      * @brief Returns a random book ISBN.
      *
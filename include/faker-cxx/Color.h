@@ -1,7 +1,9 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
+#include "Dictionary.h"
 #include "types/Hex.h"
 
 namespace faker
@@ -20,6 +22,29 @@ public:
      */
     static std::string name();
 
+    /**
+     * @brief Returns a random color as a view of static storage.
+     *
+     * @returns Human readable color name.
+     *
+     * @code
+     * Color::nameView() // "Blue"
+     * @endcode
+     */
+    static std::string_view nameView();
+
+    /**
+     * @brief Returns the dataset `name()` picks its values from.
+     *
+     * @returns Dictionary of all values `name()` can return.
+     *
+     * @code
+     * const auto dictionary = Color::nameDictionary();
+     * dictionary[dictionary.randomIndex()] // "Blue"
+     * @endcode
+     */
+    static Dictionary nameDictionary();
+
     /**
      * @brief Returns an RGB color.
      *
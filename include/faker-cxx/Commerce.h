@@ -1,6 +1,9 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+
+#include "Dictionary.h"
 
 namespace faker
 {
@@ -18,6 +21,29 @@ public:
      */
     static std::string department();
 
+    /**
+     * @brief Returns a random commerce department as a view of static storage.
+     *
+     * @returns Commerce department name.
+     *
+     * @code
+     * Commerce::departmentView() // "Books"
+     * @endcode
+     */
+    static std::string_view departmentView();
+
+    /**
+     * @brief Returns the dataset `department()` picks its values from.
+     *
+     * @returns Dictionary of all values `department()` can return.
+     *
+     * @code
+     * const auto dictionary = Commerce::departmentDictionary();
+     * dictionary[dictionary.randomIndex()] // "Books"
+     * @endcode
+     */
+    static Dictionary departmentDictionary();
+
     /**
      * @brief Generates a random price between the given bounds (inclusive).
 
@@ -53,6 +79,29 @@ public:
      */
     static std::string productAdjective();
 
+    /**
+     * @brief Returns a random product adjective as a view of static storage.
+     *
+     * @returns Product adjective.
+     *
+     * @code
+     * Commerce::productAdjectiveView() // "Handcrafted"
+     * @endcode
+     */
+    static std::string_view productAdjectiveView();
+
+    /**
+     * @brief Returns the dataset `productAdjective()` picks its values from.
+     *
+     * @returns Dictionary of all values `productAdjective()` can return.
+     *
+     * @code
+     * const auto dictionary = Commerce::productAdjectiveDictionary();
+     * dictionary[dictionary.randomIndex()] // "Handcrafted"
+     * @endcode
+     */
+    static Dictionary productAdjectiveDictionary();
+
     /**
      * @brief Returns a random product material.
      *
@@ -64,6 +113,29 @@ public:
      */
     static std::string productMaterial();
 
+    /**
+     * @brief Returns a random product material as a view of static storage.
+     *
+     * @returns Product material.
+     *
+     * @code
+     * Commerce::productMaterialView() // "Wooden"
+     * @endcode
+     */
+    static std::string_view productMaterialView();
+
+    /**
+     * @brief Returns the dataset `productMaterial()` picks its values from.
+     *
+     * @returns Dictionary of all values `productMaterial()` can return.
+     *
+     * @code
+     * const auto dictionary = Commerce::productMaterialDictionary();
+     * dictionary[dictionary.randomIndex()] // "Wooden"
+     * @endcode
+     */
+    static Dictionary productMaterialDictionary();
+
     /**
      * @brief Returns a random product short name.
      *
@@ -75,6 +147,29 @@ public:
      */
     static std::string productName();
 
+    /**
+     * @brief Returns a random product short name as a view of static storage.
+     *
+     * @returns Product short name.
+     *
+     * @code
+     * Commerce::productNameView() // "Computer"
+     * @endcode
+     */
+    static std::string_view productNameView();
+
+    /**
+     * @brief Returns the dataset `productName()` picks its values from.
+     *
+     * @returns Dictionary of all values `productName()` can return.
+     *
+     * @code
+     * const auto dictionary = Commerce::productNameDictionary();
+     * dictionary[dictionary.randomIndex()] // "Computer"
+     * @endcode
+     */
+    static Dictionary productNameDictionary();
+
     /**
      * @brief Returns a random product full name.
      *
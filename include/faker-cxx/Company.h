@@ -1,6 +1,9 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+
+#include "Dictionary.h"
 
 namespace faker
 {
@@ -29,6 +32,29 @@ public:
      */
     static std::string type();
 
+    /**
+     * @brief Returns a random company type as a view of static storage.
+     *
+     * @returns Company type.
+     *
+     * @code
+     * Company::typeView() // "Nonprofit"
+     * @endcode
+     */
+    static std::string_view typeView();
+
+    /**
+     * @brief Returns the dataset `type()` picks its values from.
+     *
+     * @returns Dictionary of all values `type()` can return.
+     *
+     * @code
+     * const auto dictionary = Company::typeDictionary();
+     * dictionary[dictionary.randomIndex()] // "Nonprofit"
+     * @endcode
+     */
+    static Dictionary typeDictionary();
+
     /**
      * @brief Returns a random company industry.
      *
@@ -40,6 +66,29 @@ public:
      */
     static std::string industry();
 
+    /**
+     * @brief Returns a random company industry as a view of static storage.
+     *
+     * @returns Company industry.
+     *
+     * @code
+     * Company::industryView() // "Biotechnology"
+     * @endcode
+     */
+    static std::string_view industryView();
+
+    /**
+     * @brief Returns the dataset `industry()` picks its values from.
+     *
+     * @returns Dictionary of all values `industry()` can return.
+     *
+     * @code
+     * const auto dictionary = Company::industryDictionary();
+     * dictionary[dictionary.randomIndex()] // "Biotechnology"
+     * @endcode
+     */
+    static Dictionary industryDictionary();
+
     /**
      * @brief Returns a random buzz phrase.
      *
@@ -62,6 +111,29 @@ public:
      */
     static std::string buzzAdjective();
 
+    /**
+     * @brief Returns a random buzz adjective as a view of static storage.
+     *
+     * @returns Buzz adjective.
+     *
+     * @code
+     * Company::buzzAdjectiveView() // "one-to-one"
+     * @endcode
+     */
+    static std::string_view buzzAdjectiveView();
+
+    /**
+     * @brief Returns the dataset `buzzAdjective()` picks its values from.
+     *
+     * @returns Dictionary of all values `buzzAdjective()` can return.
+     *
+     * @code
+     * const auto dictionary = Company::buzzAdjectiveDictionary();
+     * dictionary[dictionary.randomIndex()] // "one-to-one"
+     * @endcode
+     */
+    static Dictionary buzzAdjectiveDictionary();
+
     /**
      * @brief Returns a random buzz noun.
      *
@@ -73,6 +145,29 @@ public:
      */
     static std::string buzzNoun();
 
+    /**
+     * @brief Returns a random buzz noun as a view of static storage.
+     *
+     * @returns Buzz noun.
+     *
+     * @code
+     * Company::buzzNounView() // "paradigms"
+     * @endcode
+     */
+    static std::string_view buzzNounView();
+
+    /**
+     * @brief Returns the dataset `buzzNoun()` picks its values from.
+     *
+     * @returns Dictionary of all values `buzzNoun()` can return.
+     *
+     * @code
+     * const auto dictionary = Company::buzzNounDictionary();
+     * dictionary[dictionary.randomIndex()] // "paradigms"
+     * @endcode
+     */
+    static Dictionary buzzNounDictionary();
+
     /**
      * @brief Returns a random buzz verb.
      *
@@ -84,6 +179,29 @@ public:
      */
     static std::string buzzVerb();
 
+    /**
+     * @brief Returns a random buzz verb as a view of static storage.
+     *
+     * @returns Buzz verb.
+     *
+     * @code
+     * Company::buzzVerbView() // "empower"
+     * @endcode
+     */
+    static std::string_view buzzVerbView();
+
+    /**
+     * @brief Returns the dataset `buzzVerb()` picks its values from.
+     *
+     * @returns Dictionary of all values `buzzVerb()` can return.
+     *
+     * @code
+     * const auto dictionary = Company::buzzVerbDictionary();
+     * dictionary[dictionary.randomIndex()] // "empower"
+     * @endcode
+     */
+    static Dictionary buzzVerbDictionary();
+
     /**
      * @brief Returns a random catch phrase.
      *
@@ -106,6 +224,29 @@ public:
      */
     static std::string catchPhraseAdjective();
 
+    /**
+     * @brief Returns a random catch phrase adjective as a view of static storage.
+     *
+     * @returns Catch phrase adjective.
+     *
+     * @code
+     * Company::catchPhraseAdjectiveView() // "Multi-tiered"
+     * @endcode
+     */
+    static std::string_view catchPhraseAdjectiveView();
+
+    /**
+     * @brief Returns the dataset `catchPhraseAdjective()` picks its values from.
+     *
+     * @returns Dictionary of all values `catchPhraseAdjective()` can return.
+     *
+     * @code
+     * const auto dictionary = Company::catchPhraseAdjectiveDictionary();
+     * dictionary[dictionary.randomIndex()] // "Multi-tiered"
+     * @endcode
+     */
+    static Dictionary catchPhraseAdjectiveDictionary();
+
     /**
      * @brief Returns a random catch phrase descriptor.
      *
@@ -117,6 +258,29 @@ public:
      */
     static std::string catchPhraseDescriptor();
 
+    /**
+     * @brief Returns a random catch phrase descriptor as a view of static storage.
+     *
+     * @returns Catch phrase descriptor.
+     *
+     * @code
+     * Company::catchPhraseDescriptorView() // "composite"
+     * @endcode
+     */
+    static std::string_view catchPhraseDescriptorView();
+
+    /**
+     * @brief Returns the dataset `catchPhraseDescriptor()` picks its values from.
+     *
+     * @returns Dictionary of all values `catchPhraseDescriptor()` can return.
+     *
+     * @code
+     * const auto dictionary = Company::catchPhraseDescriptorDictionary();
+     * dictionary[dictionary.randomIndex()] // "composite"
+     * @endcode
+     */
+    static Dictionary catchPhraseDescriptorDictionary();
+
     /**
      * @brief Returns a random catch phrase noun.
      *
@@ -127,5 +291,28 @@ public:
      * @endcode
      */
     static std::string catchPhraseNoun();
+
+    /**
+     * @brief Returns a random catch phrase noun as a view of static storage.
+     *
+     * @returns Catch phrase noun.
+     *
+     * @code
+     * Company::catchPhraseNounView() // "leverage"
+     * @endcode
+     */
+    static std::string_view catchPhraseNounView();
+
+    /**
+     * @brief Returns the dataset `catchPhraseNoun()` picks its values from.
+     *
+     * @returns Dictionary of all values `catchPhraseNoun()` can return.
+     *
+     * @code
+     * const auto dictionary = Company::catchPhraseNounDictionary();
+     * dictionary[dictionary.randomIndex()] // "leverage"
+     * @endcode
+     */
+    static Dictionary catchPhraseNounDictionary();
 };
 }
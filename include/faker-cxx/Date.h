@@ -1,6 +1,11 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
 #include <string>
+#include <string_view>
+
+#include "Dictionary.h"
 
 namespace faker
 {
@@ -21,6 +26,19 @@ public:
      */
     static std::string pastDate(int years = 1);
 
+    /**
+     * @brief Generates a random date in the past, like `pastDate()` does, as a time point.
+     *
+     * @param years The range of years the date may be in the past. Defaults to `1`.
+     *
+     * @returns Time point with precision of seconds.
+     *
+     * @code
+     * Date::pastTimestamp(5) // 2020-06-16 15:24:09
+     * @endcode
+     */
+    static std::chrono::sys_seconds pastTimestamp(int years = 1);
+
     /**
      * @brief Generates a random date in the future.
      *
@@ -35,6 +53,19 @@ public:
      */
     static std::string futureDate(int years = 1);
 
+    /**
+     * @brief Generates a random date in the future, like `futureDate()` does, as a time point.
+     *
+     * @param years The range of years the date may be in the future. Defaults to `1`.
+     *
+     * @returns Time point with precision of seconds.
+     *
+     * @code
+     * Date::futureTimestamp(5) // 2020-06-16 15:24:09
+     * @endcode
+     */
+    static std::chrono::sys_seconds futureTimestamp(int years = 1);
+
     /**
      * @brief Generates a random date in the recent past.
      *
@@ -49,6 +80,19 @@ public:
      */
     static std::string recentDate(int days = 3);
 
+    /**
+     * @brief Generates a random date in the recent past, like `recentDate()` does, as a time point.
+     *
+     * @param days The range of days the date may be in the past. Defaults to `3`.
+     *
+     * @returns Time point with precision of seconds.
+     *
+     * @code
+     * Date::recentTimestamp(10) // 2020-06-16 15:24:09
+     * @endcode
+     */
+    static std::chrono::sys_seconds recentTimestamp(int days = 3);
+
     /**
      * @brief Generates a random date in the soon future.
      *
@@ -63,6 +107,19 @@ public:
      */
     static std::string soonDate(int days = 3);
 
+    /**
+     * @brief Generates a random date in the near future, like `soonDate()` does, as a time point.
+     *
+     * @param days The range of days the date may be in the future. Defaults to `3`.
+     *
+     * @returns Time point with precision of seconds.
+     *
+     * @code
+     * Date::soonTimestamp(10) // 2020-06-16 15:24:09
+     * @endcode
+     */
+    static std::chrono::sys_seconds soonTimestamp(int days = 3);
+
     /**
      * @brief Generates a random birthdate by age.
      *
@@ -78,11 +135,27 @@ public:
      */
     static std::string birthdateByAge(int minAge = 18, int maxAge = 80);
 
+    /**
+     * @brief Generates a random birthdate by age, like `birthdateByAge()` does, as a time point.
+     *
+     * @param minAge The minimum age to generate a birthdate. Defaults to `18`.
+     * @param maxAge The maximum age to generate a birthdate. Defaults to `80`.
+     *
+     * @returns Time point with precision of seconds.
+     *
+     * @code
+     * Date::birthdateByAgeTimestamp(20, 30) // 1996-11-14 11:27:09
+     * @endcode
+     */
+    static std::chrono::sys_seconds birthdateByAgeTimestamp(int minAge = 18, int maxAge = 80);
+
     /**
      * @brief Generates a random birthdate by year.
      *
+     * The birthdate is in UTC, from the start of the min year to the end of the max year.
+     *
      * @param minYear The minimum year to generate a birthdate. Defaults to `1920`.
-     * @param maxAge The maximum year to generate a birthdate. Defaults to `2000`.
+     * @param maxYear The maximum year to generate a birthdate. Defaults to `2000`.
      *
      * @returns ISO formatted string.
      *
@@ -93,6 +166,50 @@ public:
      */
     static std::string birthdateByYear(int minYear = 1920, int maxYear = 2000);
 
+    /**
+     * @brief Generates a random birthdate by year, like `birthdateByYear()` does, as a time point.
+     *
+     * @param minYear The minimum year to generate a birthdate. Defaults to `1920`.
+     * @param maxYear The maximum year to generate a birthdate. Defaults to `2000`.
+     *
+     * @returns Time point with precision of seconds.
+     *
+     * @code
+     * Date::birthdateByYearTimestamp(1996, 1996) // 1996-05-19 12:00:23
+     * @endcode
+     */
+    static std::chrono::sys_seconds birthdateByYearTimestamp(int minYear = 1920, int maxYear = 2000);
+
+    /**
+     * @brief Pins the date the generators of dates relative to the current date use as the current date.
+     *
+     * Pinning makes the generated dates reproducible, and saves reading the system clock on every call.
+     *
+     * @param referenceDate The date to use as the current date, if none is provided the current time is pinned.
+     *
+     * @code
+     * Date::pinReferenceDate(std::chrono::sys_days{std::chrono::year{2024} / 1 / 1});
+     * Date::recentDate() // "2023-12-29T18:24:12Z"
+     * @endcode
+     */
+    static void pinReferenceDate(std::optional<std::chrono::sys_seconds> referenceDate = std::nullopt);
+
+    /**
+     * @brief Makes the generators of dates use the current time of the system clock again.
+     */
+    static void unpinReferenceDate();
+
+    /**
+     * @brief Returns the date the generators of dates relative to the current date use as the current date.
+     *
+     * @returns Pinned reference date or, if none is pinned, the current time.
+     *
+     * @code
+     * Date::referenceDate() // 2023-07-05 14:12:40
+     * @endcode
+     */
+    static std::chrono::sys_seconds referenceDate();
+
     /**
      * @brief Returns a name of random day of the week.
      *
@@ -104,6 +221,29 @@ public:
      */
     static std::string weekdayName();
 
+    /**
+     * @brief Returns a name of random day of the week as a view of static storage.
+     *
+     * @returns Name of the weekday.
+     *
+     * @code
+     * Date::weekdayNameView() // "Monday"
+     * @endcode
+     */
+    static std::string_view weekdayNameView();
+
+    /**
+     * @brief Returns the dataset `weekdayName()` picks its values from.
+     *
+     * @returns Dictionary of all values `weekdayName()` can return.
+     *
+     * @code
+     * const auto dictionary = Date::weekdayNameDictionary();
+     * dictionary[dictionary.randomIndex()] // "Monday"
+     * @endcode
+     */
+    static Dictionary weekdayNameDictionary();
+
     /**
      * @brief Returns an abbreviated name of random day of the week.
      *
@@ -115,6 +255,29 @@ public:
      */
     static std::string weekdayAbbreviatedName();
 
+    /**
+     * @brief Returns an abbreviated name of random day of the week as a view of static storage.
+     *
+     * @returns Abbreviated name of the weekday.
+     *
+     * @code
+     * Date::weekdayAbbreviatedNameView() // "Mon"
+     * @endcode
+     */
+    static std::string_view weekdayAbbreviatedNameView();
+
+    /**
+     * @brief Returns the dataset `weekdayAbbreviatedName()` picks its values from.
+     *
+     * @returns Dictionary of all values `weekdayAbbreviatedName()` can return.
+     *
+     * @code
+     * const auto dictionary = Date::weekdayAbbreviatedNameDictionary();
+     * dictionary[dictionary.randomIndex()] // "Mon"
+     * @endcode
+     */
+    static Dictionary weekdayAbbreviatedNameDictionary();
+
     /**
      * @brief Returns a random name of a month.
      *
@@ -126,6 +289,29 @@ public:
      */
     static std::string monthName();
 
+    /**
+     * @brief Returns a random name of a month as a view of static storage.
+     *
+     * @returns Name of the month.
+     *
+     * @code
+     * Date::monthNameView() // "October"
+     * @endcode
+     */
+    static std::string_view monthNameView();
+
+    /**
+     * @brief Returns the dataset `monthName()` picks its values from.
+     *
+     * @returns Dictionary of all values `monthName()` can return.
+     *
+     * @code
+     * const auto dictionary = Date::monthNameDictionary();
+     * dictionary[dictionary.randomIndex()] // "October"
+     * @endcode
+     */
+    static Dictionary monthNameDictionary();
+
     /**
      * @brief Returns an abbreviated name of random month.
      *
@@ -136,5 +322,28 @@ public:
      * @endcode
      */
     static std::string monthAbbreviatedName();
+
+    /**
+     * @brief Returns an abbreviated name of random month as a view of static storage.
+     *
+     * @returns Abbreviated name of the month.
+     *
+     * @code
+     * Date::monthAbbreviatedNameView() // "Feb"
+     * @endcode
+     */
+    static std::string_view monthAbbreviatedNameView();
+
+    /**
+     * @brief Returns the dataset `monthAbbreviatedName()` picks its values from.
+     *
+     * @returns Dictionary of all values `monthAbbreviatedName()` can return.
+     *
+     * @code
+     * const auto dictionary = Date::monthAbbreviatedNameDictionary();
+     * dictionary[dictionary.randomIndex()] // "Feb"
+     * @endcode
+     */
+    static Dictionary monthAbbreviatedNameDictionary();
 };
 }
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "../../src/common/StringPool.h"
+
+namespace faker
+{
+/**
+ * @brief Read-only view of a dataset a generator picks its values from.
+ *
+ * Meant for dictionary-encoded outputs, where the dictionary is written once and every generated value is only an
+ * index into it. The dictionary refers to static data of the library and is cheap to copy.
+ *
+ * @code
+ * const auto cities = Location::cityDictionary();
+ *
+ * for (std::size_t i = 0; i < cities.size(); i++)
+ * {
+ *     writeDictionaryEntry(cities[i]);
+ * }
+ *
+ * writeCodes(cities.randomIndices(1000000));
+ * @endcode
+ */
+class Dictionary
+{
+public:
+    explicit Dictionary(std::span<const std::string_view> entries);
+
+    explicit Dictionary(StringPoolView entries);
+
+    std::size_t size() const;
+
+    bool empty() const;
+
+    /**
+     * @return Entry with the given index, the index must be smaller than `size()`.
+     */
+    std::string_view operator[](std::size_t index) const;
+
+    /**
+     * @throws std::out_of_range if the index is not smaller than `size()`.
+     *
+     * @return Entry with the given index.
+     */
+    std::string_view at(std::size_t index) const;
+
+    /**
+     * @brief Returns index of a random entry, with the same distribution as the generator owning the dictionary.
+     *
+     * @throws std::invalid_argument if the dictionary is empty.
+     *
+     * @return Index in range `[0, size())`.
+     */
+    std::size_t randomIndex() const;
+
+    /**
+     * @brief Returns indices of `count` random entries.
+     *
+     * @param count The number of indices.
+     *
+     * @throws std::invalid_argument if the dictionary is empty.
+     *
+     * @return Indices in range `[0, size())`.
+     */
+    std::vector<std::size_t> randomIndices(std::size_t count) const;
+
+private:
+    std::variant<std::span<const std::string_view>, StringPoolView> entries;
+};
+}
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstddef>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
+#include "Dictionary.h"
 #include "faker-cxx/types/BicCountry.h"
 #include "faker-cxx/types/IbanCountry.h"
 #include "faker-cxx/types/Precision.h"
@@ -32,6 +36,29 @@ public:
      */
     static std::string currencyCode();
 
+    /**
+     * @brief Returns a random currency code as a view of static storage.
+     *
+     * @returns Code of the currency.
+     *
+     * @code
+     * Finance::currencyCodeView() // "USD"
+     * @endcode
+     */
+    static std::string_view currencyCodeView();
+
+    /**
+     * @brief Returns the dataset `currencyCode()` picks its values from.
+     *
+     * @returns Dictionary of all values `currencyCode()` can return.
+     *
+     * @code
+     * const auto dictionary = Finance::currencyCodeDictionary();
+     * dictionary[dictionary.randomIndex()] // "USD"
+     * @endcode
+     */
+    static Dictionary currencyCodeDictionary();
+
     /**
      * @brief Returns a random account type.
      *
@@ -43,6 +70,29 @@ public:
      */
     static std::string accountType();
 
+    /**
+     * @brief Returns a random account type as a view of static storage.
+     *
+     * @returns Account type.
+     *
+     * @code
+     * Finance::accountTypeView() // "Savings"
+     * @endcode
+     */
+    static std::string_view accountTypeView();
+
+    /**
+     * @brief Returns the dataset `accountType()` picks its values from.
+     *
+     * @returns Dictionary of all values `accountType()` can return.
+     *
+     * @code
+     * const auto dictionary = Finance::accountTypeDictionary();
+     * dictionary[dictionary.randomIndex()] // "Savings"
+     * @endcode
+     */
+    static Dictionary accountTypeDictionary();
+
     /**
      * @brief Generates a random amount between the given bounds (inclusive).
 
@@ -64,7 +114,7 @@ public:
                               const std::string& symbol = "");
 
     /**
-     * Generates a random iban.
+     * Generates a random iban with valid ISO 7064 mod-97 check digits.
      *
      * @param country The country from which you want to generate an IBAN, if none is provided a random country
      will be used.
@@ -77,6 +127,21 @@ public:
      */
     static std::string iban(std::optional<IbanCountry> country = std::nullopt);
 
+    /**
+     * Generates random ibans with valid ISO 7064 mod-97 check digits.
+     *
+     * @param count The number of IBANs.
+     * @param country The country from which you want to generate IBANs, if none is provided a random country
+     will be used for every IBAN.
+     *
+     * @returns IBANs.
+     *
+     * @code
+     * Finance::ibans(2, IbanCountry::Germany) // {"DE89370400440532013000", "DE02120300000000202051"}
+     * @endcode
+     */
+    static std::vector<std::string> ibans(std::size_t count, std::optional<IbanCountry> country = std::nullopt);
+
     /**
      * Generates a random bic.
      *
@@ -143,6 +208,22 @@ public:
      */
     static std::string creditCardNumber(std::optional<CreditCardType> creditCardType = std::nullopt);
 
+    /**
+     * Generates random credit card numbers passing the Luhn check.
+     *
+     * @param count The number of credit card numbers.
+     * @param creditCardType The type of the credit cards, if none is provided a random type will be used for every
+     number.
+     *
+     * @returns Credit card numbers.
+     *
+     * @code
+     * Finance::creditCardNumbers(2, CreditCardType::Visa) // {"4882664999007", "4539-1488-0343-6467"}
+     * @endcode
+     */
+    static std::vector<std::string> creditCardNumbers(std::size_t count,
+                                                      std::optional<CreditCardType> creditCardType = std::nullopt);
+
     /**
      * Generates a random credit card CVV.
      *
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace faker
+{
+struct GeoPoint {
+    double latitude;
+    double longitude;
+};
+
+struct GeoBoundingBox {
+    double minLatitude;
+    double maxLatitude;
+    // A box with `minLongitude` greater than `maxLongitude` crosses the antimeridian.
+    double minLongitude;
+    double maxLongitude;
+};
+
+struct GeoHotspot {
+    GeoPoint center;
+    // Standard deviation of the north-south and east-west distances of points from the center.
+    double radiusKm;
+    // Relative share of points around this hotspot.
+    double weight = 1.0;
+};
+
+/**
+ * @brief Generates numeric coordinates of random points in bulk, as separate arrays of latitudes and longitudes.
+ *
+ * Points are generated in chunks. Random numbers, the choice of triangles or hotspots and calls into libm (`asin`,
+ * `sqrt`, `log1p`, `sin` and `cos`) run in scalar passes over a whole chunk. The arithmetic turning their results into
+ * coordinates runs in separate branch-free passes over contiguous arrays, which compilers vectorize.
+ *
+ * @code
+ * const auto europe = GeoPointGenerator::boundingBox({35.0, 71.0, -10.0, 40.0});
+ *
+ * std::vector<double> latitudes(1000000);
+ * std::vector<double> longitudes(1000000);
+ *
+ * europe.fill(latitudes, longitudes);
+ * @endcode
+ */
+class GeoPointGenerator
+{
+public:
+    /**
+     * @return Generator of points uniformly distributed on the whole sphere.
+     */
+    static GeoPointGenerator sphere();
+
+    /**
+     * @return Generator of points uniformly distributed on the area of the sphere within the box.
+     *
+     * @throws std::invalid_argument if latitudes are outside of `[-90, 90]`, longitudes are outside of `[-180, 180]`
+     * or the minimum latitude is greater than the maximum latitude.
+     */
+    static GeoPointGenerator boundingBox(const GeoBoundingBox& box);
+
+    /**
+     * @brief Triangulates the polygon once, points then fall in a triangle chosen with probability proportional to its
+     * area.
+     *
+     * Points are uniformly distributed over the polygon drawn on a latitude-longitude grid, which is close to uniform
+     * on the sphere for polygons spanning a few degrees of latitude. Polygons crossing the antimeridian are not
+     * supported.
+     *
+     * @param vertices Vertices of a simple polygon, in either order, without repeating the first vertex.
+     *
+     * @return Generator of points inside the polygon.
+     *
+     * @throws std::invalid_argument if the polygon has fewer than 3 vertices, no area or intersects itself.
+     */
+    static GeoPointGenerator polygon(std::span<const GeoPoint> vertices);
+
+    /**
+     * @brief Points are scattered around hotspots by normally distributed distances from their centers.
+     *
+     * @return Generator of points clustered around the hotspots.
+     *
+     * @throws std::invalid_argument if there are no hotspots, or a radius or a weight is negative or weights sum to 0.
+     */
+    static GeoPointGenerator hotspots(std::span<const GeoHotspot> hotspots);
+
+    /**
+     * @brief Fills the arrays with coordinates of random points, in degrees.
+     *
+     * @throws std::invalid_argument if the arrays have different sizes.
+     */
+    void fill(std::span<double> latitudes, std::span<double> longitudes) const;
+
+    /**
+     * @copydoc fill(std::span<double>, std::span<double>) const
+     */
+    void fill(std::span<float> latitudes, std::span<float> longitudes) const;
+
+    /**
+     * @return Random point.
+     */
+    GeoPoint next() const;
+
+private:
+    enum class Area
+    {
+        Sphere,
+        BoundingBox,
+        Polygon,
+        Hotspots
+    };
+
+    struct Triangle {
+        GeoPoint a;
+        GeoPoint b;
+        GeoPoint c;
+    };
+
+    // Degrees of latitude and longitude per standard normal distance from the center.
+    struct HotspotScale {
+        GeoPoint center;
+        double latitudeScale;
+        double longitudeScale;
+    };
+
+    explicit GeoPointGenerator(Area area);
+
+    template <std::floating_point T>
+    void fillPoints(std::span<T> latitudes, std::span<T> longitudes) const;
+
+    void generateChunk(std::span<double> latitudes, std::span<double> longitudes) const;
+
+    Area area;
+    // Sines of the latitude bounds and longitude bounds of the box, the longitude span may cross the antimeridian.
+    double minLatitudeSine = -1.0;
+    double latitudeSineSpan = 2.0;
+    double minLongitude = -180.0;
+    double longitudeSpan = 360.0;
+    std::vector<Triangle> triangles;
+    std::vector<HotspotScale> hotspotList;
+    // Running sums of triangle areas or hotspot weights, normalized to end at 1.
+    std::vector<double> cumulativeWeights;
+};
+}
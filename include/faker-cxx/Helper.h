@@ -7,7 +7,11 @@
 #include <string_view>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 #include "../../src/common/LuhnCheck.h"
 #include "../src/common/StringHelper.h"
@@ -62,6 +66,56 @@ public:
         return data;
     }
 
+    /**
+     * @brief Returns `count` distinct random indices from the range `[0, size)`.
+     *
+     * Uses Robert Floyd's sampling algorithm, so the cost depends on `count` only and no index array of `size`
+     * elements is built.
+     *
+     * @param size The size of the range to sample from.
+     * @param count The number of indices to pick.
+     *
+     * @throws std::invalid_argument if count is greater than size.
+     *
+     * @return Distinct indices in random order.
+     *
+     * @code
+     * Helper::sampleIndices(10, 3) // {7, 2, 9}
+     * @endcode
+     */
+    static std::vector<std::size_t> sampleIndices(std::size_t size, std::size_t count);
+
+    /**
+     * @brief Returns `count` distinct random elements from an STL container without copying or shuffling it.
+     *
+     * @tparam T an element type of the container.
+     *
+     * @param data The container.
+     * @param count The number of elements to pick.
+     *
+     * @throws std::invalid_argument if count is greater than the size of the container.
+     *
+     * @return Elements picked from distinct positions of the container, in random order.
+     *
+     * @code
+     * Helper::sample<std::string>(std::vector<std::string>{{"hello"}, {"world"}, {"foo"}}, 2) // {"foo", "hello"}
+     * @endcode
+     */
+    template <class T>
+    static std::vector<T> sample(std::span<const T> data, std::size_t count)
+    {
+        std::vector<T> sampledElements;
+
+        sampledElements.reserve(count);
+
+        for (const auto index : sampleIndices(data.size(), count))
+        {
+            sampledElements.push_back(data[index]);
+        }
+
+        return sampledElements;
+    }
+
     /**
      * @brief Returns the given string parsed symbol by symbol and replaced the placeholders with digits ("0" - "9").
      * "!" will be replaced by digits >=2 ("2" - "9").
@@ -158,7 +212,8 @@ public:
 
     /**
      * @brief Returns the result of the callback if the probability check was successful, otherwise empty string.
-*
+     *
+     * The callback is taken by forwarding reference and invoked directly, so no type erasure or allocation happens.
      *
      * @tparam TResult The type of result of the given callback.
      *
@@ -172,15 +227,181 @@ public:
      * Helper::maybe<int>([]() { return 42; }, 0.9) // "42"
      * @endcode
      */
-    template <typename TResult>
-    static TResult maybe(std::function<TResult()> callback, double probability = 0.5) {
-        if (Datatype::boolean(probability)) {
-            return callback();
+    template <typename TResult, typename Callable>
+    static TResult maybe(Callable&& callback, double probability = 0.5)
+    {
+        if (Datatype::boolean(probability))
+        {
+            return std::invoke(std::forward<Callable>(callback));
         }
         return TResult();
     }
 
+    /**
+     * @brief Returns the result of one of the given generators, picked with equal probability.
+     *
+     * @tparam Generators The types of the generators. Their results must have a common type.
+     *
+     * @param generators The generators to pick from.
+     *
+     * @return The result of the picked generator.
+     *
+     * @code
+     * Helper::oneOf([]() { return Person::firstName(); }, []() { return Person::lastName(); }) // "Doe"
+     * @endcode
+     */
+    template <typename... Generators>
+    static auto oneOf(Generators&&... generators)
+    {
+        static_assert(sizeof...(Generators) > 0, "At least one generator is required.");
+
+        using TResult = std::common_type_t<std::invoke_result_t<Generators&>...>;
+
+        const auto generatorIndex = Number::integer<std::size_t>(sizeof...(Generators) - 1);
+
+        return invokeGeneratorAt<TResult>(generatorIndex, generators...);
+    }
+
+    /**
+     * @brief Returns the result of one of the given generators, picked with probability proportional to its weight.
+     *
+     * @tparam Weights The integral types of the weights.
+     * @tparam Generators The types of the generators. Their results must have a common type.
+     *
+     * @param weightedGenerators Pairs of weight and generator.
+     *
+     * @throws std::invalid_argument if a weight is negative or the sum of weights is zero.
+     *
+     * @return The result of the picked generator.
+     *
+     * @code
+     * Helper::weighted(std::pair{9, []() { return "common"; }}, std::pair{1, []() { return "rare"; }}) // "common"
+     * @endcode
+     */
+    template <std::integral... Weights, typename... Generators>
+    static auto weighted(std::pair<Weights, Generators>... weightedGenerators)
+    {
+        static_assert(sizeof...(Generators) > 0, "At least one generator is required.");
+
+        using TResult = std::common_type_t<std::invoke_result_t<Generators&>...>;
+
+        if ((std::cmp_less(weightedGenerators.first, 0) || ...))
+        {
+            throw std::invalid_argument("Weights must not be negative.");
+        }
+
+        const auto totalWeight = (static_cast<std::size_t>(weightedGenerators.first) + ...);
+
+        if (totalWeight == 0)
+        {
+            throw std::invalid_argument("Sum of weights must be greater than zero.");
+        }
+
+        const auto target = Number::integer<std::size_t>(totalWeight - 1);
+
+        return invokeWeightedGenerator<TResult>(target, weightedGenerators...);
+    }
+
+    /**
+     * @brief Returns the results of the generator invoked given number of times, joined with the separator.
+     *
+     * @tparam Generator The type of the generator. Its result must be appendable to std::string.
+     *
+     * @param count The number of generator invocations.
+     * @param generator The generator to invoke.
+     * @param separator The separator placed between results. Defaults to empty string.
+     *
+     * @return The joined results.
+     *
+     * @code
+     * Helper::repeat(3, []() { return Word::noun(); }, "-") // "apple-table-hill"
+     * @endcode
+     */
+    template <typename Generator>
+    static std::string repeat(unsigned count, Generator&& generator, std::string_view separator = "")
+    {
+        std::string result;
+
+        for (unsigned i = 0; i < count; i++)
+        {
+            if (i > 0)
+            {
+                result += separator;
+            }
+
+            result += std::invoke(generator);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Returns the results of the given generators, invoked in order and joined with the separator.
+     *
+     * @tparam Generators The types of the generators. Their results must be appendable to std::string.
+     *
+     * @param separator The separator placed between results.
+     * @param generators The generators to invoke.
+     *
+     * @return The joined results.
+     *
+     * @code
+     * Helper::join(" ", []() { return Person::firstName(); }, []() { return Person::lastName(); }) // "John Doe"
+     * @endcode
+     */
+    template <typename... Generators>
+    static std::string join(std::string_view separator, Generators&&... generators)
+    {
+        std::string result;
+        std::size_t generatorIndex = 0;
+
+        const auto appendResult = [&result, &generatorIndex, separator](auto& generator)
+        {
+            if (generatorIndex++ > 0)
+            {
+                result += separator;
+            }
+
+            result += std::invoke(generator);
+        };
+
+        (appendResult(generators), ...);
+
+        return result;
+    }
+
 private:
+    template <typename TResult, typename Generator, typename... Generators>
+    static TResult invokeGeneratorAt(std::size_t index, Generator& generator, Generators&... generators)
+    {
+        if constexpr (sizeof...(Generators) > 0)
+        {
+            if (index > 0)
+            {
+                return invokeGeneratorAt<TResult>(index - 1, generators...);
+            }
+        }
+
+        return std::invoke(generator);
+    }
+
+    template <typename TResult, typename Weight, typename Generator, typename... Weights, typename... Generators>
+    static TResult invokeWeightedGenerator(std::size_t target, std::pair<Weight, Generator>& weightedGenerator,
+                                           std::pair<Weights, Generators>&... weightedGenerators)
+    {
+        if constexpr (sizeof...(Generators) > 0)
+        {
+            const auto weight = static_cast<std::size_t>(weightedGenerator.first);
+
+            if (target >= weight)
+            {
+                return invokeWeightedGenerator<TResult>(target - weight, weightedGenerators...);
+            }
+        }
+
+        return std::invoke(weightedGenerator.second);
+    }
+
     static std::random_device randomDevice;
     static std::mt19937 pseudoRandomGenerator;
 };
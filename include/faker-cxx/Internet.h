@@ -2,7 +2,9 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 
+#include "Dictionary.h"
 #include "types/EmojiType.h"
 #include "types/Ipv4Address.h"
 #include "types/Ipv4Class.h"
@@ -131,6 +133,34 @@ public:
      */
     static std::string emoji(std::optional<EmojiType> type = std::nullopt);
 
+    /**
+     * @brief Returns a random emoji as a view of static storage.
+     *
+     * @param type The optional type of them emoji to be generated.
+     *
+     * @returns Emoji.
+     *
+     * @code
+     * Internet::emojiView() // "👑"
+     * Internet::emojiView(EmojiType::Food) // "🍕"
+     * @endcode
+     */
+    static std::string_view emojiView(std::optional<EmojiType> type = std::nullopt);
+
+    /**
+     * @brief Returns the dataset `emoji()` picks its values from.
+     *
+     * @param type The optional type of them emoji to be generated.
+     *
+     * @returns Dictionary of all values `emoji()` can return.
+     *
+     * @code
+     * const auto dictionary = Internet::emojiDictionary();
+     * dictionary[dictionary.randomIndex()] // "👑"
+     * @endcode
+     */
+    static Dictionary emojiDictionary(std::optional<EmojiType> type = std::nullopt);
+
     /**
      * @brief Returns a random web protocol. Either `http` or `https`.
      *
@@ -142,6 +172,29 @@ public:
      */
     static std::string protocol();
 
+    /**
+     * @brief Returns a random web protocol. Either `http` or `https` as a view of static storage.
+     *
+     * @returns Web protocol.
+     *
+     * @code
+     * Internet::protocolView() // "https"
+     * @endcode
+     */
+    static std::string_view protocolView();
+
+    /**
+     * @brief Returns the dataset `protocol()` picks its values from.
+     *
+     * @returns Dictionary of all values `protocol()` can return.
+     *
+     * @code
+     * const auto dictionary = Internet::protocolDictionary();
+     * dictionary[dictionary.randomIndex()] // "https"
+     * @endcode
+     */
+    static Dictionary protocolDictionary();
+
     /**
      * @brief Generates a random http method name.
      *
@@ -153,6 +206,29 @@ public:
      */
     static std::string httpMethod();
 
+    /**
+     * @brief Generates a random http method name as a view of static storage.
+     *
+     * @returns Http method name.
+     *
+     * @code
+     * Internet::httpMethodView() // "POST"
+     * @endcode
+     */
+    static std::string_view httpMethodView();
+
+    /**
+     * @brief Returns the dataset `httpMethod()` picks its values from.
+     *
+     * @returns Dictionary of all values `httpMethod()` can return.
+     *
+     * @code
+     * const auto dictionary = Internet::httpMethodDictionary();
+     * dictionary[dictionary.randomIndex()] // "POST"
+     * @endcode
+     */
+    static Dictionary httpMethodDictionary();
+
     /**
      * @brief Returns a random http status code.
      *
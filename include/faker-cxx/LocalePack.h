@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../../src/common/StringPool.h"
+#include "Dictionary.h"
+#include "types/Country.h"
+
+namespace faker
+{
+/**
+ * @brief Read-only word lists stored in a binary file, mapped into memory instead of read.
+ *
+ * A pack holds named lists of strings in the layout of a StringPool, so lists are used in place and pages of the
+ * file are loaded only when their strings are read. Processes mapping the same pack share one copy of it in the page
+ * cache. Packs are written with `LocalePackWriter`, in the byte order of the writing machine.
+ *
+ * Packs registered for a country with `LocalePackRegistry` supply Location data of countries without compiled data,
+ * from lists named `cities`, `zipCodeFormats`, `buildingNumberFormats`, `streetFormats`, `streetSuffixes` and
+ * `addressFormats`. Names in their streets and addresses come from optional `firstNames` and `lastNames` lists, or
+ * from Person without them. Person itself has no country and keeps its compiled names. Any other pack, such as
+ * custom word lists, is opened directly:
+ *
+ * @code
+ * const LocalePack pack{"words.pack"};
+ *
+ * const auto words = pack.dictionary("adjectives");
+ *
+ * words[words.randomIndex()] // "brave"
+ * @endcode
+ */
+class LocalePack
+{
+public:
+    /**
+     * @brief Maps the pack file at the given path.
+     *
+     * @throws std::runtime_error if the file cannot be mapped or is not a valid locale pack.
+     */
+    explicit LocalePack(const std::filesystem::path& path);
+
+    LocalePack(const LocalePack&) = delete;
+    LocalePack& operator=(const LocalePack&) = delete;
+
+    LocalePack(LocalePack&& other) noexcept;
+    LocalePack& operator=(LocalePack&& other) noexcept;
+
+    ~LocalePack();
+
+    bool contains(std::string_view name) const;
+
+    /**
+     * @throws std::out_of_range if the pack has no list with the given name.
+     *
+     * @return Strings of the list, valid as long as the pack.
+     */
+    StringPoolView list(std::string_view name) const;
+
+    /**
+     * @throws std::out_of_range if the pack has no list with the given name.
+     *
+     * @return Dictionary of the list, valid as long as the pack.
+     */
+    Dictionary dictionary(std::string_view name) const;
+
+private:
+    struct List {
+        std::string_view name;
+        StringPoolView strings;
+    };
+
+    void unmap();
+
+    const std::byte* data = nullptr;
+    std::size_t size = 0;
+    std::vector<List> lists;
+};
+
+/**
+ * @brief Builds locale pack files.
+ *
+ * @code
+ * const auto adjectives = std::to_array<std::string_view>({"brave", "calm", "eager"});
+ *
+ * LocalePackWriter writer;
+ * writer.addList("adjectives", adjectives);
+ * writer.write("words.pack");
+ * @endcode
+ */
+class LocalePackWriter
+{
+public:
+    /**
+     * @throws std::invalid_argument if a list with the given name was already added.
+     * @throws std::length_error if the name or a string is longer than 255 characters.
+     */
+    void addList(std::string_view name, std::span<const std::string_view> strings);
+
+    /**
+     * @brief Writes all added lists into a pack file, strings repeated within or across lists are stored once.
+     *
+     * @throws std::length_error if the strings do not fit in 32-bit offsets.
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    void write(const std::filesystem::path& path) const;
+
+private:
+    std::vector<std::pair<std::string, std::vector<std::string>>> lists;
+};
+
+/**
+ * @brief Locale packs supplying data of countries, mapped on first use.
+ *
+ * Registering a pack only records its path, so packs of countries never generated cost nothing. A mapped pack stays
+ * mapped until it is unregistered, which must not happen while values or dictionaries taken from it are in use.
+ */
+class LocalePackRegistry
+{
+public:
+    /**
+     * @brief Registers the pack at the given path for the country, replacing any pack registered before.
+     */
+    static void registerPack(Country country, std::filesystem::path path);
+
+    static void unregisterPack(Country country);
+
+    /**
+     * @throws std::runtime_error if the registered pack cannot be mapped.
+     *
+     * @return Pack registered for the country, mapping it if it is used for the first time, or null if there is none.
+     */
+    static std::shared_ptr<const LocalePack> find(Country country);
+};
+}
@@ -1,12 +1,19 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
+#include "Dictionary.h"
 #include "types/Country.h"
 #include "types/Precision.h"
 
 namespace faker
 {
+/**
+ * Data of countries other than `Country::Usa` comes from locale packs registered with `LocalePackRegistry`, a country
+ * without data throws `std::out_of_range`. Functions returning strings hold the pack until they return, views and
+ * dictionaries of pack data are only valid until the pack of the country is unregistered or replaced.
+ */
 class Location
 {
 public:
@@ -21,6 +28,29 @@ public:
      */
     static std::string country();
 
+    /**
+     * @brief Returns a random country name as a view of static storage.
+     *
+     * @returns Country name.
+     *
+     * @code
+     * Location::countryView() // "Poland"
+     * @endcode
+     */
+    static std::string_view countryView();
+
+    /**
+     * @brief Returns the dataset `country()` picks its values from.
+     *
+     * @returns Dictionary of all values `country()` can return.
+     *
+     * @code
+     * const auto dictionary = Location::countryDictionary();
+     * dictionary[dictionary.randomIndex()] // "Poland"
+     * @endcode
+     */
+    static Dictionary countryDictionary();
+
     /**
      * @brief Returns a random USA state.
      *
@@ -32,6 +62,29 @@ public:
      */
     static std::string state();
 
+    /**
+     * @brief Returns a random USA state as a view of static storage.
+     *
+     * @returns USA state.
+     *
+     * @code
+     * Location::stateView() // "Arizona"
+     * @endcode
+     */
+    static std::string_view stateView();
+
+    /**
+     * @brief Returns the dataset `state()` picks its values from.
+     *
+     * @returns Dictionary of all values `state()` can return.
+     *
+     * @code
+     * const auto dictionary = Location::stateDictionary();
+     * dictionary[dictionary.randomIndex()] // "Arizona"
+     * @endcode
+     */
+    static Dictionary stateDictionary();
+
     /**
      * @brief Returns a random city for given country.
      *
@@ -45,6 +98,35 @@ public:
      */
     static std::string city(Country country = Country::Usa);
 
+    /**
+     * @brief Returns a random city for given country as a view of static storage, or of the locale pack of the country
+     * while the pack stays registered.
+     *
+     * @param country The country to generate city from. Defaults to `Country::Usa`.
+     *
+     * @returns City.
+     *
+     * @code
+     * Location::cityView() // "Boston"
+     * @endcode
+     */
+    static std::string_view cityView(Country country = Country::Usa);
+
+    /**
+     * @brief Returns the dataset `city()` picks its values from.
+     *
+     * @param country The country to generate city from. Defaults to `Country::Usa`.
+     *
+     * @returns Dictionary of all values `city()` can return, viewing the locale pack of the country while the pack
+     * stays registered.
+     *
+     * @code
+     * const auto dictionary = Location::cityDictionary();
+     * dictionary[dictionary.randomIndex()] // "Boston"
+     * @endcode
+     */
+    static Dictionary cityDictionary(Country country = Country::Usa);
+
     /**
      * @brief Returns a random zip code for given country.
      *
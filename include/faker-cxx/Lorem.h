@@ -1,6 +1,9 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+
+#include "Dictionary.h"
 
 namespace faker
 {
@@ -18,6 +21,29 @@ public:
      */
     static std::string word();
 
+    /**
+     * @brief Returns a random lorem word as a view of static storage.
+     *
+     * @returns Lorem word.
+     *
+     * @code
+     * Lorem::wordView() // "temporibus"
+     * @endcode
+     */
+    static std::string_view wordView();
+
+    /**
+     * @brief Returns the dataset `word()` picks its values from.
+     *
+     * @returns Dictionary of all values `word()` can return.
+     *
+     * @code
+     * const auto dictionary = Lorem::wordDictionary();
+     * dictionary[dictionary.randomIndex()] // "temporibus"
+     * @endcode
+     */
+    static Dictionary wordDictionary();
+
     /**
      * @brief Returns a random lorem words.
      *
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+namespace faker
+{
+/**
+ * @brief Walks a keyed pseudo-random permutation of the range `[0, size)`.
+ *
+ * Every value of the range is returned exactly once, in an order that depends on the key. The permutation is a
+ * balanced Feistel network over the smallest power-of-four domain that covers the range, with cycle-walking for values
+ * that fall outside of it, so no generated values are stored and each value costs O(1) time.
+ *
+ * @code
+ * Permutation accountNumbers{100000000};
+ * accountNumbers.nextNumeric(8) // "40519377"
+ *
+ * Permutation shard{1000000, 42};
+ * shard.seek(500000); // continue from the middle of the same permutation on another worker
+ * @endcode
+ */
+class Permutation
+{
+public:
+    /**
+     * @param size The size of the permuted range.
+     * @param key The key selecting the permutation. Defaults to a random key.
+     */
+    explicit Permutation(std::uint64_t size, std::optional<std::uint64_t> key = std::nullopt);
+
+    /**
+     * @brief Returns the value at the given position of the permutation.
+     *
+     * @param index The position in range `[0, size)`.
+     *
+     * @throws std::out_of_range if the index is outside of the range.
+     *
+     * @return The value at the given position.
+     */
+    std::uint64_t at(std::uint64_t index) const;
+
+    /**
+     * @brief Returns the value at the current position and advances the position.
+     *
+     * @throws std::out_of_range if all values were already returned.
+     *
+     * @return The next value of the permutation.
+     */
+    std::uint64_t next();
+
+    /**
+     * @brief Returns the next value as a decimal string, zero padded to the given width.
+     *
+     * @param width The minimum number of digits.
+     *
+     * @throws std::out_of_range if all values were already returned.
+     *
+     * @return The next value of the permutation as a string.
+     *
+     * @code
+     * Permutation{1000}.nextNumeric(3) // "042"
+     * @endcode
+     */
+    std::string nextNumeric(unsigned width);
+
+    /**
+     * @brief Returns the element of the data at the next position of the permutation.
+     *
+     * @tparam T An element type of the container.
+     *
+     * @param data The container, its size must be equal to the size of the permutation.
+     *
+     * @throws std::invalid_argument if the container size differs from the permutation size.
+     * @throws std::out_of_range if all elements were already returned.
+     *
+     * @return The next element, so that every element is returned exactly once.
+     */
+    template <class T>
+    const T& nextElement(std::span<const T> data)
+    {
+        if (data.size() != rangeSize)
+        {
+            throw std::invalid_argument("Data size must be equal to permutation size.");
+        }
+
+        return data[static_cast<std::size_t>(next())];
+    }
+
+    /**
+     * @brief Moves the current position, e.g. to the beginning of a shard.
+     *
+     * @param index The new position in range `[0, size]`.
+     *
+     * @throws std::out_of_range if the index is greater than the size.
+     */
+    void seek(std::uint64_t index);
+
+    bool hasNext() const;
+
+    std::uint64_t position() const;
+
+    std::uint64_t size() const;
+
+private:
+    static constexpr unsigned numberOfRounds = 6;
+
+    std::uint64_t encrypt(std::uint64_t value) const;
+
+    std::uint64_t rangeSize;
+    unsigned halfBits;
+    std::uint64_t halfMask;
+    std::array<std::uint64_t, numberOfRounds> roundKeys;
+    std::uint64_t currentPosition;
+};
+}
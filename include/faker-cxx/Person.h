@@ -2,7 +2,9 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 
+#include "Dictionary.h"
 #include "types/Sex.h"
 
 namespace faker
@@ -25,6 +27,35 @@ public:
      */
     static std::string firstName(std::optional<Sex> = std::nullopt);
 
+    /**
+     * @brief Returns a random first name as a view of static storage.
+     *
+     * @param sex The optional sex to use.
+     *
+     * @returns First name starting with a capital letter.
+     *
+     * @code
+     * Person::firstNameView() // "Michael"
+     * Person::firstNameView(Sex::Female) // "Emma"
+     * Person::firstNameView(Sex::Male) // "Arthur"
+     * @endcode
+     */
+    static std::string_view firstNameView(std::optional<Sex> = std::nullopt);
+
+    /**
+     * @brief Returns the dataset `firstName()` picks its values from.
+     *
+     * @param sex The optional sex to use.
+     *
+     * @returns Dictionary of all values `firstName()` can return.
+     *
+     * @code
+     * const auto dictionary = Person::firstNameDictionary();
+     * dictionary[dictionary.randomIndex()] // "Michael"
+     * @endcode
+     */
+    static Dictionary firstNameDictionary(std::optional<Sex> = std::nullopt);
+
     /**
      * @brief Returns a random last name.
      *
@@ -36,6 +67,29 @@ public:
      */
     static std::string lastName();
 
+    /**
+     * @brief Returns a random last name as a view of static storage.
+     *
+     * @returns Last name starting with a capital letter.
+     *
+     * @code
+     * Person::lastNameView() // "Peterson"
+     * @endcode
+     */
+    static std::string_view lastNameView();
+
+    /**
+     * @brief Returns the dataset `lastName()` picks its values from.
+     *
+     * @returns Dictionary of all values `lastName()` can return.
+     *
+     * @code
+     * const auto dictionary = Person::lastNameDictionary();
+     * dictionary[dictionary.randomIndex()] // "Peterson"
+     * @endcode
+     */
+    static Dictionary lastNameDictionary();
+
     /**
      * @brief Returns a random full name.
      *
@@ -75,6 +129,29 @@ public:
      */
     static std::string sex();
 
+    /**
+     * @brief Returns a sex as a view of static storage.
+     *
+     * @returns Sex.
+     *
+     * @code
+     * Person::sexView() // "Male"
+     * @endcode
+     */
+    static std::string_view sexView();
+
+    /**
+     * @brief Returns the dataset `sex()` picks its values from.
+     *
+     * @returns Dictionary of all values `sex()` can return.
+     *
+     * @code
+     * const auto dictionary = Person::sexDictionary();
+     * dictionary[dictionary.randomIndex()] // "Male"
+     * @endcode
+     */
+    static Dictionary sexDictionary();
+
     /**
      * @brief Returns a random gender.
      *
@@ -86,6 +163,29 @@ public:
      */
     static std::string gender();
 
+    /**
+     * @brief Returns a random gender as a view of static storage.
+     *
+     * @returns Gender.
+     *
+     * @code
+     * Person::genderView() // "Transexual woman"
+     * @endcode
+     */
+    static std::string_view genderView();
+
+    /**
+     * @brief Returns the dataset `gender()` picks its values from.
+     *
+     * @returns Dictionary of all values `gender()` can return.
+     *
+     * @code
+     * const auto dictionary = Person::genderDictionary();
+     * dictionary[dictionary.randomIndex()] // "Transexual woman"
+     * @endcode
+     */
+    static Dictionary genderDictionary();
+
     /**
      * @brief Returns a random job title.
      *
@@ -108,6 +208,29 @@ public:
      */
     static std::string jobDescriptor();
 
+    /**
+     * @brief Returns a random job descriptor as a view of static storage.
+     *
+     * @returns Job descriptor.
+     *
+     * @code
+     * Person::jobDescriptorView() // "Senior"
+     * @endcode
+     */
+    static std::string_view jobDescriptorView();
+
+    /**
+     * @brief Returns the dataset `jobDescriptor()` picks its values from.
+     *
+     * @returns Dictionary of all values `jobDescriptor()` can return.
+     *
+     * @code
+     * const auto dictionary = Person::jobDescriptorDictionary();
+     * dictionary[dictionary.randomIndex()] // "Senior"
+     * @endcode
+     */
+    static Dictionary jobDescriptorDictionary();
+
     /**
      * @brief Returns a random job area.
      *
@@ -119,6 +242,29 @@ public:
      */
     static std::string jobArea();
 
+    /**
+     * @brief Returns a random job area as a view of static storage.
+     *
+     * @returns Job area.
+     *
+     * @code
+     * Person::jobAreaView() // "Software"
+     * @endcode
+     */
+    static std::string_view jobAreaView();
+
+    /**
+     * @brief Returns the dataset `jobArea()` picks its values from.
+     *
+     * @returns Dictionary of all values `jobArea()` can return.
+     *
+     * @code
+     * const auto dictionary = Person::jobAreaDictionary();
+     * dictionary[dictionary.randomIndex()] // "Software"
+     * @endcode
+     */
+    static Dictionary jobAreaDictionary();
+
     /**
      * @brief Returns a random job type.
      *
@@ -129,5 +275,28 @@ public:
      * @endcode
      */
     static std::string jobType();
+
+    /**
+     * @brief Returns a random job type as a view of static storage.
+     *
+     * @returns Job type.
+     *
+     * @code
+     * Person::jobTypeView() // "Engineer"
+     * @endcode
+     */
+    static std::string_view jobTypeView();
+
+    /**
+     * @brief Returns the dataset `jobType()` picks its values from.
+     *
+     * @returns Dictionary of all values `jobType()` can return.
+     *
+     * @code
+     * const auto dictionary = Person::jobTypeDictionary();
+     * dictionary[dictionary.randomIndex()] // "Engineer"
+     * @endcode
+     */
+    static Dictionary jobTypeDictionary();
 };
 }
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <map>
+#include <cstdint>
 #include <optional>
 #include <string>
 
@@ -39,6 +39,23 @@ public:
       */
      static std::string number(PhoneNumberCountryFormat format);
 
+     /**
+     * @brief Returns a random phone number based on country phone number template, as an E.164 number.
+     *
+     * The number holds the country code followed by the national number, without the leading plus sign.
+     *
+     * @param format Enum country format, more details in PhoneNumberCountryFormat.h.
+     *
+     * @throws std::invalid_argument if the format has no country code, as `PhoneNumberCountryFormat::Default`.
+     *
+     * @returns Random E.164 phone number based on country phone number template.
+     *
+     * @code
+     * Phone::numberE164(PhoneNumberCountryFormat::Usa) // 13957141494
+     * @endcode
+      */
+     static std::uint64_t numberE164(PhoneNumberCountryFormat format);
+
      /**
      * @brief Returns IMEI number.
      *
@@ -49,9 +66,5 @@ public:
      * @endcode
       */
       static std::string imei();
-
-  private:
-      static std::map<PhoneNumberCountryFormat, std::string> createPhoneNumberFormatMap();
-      static std::map<PhoneNumberCountryFormat, std::string> phoneNumberFormatMap;
 };
 }
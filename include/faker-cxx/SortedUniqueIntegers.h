@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace faker
+{
+/**
+ * @brief Generates a random sample of distinct integers of a range in ascending order.
+ *
+ * Every subset of the given size is equally likely. Values are drawn by sequential sampling (Vitter's method D), which
+ * skips a random number of values of the range before each sampled value, so the sample takes O(count) time and
+ * O(1) memory regardless of the size of the range.
+ *
+ * @code
+ * SortedUniqueIntegers keys{0, 1000000000, 5};
+ * keys.next() // 93417512
+ * keys.next() // 276010243
+ * @endcode
+ */
+class SortedUniqueIntegers
+{
+public:
+    /**
+     * @param min The lower bound of the range, included.
+     * @param max The upper bound of the range, excluded.
+     * @param count The number of values.
+     *
+     * @throws std::invalid_argument if the range is smaller than the count.
+     */
+    SortedUniqueIntegers(std::uint64_t min, std::uint64_t max, std::uint64_t count);
+
+    bool hasNext() const;
+
+    /**
+     * @brief Returns the next value, greater than all values returned before.
+     *
+     * @throws std::out_of_range if all values were already returned.
+     *
+     * @return The next value.
+     */
+    std::uint64_t next();
+
+    /**
+     * @brief Writes the next values into the given chunk.
+     *
+     * @param chunk Receives the values.
+     *
+     * @return The number of values written, smaller than the chunk size only at the end of the sample.
+     */
+    std::size_t nextChunk(std::span<std::uint64_t> chunk);
+
+    std::uint64_t remaining() const;
+
+private:
+    std::uint64_t skip() const;
+
+    std::uint64_t skipBySequentialSearch() const;
+
+    std::uint64_t skipByRejection() const;
+
+    std::uint64_t nextCandidate;
+    std::uint64_t remainingCount;
+    std::uint64_t remainingRange;
+};
+
+enum class KeyEncoding
+{
+    // Digits `0-9`.
+    Decimal,
+    // Digits `0-9a-f`.
+    Hex,
+    // Digits `0-9A-Za-z`, in ASCII order so that keys sort the same as their values.
+    Base62
+};
+
+/**
+ * @brief Generates unique fixed-width keys in ascending order, e.g. for bulk loading sorted tables.
+ *
+ * Keys encode the values of SortedUniqueIntegers, zero padded to the same width, so that their lexicographic order is
+ * the order of the values.
+ *
+ * @code
+ * SortedKeys keys{0, 1000000, 3, KeyEncoding::Hex};
+ * keys.next() // "0174c"
+ * keys.next() // "5b8d0"
+ * @endcode
+ */
+class SortedKeys
+{
+public:
+    /**
+     * @param min The lower bound of the range of values, included.
+     * @param max The upper bound of the range of values, excluded.
+     * @param count The number of keys.
+     * @param encoding The digits of keys. Defaults to `KeyEncoding::Decimal`.
+     * @param width The number of digits of keys, if none is provided the width of the largest value of the range.
+     *
+     * @throws std::invalid_argument if the range is smaller than the count or its values do not fit into the width.
+     */
+    SortedKeys(std::uint64_t min, std::uint64_t max, std::uint64_t count, KeyEncoding encoding = KeyEncoding::Decimal,
+               std::optional<unsigned> width = std::nullopt);
+
+    bool hasNext() const;
+
+    /**
+     * @brief Returns the next key.
+     *
+     * @throws std::out_of_range if all keys were already returned.
+     *
+     * @return The next key.
+     */
+    std::string next();
+
+    /**
+     * @brief Writes the next keys one after another into the given buffer, without separators.
+     *
+     * @param keys Receives the keys, as many as fit whole into the buffer.
+     *
+     * @return The number of keys written.
+     */
+    std::size_t nextChunk(std::span<char> keys);
+
+    unsigned width() const;
+
+private:
+    void encode(std::uint64_t value, char* key) const;
+
+    SortedUniqueIntegers values;
+    unsigned base;
+    unsigned keyWidth;
+};
+}
@@ -5,9 +5,11 @@
 #include <random>
 #include <set>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
+#include "Dictionary.h"
 #include "../src/common/StringHelper.h"
 #include "types/commonInterface.h"
 #include "types/cronDayOfWeek.h"
@@ -100,6 +102,29 @@ public:
       */
       static std::string mimeType();
 
+    /**
+     * Returns a mime-type as a view of static storage.
+     *
+     * @returns A mime-type.
+     *
+     * @example
+     * System::mimeTypeView() // "video/vnd.vivo"
+     *
+     */
+    static std::string_view mimeTypeView();
+
+    /**
+     * @brief Returns the dataset `mimeType()` picks its values from.
+     *
+     * @returns Dictionary of all values `mimeType()` can return.
+     *
+     * @code
+     * const auto dictionary = System::mimeTypeDictionary();
+     * dictionary[dictionary.randomIndex()] // "video/vnd.vivo"
+     * @endcode
+     */
+    static Dictionary mimeTypeDictionary();
+
       /**
       * Returns a commonly used file type.
       *
@@ -111,6 +136,29 @@ public:
       */
        static std::string commonFileType();
 
+    /**
+     * Returns a commonly used file type as a view of static storage.
+     *
+     * @returns A commonly used file type.
+     *
+     * @example
+     * System::commonFileTypeView() // "audio"
+     *
+     */
+    static std::string_view commonFileTypeView();
+
+    /**
+     * @brief Returns the dataset `commonFileType()` picks its values from.
+     *
+     * @returns Dictionary of all values `commonFileType()` can return.
+     *
+     * @code
+     * const auto dictionary = System::commonFileTypeDictionary();
+     * dictionary[dictionary.randomIndex()] // "audio"
+     * @endcode
+     */
+    static Dictionary commonFileTypeDictionary();
+
        /**
       * Returns a commonly used file type.
       *
@@ -122,6 +170,29 @@ public:
       */
        static std::string fileType();
 
+    /**
+     * Returns a file type as a view of static storage.
+     *
+     * @returns A file type.
+     *
+     * @example
+     * System::fileTypeView() // "image"
+     *
+     */
+    static std::string_view fileTypeView();
+
+    /**
+     * @brief Returns the dataset `fileType()` picks its values from.
+     *
+     * @returns Dictionary of all values `fileType()` can return.
+     *
+     * @code
+     * const auto dictionary = System::fileTypeDictionary();
+     * dictionary[dictionary.randomIndex()] // "image"
+     * @endcode
+     */
+    static Dictionary fileTypeDictionary();
+
        /**
       * Returns a directory path.
       *
@@ -133,6 +204,29 @@ public:
       */
        static std::string directoryPath();
 
+    /**
+     * Returns a directory path as a view of static storage.
+     *
+     * @returns A directory path.
+     *
+     * @example
+     * System::directoryPathView() // "/etc/mail"
+     *
+     */
+    static std::string_view directoryPathView();
+
+    /**
+     * @brief Returns the dataset `directoryPath()` picks its values from.
+     *
+     * @returns Dictionary of all values `directoryPath()` can return.
+     *
+     * @code
+     * const auto dictionary = System::directoryPathDictionary();
+     * dictionary[dictionary.randomIndex()] // "/etc/mail"
+     * @endcode
+     */
+    static Dictionary directoryPathDictionary();
+
        /**
       * Returns a file path.
       *
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <queue>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace faker
+{
+enum class TimestampSpacing
+{
+    // Exactly `count` timestamps distributed like a sorted sample of uniformly random timestamps.
+    Uniform,
+    // Timestamps of a Poisson process, spaced by exponentially distributed gaps, `count` of them on average.
+    Poisson
+};
+
+enum class LatenessDistribution
+{
+    // Uniformly distributed in `[0, max]`.
+    Uniform,
+    // Exponentially distributed with a mean of a quarter of `max`, truncated at `max`.
+    Exponential
+};
+
+struct TimestampLateness {
+    // Greatest delay of a timestamp, no timestamp is emitted after one later than it by more than this.
+    std::chrono::nanoseconds max;
+    LatenessDistribution distribution = LatenessDistribution::Uniform;
+    // Probability that a timestamp is delayed at all.
+    double probability = 1.0;
+};
+
+/**
+ * @brief Generates timestamps of a time window in ascending order, without generating and sorting them upfront.
+ *
+ * Every timestamp takes O(1) time and no timestamps are stored. With lateness, every timestamp is delayed by a random
+ * amount and timestamps are emitted in order of their delayed times, so the sequence is out of order by at most the
+ * maximum lateness, which is useful for testing watermarks of stream processors.
+ *
+ * @code
+ * const auto from = std::chrono::sys_days{std::chrono::year{2024} / 1 / 1};
+ *
+ * TimestampSequence events{from, from + std::chrono::hours{24}, 1000000000};
+ *
+ * std::array<TimestampSequence::TimePoint, 4096> chunk;
+ *
+ * while (const auto size = events.nextChunk(chunk))
+ * {
+ *     write(std::span{chunk}.first(size));
+ * }
+ *
+ * TimestampSequence lateEvents{from, from + std::chrono::hours{1}, 1000, TimestampSpacing::Poisson,
+ *                              TimestampLateness{std::chrono::seconds{5}, LatenessDistribution::Exponential, 0.1}};
+ * @endcode
+ */
+class TimestampSequence
+{
+public:
+    using TimePoint = std::chrono::sys_time<std::chrono::nanoseconds>;
+
+    /**
+     * @param from The start of the time window, included.
+     * @param to The end of the time window, excluded.
+     * @param count The number of timestamps, or their expected number for `TimestampSpacing::Poisson`.
+     * @param spacing The distribution of gaps between timestamps. Defaults to `TimestampSpacing::Uniform`.
+     * @param lateness The delays of timestamps, if none is provided timestamps are emitted in ascending order.
+     *
+     * @throws std::invalid_argument if the window is empty or lateness is negative or its probability is outside of
+     * range `[0, 1]`.
+     */
+    TimestampSequence(TimePoint from, TimePoint to, std::uint64_t count,
+                      TimestampSpacing spacing = TimestampSpacing::Uniform,
+                      std::optional<TimestampLateness> lateness = std::nullopt);
+
+    bool hasNext() const;
+
+    /**
+     * @brief Returns the next timestamp of the sequence.
+     *
+     * @throws std::out_of_range if all timestamps were already returned.
+     *
+     * @return The next timestamp.
+     */
+    TimePoint next();
+
+    /**
+     * @brief Writes the next timestamps of the sequence into the given chunk.
+     *
+     * @param chunk Receives the timestamps.
+     *
+     * @return The number of timestamps written, smaller than the chunk size only at the end of the sequence.
+     */
+    std::size_t nextChunk(std::span<TimePoint> chunk);
+
+private:
+    // Pairs of delayed and original timestamp, ordered by the delayed one.
+    using DelayedTimestamp = std::pair<TimePoint, TimePoint>;
+
+    std::optional<TimePoint> generateTimestamp();
+
+    std::chrono::nanoseconds generateLateness() const;
+
+    TimePoint from;
+    double windowNanoseconds;
+    std::uint64_t count;
+    TimestampSpacing spacing;
+    std::optional<TimestampLateness> lateness;
+    std::uint64_t generatedCount;
+    // Position of the last generated timestamp in the window, as a fraction for uniform spacing or in nanoseconds.
+    double position;
+    std::optional<TimePoint> upcomingTimestamp;
+    std::priority_queue<DelayedTimestamp, std::vector<DelayedTimestamp>, std::greater<>> delayedTimestamps;
+};
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "GeoPointGenerator.h"
+
+namespace faker
+{
+enum class TrajectoryModel
+{
+    // Objects wander with a randomly drifting heading.
+    RandomWalk,
+    // Objects head straight to random waypoints in the area, picking a new waypoint when they reach one and travelling
+    // the rest of the step towards it.
+    Waypoint
+};
+
+struct TrajectoryMotion {
+    TrajectoryModel model = TrajectoryModel::RandomWalk;
+    // Speed of objects varies around the mean with the given standard deviation, drifting back to the mean within
+    // about a minute.
+    double meanSpeedKmh = 50.0;
+    double speedDeviationKmh = 10.0;
+    // Standard deviation of the change of heading of a random walk over one second.
+    double headingDeviationDegrees = 5.0;
+};
+
+struct TrajectoryPing {
+    std::uint32_t objectId;
+    std::chrono::sys_time<std::chrono::nanoseconds> timestamp;
+    double latitude;
+    double longitude;
+};
+
+/**
+ * @brief Generates an endless stream of position pings of moving objects, in order of timestamps across all objects.
+ *
+ * Every object pings once per interval, at its own random offset within the interval. Once per interval the positions
+ * of all objects are advanced together, with the state of objects kept in separate arrays per field, and the pings of
+ * the interval are emitted in order of the offsets, so every ping takes O(1) time.
+ *
+ * @code
+ * const auto city = GeoPointGenerator::boundingBox({52.1, 52.4, 20.8, 21.3});
+ * const auto from = std::chrono::sys_days{std::chrono::year{2024} / 1 / 1};
+ *
+ * TrajectoryStream fleet{city, 10000, from, std::chrono::seconds{5}, {TrajectoryModel::Waypoint}};
+ *
+ * std::array<TrajectoryPing, 4096> chunk;
+ *
+ * fleet.nextChunk(chunk);
+ * @endcode
+ */
+class TrajectoryStream
+{
+public:
+    using TimePoint = std::chrono::sys_time<std::chrono::nanoseconds>;
+
+    /**
+     * @param area The area of start positions and waypoints, random walks may leave it.
+     * @param objectCount The number of objects.
+     * @param from The start of the stream, the first ping of every object is within one interval from it.
+     * @param pingInterval The time between consecutive pings of an object.
+     * @param motion The movement of objects.
+     *
+     * @throws std::invalid_argument if there are no objects, the interval is not positive or a speed or deviation is
+     * negative.
+     */
+    TrajectoryStream(const GeoPointGenerator& area, std::uint32_t objectCount, TimePoint from,
+                     std::chrono::nanoseconds pingInterval, TrajectoryMotion motion = {});
+
+    /**
+     * @return The next ping, no earlier than the pings returned before.
+     */
+    TrajectoryPing next();
+
+    /**
+     * @brief Writes the next pings into the given chunk.
+     *
+     * @param chunk Receives the pings.
+     *
+     * @return The number of pings written, always the chunk size.
+     */
+    std::size_t nextChunk(std::span<TrajectoryPing> chunk);
+
+private:
+    struct Arrival {
+        std::uint32_t objectId;
+        double leftoverKm;
+    };
+
+    void step();
+    void move();
+
+    GeoPointGenerator area;
+    TimePoint from;
+    std::chrono::nanoseconds pingInterval;
+    TrajectoryMotion motion;
+
+    std::vector<double> latitudes;
+    std::vector<double> longitudes;
+    std::vector<double> headings;
+    std::vector<double> speeds;
+    std::vector<double> targetLatitudes;
+    std::vector<double> targetLongitudes;
+    std::vector<std::chrono::nanoseconds> offsets;
+    // Objects in order of their ping offsets.
+    std::vector<std::uint32_t> pingOrder;
+    // Normally distributed random numbers of one step.
+    std::vector<double> speedNoise;
+    std::vector<double> headingNoise;
+    // Changes of coordinates of one step, in degrees.
+    std::vector<double> latitudeSteps;
+    std::vector<double> longitudeSteps;
+    // Objects reaching their waypoint in one step, with the distance left to travel.
+    std::vector<Arrival> arrivals;
+
+    std::uint64_t interval;
+    std::size_t position;
+};
+}
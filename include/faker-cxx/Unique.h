@@ -0,0 +1,157 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "../../src/common/BloomFilter.h"
+#include "../../src/common/Fingerprint.h"
+#include "../../src/common/FingerprintSet.h"
+#include "types/UniqueOptions.h"
+
+namespace faker
+{
+struct UniqueStatistics {
+    std::uint64_t generatedValues = 0;
+    std::uint64_t uniqueValues = 0;
+    std::uint64_t rejectedValues = 0;
+    std::uint64_t exhaustedCalls = 0;
+    std::size_t memoryBytes = 0;
+};
+
+/**
+ * @brief Wraps a generator so that it never returns the same value twice.
+ *
+ * Only 64-bit fingerprints of returned values are remembered, never the values themselves.
+ * - UniqueMode::Exact keeps the fingerprints in an open-addressing hash set (8 bytes per slot, at most 3/4 full).
+ * A value is falsely rejected only on a 64-bit fingerprint collision. Optional `maxMemoryBytes` caps the set size.
+ * - UniqueMode::Approximate keeps a blocked Bloom filter sized up front for `expectedCount` values at
+ * `falsePositiveRate`, so the memory stays fixed. Some unique values are rejected as false positives.
+ *
+ * @tparam Generator The type of the wrapped generator.
+ *
+ * @code
+ * Unique uniqueEmail{[]() { return Internet::email(); }};
+ * uniqueEmail() // "Sergio_Greenfelder@hotmail.com"
+ *
+ * Unique uniquePhone{[]() { return Phone::number(); }, {.mode = UniqueMode::Approximate, .expectedCount = 1000000}};
+ * uniquePhone() // "+1 (555) 123-4567"
+ * @endcode
+ */
+template <typename Generator>
+class Unique
+{
+public:
+    using Value = std::invoke_result_t<Generator&>;
+
+    /**
+     * @param generator The generator to wrap.
+     * @param options The deduplication options.
+     *
+     * @throws std::invalid_argument if approximate options are invalid.
+     * @throws std::runtime_error if the initial exact set does not fit in `maxMemoryBytes`.
+     */
+    explicit Unique(Generator generatorInit, UniqueOptions optionsInit = {})
+        : generator{std::move(generatorInit)}, options{optionsInit}, seenValues{createSeenValues(optionsInit)}
+    {
+    }
+
+    /**
+     * @brief Returns a value that was not returned before.
+     *
+     * @throws std::runtime_error if no unique value was generated within `maxRetries` retries.
+     *
+     * @return The unique value.
+     */
+    Value operator()()
+    {
+        for (unsigned attempt = 0; attempt <= options.maxRetries; attempt++)
+        {
+            auto value = std::invoke(generator);
+
+            statistics.generatedValues++;
+
+            if (insert(fingerprintOf(value)))
+            {
+                statistics.uniqueValues++;
+
+                return value;
+            }
+
+            statistics.rejectedValues++;
+        }
+
+        statistics.exhaustedCalls++;
+
+        throw std::runtime_error("Could not generate a unique value within the retry limit.");
+    }
+
+    /**
+     * @brief Returns counters of generated, unique and rejected values, and the memory used for deduplication.
+     */
+    UniqueStatistics getStatistics() const
+    {
+        auto currentStatistics = statistics;
+
+        currentStatistics.memoryBytes =
+            std::visit([](const auto& seenValuesStorage) { return seenValuesStorage.memoryBytes(); }, seenValues);
+
+        return currentStatistics;
+    }
+
+    /**
+     * @brief Forgets all returned values and resets the statistics.
+     */
+    void clear()
+    {
+        std::visit([](auto& seenValuesStorage) { seenValuesStorage.clear(); }, seenValues);
+
+        statistics = {};
+    }
+
+private:
+    using SeenValues = std::variant<FingerprintSet, BloomFilter>;
+
+    static SeenValues createSeenValues(const UniqueOptions& options)
+    {
+        if (options.mode == UniqueMode::Approximate)
+        {
+            return BloomFilter{options.expectedCount, options.falsePositiveRate};
+        }
+
+        return FingerprintSet{options.expectedCount, options.maxMemoryBytes};
+    }
+
+    static std::uint64_t fingerprintOf(const Value& value)
+    {
+        if constexpr (std::is_convertible_v<const Value&, std::string_view>)
+        {
+            return Fingerprint::of(std::string_view{value});
+        }
+        else if constexpr (std::integral<Value>)
+        {
+            return Fingerprint::of(static_cast<std::uint64_t>(value));
+        }
+        else
+        {
+            return Fingerprint::of(static_cast<std::uint64_t>(std::hash<Value>{}(value)));
+        }
+    }
+
+    bool insert(std::uint64_t fingerprint)
+    {
+        return std::visit([fingerprint](auto& seenValuesStorage) { return seenValuesStorage.insert(fingerprint); },
+                          seenValues);
+    }
+
+    Generator generator;
+    UniqueOptions options;
+    SeenValues seenValues;
+    UniqueStatistics statistics;
+};
+}
@@ -2,6 +2,9 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
+
+#include "Dictionary.h"
 
 namespace faker
 {
@@ -23,6 +26,50 @@ public:
      */
     static std::string sample(std::optional<unsigned> length = std::nullopt);
 
+    /**
+     * @brief Returns a random word as a view of static storage.
+     *
+     * @param length The expected length of the word.
+     * If no word with given length will be found, it will return a random word.
+     *
+     * @returns Random sample word.
+     *
+     * @code
+     * Word::sampleView() // "protection"
+     * Word::sampleView(5) // "spell"
+     * @endcode
+     */
+    static std::string_view sampleView(std::optional<unsigned> length = std::nullopt);
+
+    /**
+     * @brief Returns the dataset `sample()` picks its values from.
+     *
+     * @returns Dictionary of all values `sample()` can return.
+     *
+     * @code
+     * const auto dictionary = Word::sampleDictionary();
+     * dictionary[dictionary.randomIndex()] // "protection"
+     * @endcode
+     */
+    static Dictionary sampleDictionary();
+
+    /**
+     * @brief Returns a random word with length in the given range.
+     *
+     * @param minLength The minimum length of the word.
+     * @param maxLength The maximum length of the word.
+     * If no word with length in given range will be found, it will return a random word.
+     *
+     * @throws std::invalid_argument if minLength is greater than maxLength.
+     *
+     * @returns Random sample word.
+     *
+     * @code
+     * Word::sample(5, 7) // "spell"
+     * @endcode
+     */
+    static std::string sample(unsigned minLength, unsigned maxLength);
+
     /**
      * @brief Returns a string containing a number of space separated random words.
      *
@@ -52,6 +99,50 @@ public:
      */
     static std::string adjective(std::optional<unsigned> length = std::nullopt);
 
+    /**
+     * @brief Returns a random adjective as a view of static storage.
+     *
+     * @param length The expected length of the word.
+     * If no word with given length will be found, it will return a random word.
+     *
+     * @returns Adjective.
+     *
+     * @code
+     * Word::adjectiveView() // "complete"
+     * Word::adjectiveView(3) // "bad"
+     * @endcode
+     */
+    static std::string_view adjectiveView(std::optional<unsigned> length = std::nullopt);
+
+    /**
+     * @brief Returns the dataset `adjective()` picks its values from.
+     *
+     * @returns Dictionary of all values `adjective()` can return.
+     *
+     * @code
+     * const auto dictionary = Word::adjectiveDictionary();
+     * dictionary[dictionary.randomIndex()] // "complete"
+     * @endcode
+     */
+    static Dictionary adjectiveDictionary();
+
+    /**
+     * @brief Returns a random adjective with length in the given range.
+     *
+     * @param minLength The minimum length of the word.
+     * @param maxLength The maximum length of the word.
+     * If no word with length in given range will be found, it will return a random word.
+     *
+     * @throws std::invalid_argument if minLength is greater than maxLength.
+     *
+     * @returns Adjective.
+     *
+     * @code
+     * Word::adjective(3, 4) // "bad"
+     * @endcode
+     */
+    static std::string adjective(unsigned minLength, unsigned maxLength);
+
     /**
      * @brief Returns a random adverb.
      *
@@ -67,6 +158,50 @@ public:
      */
     static std::string adverb(std::optional<unsigned> length = std::nullopt);
 
+    /**
+     * @brief Returns a random adverb as a view of static storage.
+     *
+     * @param length The expected length of the word.
+     * If no word with given length will be found, it will return a random word.
+     *
+     * @returns Adverb.
+     *
+     * @code
+     * Word::adverbView() // "deliberately"
+     * Word::adverbView(5) // "almost"
+     * @endcode
+     */
+    static std::string_view adverbView(std::optional<unsigned> length = std::nullopt);
+
+    /**
+     * @brief Returns the dataset `adverb()` picks its values from.
+     *
+     * @returns Dictionary of all values `adverb()` can return.
+     *
+     * @code
+     * const auto dictionary = Word::adverbDictionary();
+     * dictionary[dictionary.randomIndex()] // "deliberately"
+     * @endcode
+     */
+    static Dictionary adverbDictionary();
+
+    /**
+     * @brief Returns a random adverb with length in the given range.
+     *
+     * @param minLength The minimum length of the word.
+     * @param maxLength The maximum length of the word.
+     * If no word with length in given range will be found, it will return a random word.
+     *
+     * @throws std::invalid_argument if minLength is greater than maxLength.
+     *
+     * @returns Adverb.
+     *
+     * @code
+     * Word::adverb(5, 6) // "almost"
+     * @endcode
+     */
+    static std::string adverb(unsigned minLength, unsigned maxLength);
+
     /**
      * @brief Returns a random conjunction.
      *
@@ -82,6 +217,50 @@ public:
      */
     static std::string conjunction(std::optional<unsigned> length = std::nullopt);
 
+    /**
+     * @brief Returns a random conjunction as a view of static storage.
+     *
+     * @param length The expected length of the word.
+     * If no word with given length will be found, it will return a random word.
+     *
+     * @returns Conjunction.
+     *
+     * @code
+     * Word::conjunctionView() // "because"
+     * Word::conjunctionView(6) // "indeed"
+     * @endcode
+     */
+    static std::string_view conjunctionView(std::optional<unsigned> length = std::nullopt);
+
+    /**
+     * @brief Returns the dataset `conjunction()` picks its values from.
+     *
+     * @returns Dictionary of all values `conjunction()` can return.
+     *
+     * @code
+     * const auto dictionary = Word::conjunctionDictionary();
+     * dictionary[dictionary.randomIndex()] // "because"
+     * @endcode
+     */
+    static Dictionary conjunctionDictionary();
+
+    /**
+     * @brief Returns a random conjunction with length in the given range.
+     *
+     * @param minLength The minimum length of the word.
+     * @param maxLength The maximum length of the word.
+     * If no word with length in given range will be found, it will return a random word.
+     *
+     * @throws std::invalid_argument if minLength is greater than maxLength.
+     *
+     * @returns Conjunction.
+     *
+     * @code
+     * Word::conjunction(6, 7) // "indeed"
+     * @endcode
+     */
+    static std::string conjunction(unsigned minLength, unsigned maxLength);
+
     /**
      * @brief Returns a random interjection.
      *
@@ -97,6 +276,50 @@ public:
      */
     static std::string interjection(std::optional<unsigned> length = std::nullopt);
 
+    /**
+     * @brief Returns a random interjection as a view of static storage.
+     *
+     * @param length The expected length of the word.
+     * If no word with given length will be found, it will return a random word.
+     *
+     * @returns Interjection.
+     *
+     * @code
+     * Word::interjectionView() // "psst"
+     * Word::interjectionView(4) // "yuck"
+     * @endcode
+     */
+    static std::string_view interjectionView(std::optional<unsigned> length = std::nullopt);
+
+    /**
+     * @brief Returns the dataset `interjection()` picks its values from.
+     *
+     * @returns Dictionary of all values `interjection()` can return.
+     *
+     * @code
+     * const auto dictionary = Word::interjectionDictionary();
+     * dictionary[dictionary.randomIndex()] // "psst"
+     * @endcode
+     */
+    static Dictionary interjectionDictionary();
+
+    /**
+     * @brief Returns a random interjection with length in the given range.
+     *
+     * @param minLength The minimum length of the word.
+     * @param maxLength The maximum length of the word.
+     * If no word with length in given range will be found, it will return a random word.
+     *
+     * @throws std::invalid_argument if minLength is greater than maxLength.
+     *
+     * @returns Interjection.
+     *
+     * @code
+     * Word::interjection(4, 5) // "yuck"
+     * @endcode
+     */
+    static std::string interjection(unsigned minLength, unsigned maxLength);
+
     /**
      * @brief Returns a random noun.
      *
@@ -112,6 +335,50 @@ public:
      */
     static std::string noun(std::optional<unsigned> length = std::nullopt);
 
+    /**
+     * @brief Returns a random noun as a view of static storage.
+     *
+     * @param length The expected length of the word.
+     * If no word with given length will be found, it will return a random word.
+     *
+     * @returns Noun.
+     *
+     * @code
+     * Word::nounView() // "pudding"
+     * Word::nounView(8) // "distance"
+     * @endcode
+     */
+    static std::string_view nounView(std::optional<unsigned> length = std::nullopt);
+
+    /**
+     * @brief Returns the dataset `noun()` picks its values from.
+     *
+     * @returns Dictionary of all values `noun()` can return.
+     *
+     * @code
+     * const auto dictionary = Word::nounDictionary();
+     * dictionary[dictionary.randomIndex()] // "pudding"
+     * @endcode
+     */
+    static Dictionary nounDictionary();
+
+    /**
+     * @brief Returns a random noun with length in the given range.
+     *
+     * @param minLength The minimum length of the word.
+     * @param maxLength The maximum length of the word.
+     * If no word with length in given range will be found, it will return a random word.
+     *
+     * @throws std::invalid_argument if minLength is greater than maxLength.
+     *
+     * @returns Noun.
+     *
+     * @code
+     * Word::noun(8, 10) // "distance"
+     * @endcode
+     */
+    static std::string noun(unsigned minLength, unsigned maxLength);
+
     /**
      * @brief Returns a random preposition.
      *
@@ -127,6 +394,50 @@ public:
      */
     static std::string preposition(std::optional<unsigned> length = std::nullopt);
 
+    /**
+     * @brief Returns a random preposition as a view of static storage.
+     *
+     * @param length The expected length of the word.
+     * If no word with given length will be found, it will return a random word.
+     *
+     * @returns Preposition.
+     *
+     * @code
+     * Word::prepositionView() // "besides"
+     * Word::prepositionView(4) // "from"
+     * @endcode
+     */
+    static std::string_view prepositionView(std::optional<unsigned> length = std::nullopt);
+
+    /**
+     * @brief Returns the dataset `preposition()` picks its values from.
+     *
+     * @returns Dictionary of all values `preposition()` can return.
+     *
+     * @code
+     * const auto dictionary = Word::prepositionDictionary();
+     * dictionary[dictionary.randomIndex()] // "besides"
+     * @endcode
+     */
+    static Dictionary prepositionDictionary();
+
+    /**
+     * @brief Returns a random preposition with length in the given range.
+     *
+     * @param minLength The minimum length of the word.
+     * @param maxLength The maximum length of the word.
+     * If no word with length in given range will be found, it will return a random word.
+     *
+     * @throws std::invalid_argument if minLength is greater than maxLength.
+     *
+     * @returns Preposition.
+     *
+     * @code
+     * Word::preposition(4, 5) // "from"
+     * @endcode
+     */
+    static std::string preposition(unsigned minLength, unsigned maxLength);
+
     /**
      * @brief Returns a random verb.
      *
@@ -141,5 +452,49 @@ public:
      * @endcode
      */
     static std::string verb(std::optional<unsigned> length = std::nullopt);
+
+    /**
+     * @brief Returns a random verb as a view of static storage.
+     *
+     * @param length The expected length of the word.
+     * If no word with given length will be found, it will return a random word.
+     *
+     * @returns Verb.
+     *
+     * @code
+     * Word::verbView() // "override"
+     * Word::verbView(9) // "stabilise"
+     * @endcode
+     */
+    static std::string_view verbView(std::optional<unsigned> length = std::nullopt);
+
+    /**
+     * @brief Returns the dataset `verb()` picks its values from.
+     *
+     * @returns Dictionary of all values `verb()` can return.
+     *
+     * @code
+     * const auto dictionary = Word::verbDictionary();
+     * dictionary[dictionary.randomIndex()] // "override"
+     * @endcode
+     */
+    static Dictionary verbDictionary();
+
+    /**
+     * @brief Returns a random verb with length in the given range.
+     *
+     * @param minLength The minimum length of the word.
+     * @param maxLength The maximum length of the word.
+     * If no word with length in given range will be found, it will return a random word.
+     *
+     * @throws std::invalid_argument if minLength is greater than maxLength.
+     *
+     * @returns Verb.
+     *
+     * @code
+     * Word::verb(9, 12) // "stabilise"
+     * @endcode
+     */
+    static std::string verb(unsigned minLength, unsigned maxLength);
 };
 }
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <vector>
+#include <array>
 
 namespace faker
 {
@@ -9,6 +9,6 @@ enum class BicCountry
     Poland,
 };
 
-const std::vector<BicCountry> supportedBicCountries{BicCountry::Poland};
+inline constexpr std::array supportedBicCountries{BicCountry::Poland};
 
 }
@@ -1,11 +1,11 @@
 #pragma once
 
-#include <vector>
-#include <string>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> directoryPaths = {
+inline constexpr auto directoryPaths = std::to_array<std::string_view>({
     "/etc/mail",
     "/var/log",
     "/usr/bin",
@@ -56,5 +56,5 @@ const std::vector<std::string> directoryPaths = {
     "/var/log/apache2",
     "/opt/files",
     "/home/user/backups"
-};
+});
 }
\ No newline at end of file
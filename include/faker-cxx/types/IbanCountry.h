@@ -1,6 +1,6 @@
 #pragma once
 
-#include <vector>
+#include <array>
 
 namespace faker
 {
@@ -12,7 +12,7 @@ enum class IbanCountry
     Italy
 };
 
-const std::vector<IbanCountry> supportedIbanCountries{IbanCountry::Poland, IbanCountry::France, IbanCountry::Germany,
-                                                      IbanCountry::Italy};
+inline constexpr std::array supportedIbanCountries{IbanCountry::Poland, IbanCountry::France, IbanCountry::Germany,
+                                           IbanCountry::Italy};
 
 }
@@ -1,11 +1,11 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> mimeTypes = {
+inline constexpr auto mimeTypes = std::to_array<std::string_view>({
     "application/atom+xml",
     "application/font-woff",
     "application/gzip",
@@ -70,9 +70,9 @@ const std::vector<std::string> mimeTypes = {
     "video/webm",
     "video/x-msvideo",
     "video/x-flv"
-};
+});
 
-const std::vector<std::string> commonMimeTypes = {
+inline constexpr auto commonMimeTypes = std::to_array<std::string_view>({
     "application/pdf",
     "audio/mpeg",
     "audio/wav",
@@ -82,8 +82,8 @@ const std::vector<std::string> commonMimeTypes = {
     "video/mp4",
     "video/mpeg",
     "text/html"
-};
+});
 
-const std::vector<std::string> commonFileTypes = {"video", "audio", "image", "text", "application"};
+inline constexpr auto commonFileTypes = std::to_array<std::string_view>({"video", "audio", "image", "text", "application"});
 
 }
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+
+namespace faker
+{
+enum class UniqueMode
+{
+    Exact,
+    Approximate
+};
+
+struct UniqueOptions {
+    UniqueMode mode = UniqueMode::Exact;
+    unsigned maxRetries = 50;
+    std::size_t expectedCount = 1024;
+    double falsePositiveRate = 0.001;
+    std::size_t maxMemoryBytes = 0;
+};
+}
@@ -1,12 +1,12 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 #include <unordered_map>
 
 namespace faker
 {
-const std::vector<std::string> commonInterfaceTypes = {"en", "wl", "ww"};
+inline constexpr auto commonInterfaceTypes = std::to_array<std::string_view>({"en", "wl", "ww"});
 const std::unordered_map<std::string, std::string> commonInterfaceSchemas = {
     {"index", "o"},
     {"slot", "s"},
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> cronDayOfWeek = {"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
+inline constexpr auto cronDayOfWeek = std::to_array<std::string_view>({"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"});
 }
\ No newline at end of file
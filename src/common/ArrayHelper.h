@@ -0,0 +1,35 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace faker
+{
+class ArrayHelper
+{
+public:
+    /**
+     * @brief Concatenates arrays into a single array, usable in constant expressions.
+     *
+     * @param arrays The arrays to concatenate, in order.
+     *
+     * @returns Array holding elements of all given arrays.
+     *
+     * @code
+     * constexpr auto merged = ArrayHelper::concat(std::array{1, 2}, std::array{3}); // {1, 2, 3}
+     * @endcode
+     */
+    template <typename T, std::size_t... Sizes>
+    static constexpr std::array<T, (Sizes + ...)> concat(const std::array<T, Sizes>&... arrays)
+    {
+        std::array<T, (Sizes + ...)> result{};
+
+        auto output = result.begin();
+
+        ((output = std::ranges::copy(arrays, output).out), ...);
+
+        return result;
+    }
+};
+}
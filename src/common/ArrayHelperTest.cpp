@@ -0,0 +1,31 @@
+#include "ArrayHelper.h"
+
+#include <string_view>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+class ArrayHelperTest : public Test
+{
+public:
+};
+
+TEST_F(ArrayHelperTest, shouldConcatArrays)
+{
+    constexpr auto merged = ArrayHelper::concat(std::to_array<std::string_view>({"a", "b"}),
+                                                std::to_array<std::string_view>({"c"}),
+                                                std::to_array<std::string_view>({"d", "e"}));
+
+    static_assert(merged.size() == 5);
+
+    ASSERT_EQ(merged, std::to_array<std::string_view>({"a", "b", "c", "d", "e"}));
+}
+
+TEST_F(ArrayHelperTest, shouldReturnSameArrayWhenConcatenatingSingleArray)
+{
+    constexpr std::array<unsigned, 3> data{1, 2, 3};
+
+    ASSERT_EQ(ArrayHelper::concat(data), data);
+}
@@ -0,0 +1,160 @@
+#include "BloomFilter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+#include "Fingerprint.h"
+
+namespace faker
+{
+namespace
+{
+constexpr std::size_t bitsPerWord = 64;
+constexpr std::size_t wordsPerBlock = 8;
+constexpr std::size_t bitsPerBlock = bitsPerWord * wordsPerBlock;
+constexpr unsigned bitIndexBits = 9;
+constexpr unsigned maxHashesPerElement = 16;
+
+static_assert(bitsPerBlock == std::size_t{1} << bitIndexBits);
+
+std::size_t blockIndexOf(std::uint64_t hash, std::size_t numberOfBlocks)
+{
+    return static_cast<std::size_t>(((hash >> 32) * numberOfBlocks) >> 32);
+}
+
+template <typename Visitor>
+void forEachBit(std::uint64_t hash, unsigned numberOfHashes, Visitor&& visitor)
+{
+    // Every bit takes its own 9 bits of a mixed hash, remixed when used up. Bits derived from two hashes, as in double
+    // hashing, would repeat the same few patterns within a block and keep the false positive rate from falling.
+    auto mixedHash = Fingerprint::of(hash);
+    auto unusedHash = mixedHash;
+    unsigned unusedBits = 64;
+
+    for (unsigned i = 0; i < numberOfHashes; i++)
+    {
+        if (unusedBits < bitIndexBits)
+        {
+            mixedHash = Fingerprint::of(mixedHash);
+            unusedHash = mixedHash;
+            unusedBits = 64;
+        }
+
+        const auto bitIndex = static_cast<std::size_t>(unusedHash % bitsPerBlock);
+
+        unusedHash >>= bitIndexBits;
+        unusedBits -= bitIndexBits;
+
+        visitor(bitIndex / bitsPerWord, std::uint64_t{1} << (bitIndex % bitsPerWord));
+    }
+}
+
+unsigned hashesFor(double bitsPerElement)
+{
+    return std::clamp(static_cast<unsigned>(std::lround(bitsPerElement * std::numbers::ln2)), 1u, maxHashesPerElement);
+}
+
+/**
+ * False positive rate of a blocked filter. The number of elements in a block is Poisson distributed, so crowded blocks
+ * raise the rate above the one of an unblocked filter of the same size.
+ */
+double blockedFalsePositiveRate(double bitsPerElement, unsigned numberOfHashes)
+{
+    const auto elementsPerBlock = static_cast<double>(bitsPerBlock) / bitsPerElement;
+    const auto spread = 10.0 * std::sqrt(elementsPerBlock) + 10.0;
+
+    const auto first = static_cast<unsigned>(std::max(0.0, elementsPerBlock - spread));
+    const auto last = static_cast<unsigned>(elementsPerBlock + spread);
+
+    double rate = 0.0;
+
+    for (auto elements = first; elements <= last; elements++)
+    {
+        const auto count = static_cast<double>(elements);
+        const auto probability = std::exp(count * std::log(elementsPerBlock) - elementsPerBlock - std::lgamma(count + 1));
+
+        const auto setBitShare =
+            1.0 - std::pow(1.0 - 1.0 / static_cast<double>(bitsPerBlock), count * static_cast<double>(numberOfHashes));
+
+        rate += probability * std::pow(setBitShare, numberOfHashes);
+    }
+
+    return rate;
+}
+}
+
+BloomFilter::BloomFilter(std::size_t expectedSize, double falsePositiveRate)
+{
+    if (expectedSize == 0)
+    {
+        throw std::invalid_argument("Expected size must be greater than zero.");
+    }
+
+    if (!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0))
+    {
+        throw std::invalid_argument("False positive rate must be in range (0, 1).");
+    }
+
+    // Starts from the size of an unblocked filter and grows it until the blocked filter meets the target.
+    auto bitsPerElement = -std::log(falsePositiveRate) / (std::numbers::ln2 * std::numbers::ln2);
+
+    while (blockedFalsePositiveRate(bitsPerElement, hashesFor(bitsPerElement)) > falsePositiveRate)
+    {
+        bitsPerElement *= 1.01;
+    }
+
+    const auto numberOfBits = static_cast<std::size_t>(std::ceil(bitsPerElement * static_cast<double>(expectedSize)));
+
+    numberOfBlocks = std::max<std::size_t>(1, (numberOfBits + bitsPerBlock - 1) / bitsPerBlock);
+
+    hashesPerElement = hashesFor(bitsPerElement);
+
+    words.assign(numberOfBlocks * wordsPerBlock, 0);
+}
+
+bool BloomFilter::insert(std::uint64_t hash)
+{
+    auto* block = words.data() + blockIndexOf(hash, numberOfBlocks) * wordsPerBlock;
+
+    bool inserted = false;
+
+    forEachBit(hash, hashesPerElement,
+               [block, &inserted](std::size_t wordIndex, std::uint64_t bitMask)
+               {
+                   inserted |= (block[wordIndex] & bitMask) == 0;
+
+                   block[wordIndex] |= bitMask;
+               });
+
+    return inserted;
+}
+
+bool BloomFilter::contains(std::uint64_t hash) const
+{
+    const auto* block = words.data() + blockIndexOf(hash, numberOfBlocks) * wordsPerBlock;
+
+    bool found = true;
+
+    forEachBit(hash, hashesPerElement, [block, &found](std::size_t wordIndex, std::uint64_t bitMask)
+               { found &= (block[wordIndex] & bitMask) != 0; });
+
+    return found;
+}
+
+std::size_t BloomFilter::memoryBytes() const
+{
+    return words.size() * sizeof(std::uint64_t);
+}
+
+unsigned BloomFilter::numberOfHashes() const
+{
+    return hashesPerElement;
+}
+
+void BloomFilter::clear()
+{
+    std::fill(words.begin(), words.end(), 0);
+}
+}
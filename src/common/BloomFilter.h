@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace faker
+{
+/**
+ * @brief Blocked Bloom filter over 64-bit hashes.
+ *
+ * All bits of an element live in one 512-bit block, so a lookup touches a single cache line. The size is fixed at
+ * construction from the expected number of elements and the target false positive rate, counting the higher rate of
+ * blocks that get more than their share of elements.
+ */
+class BloomFilter
+{
+public:
+    /**
+     * @param expectedSize The number of elements the filter is sized for.
+     * @param falsePositiveRate The target false positive rate (`(0.0, 1.0)`) at the expected number of elements.
+     *
+     * @throws std::invalid_argument if the expected size is zero or the false positive rate is out of range.
+     */
+    BloomFilter(std::size_t expectedSize, double falsePositiveRate);
+
+    /**
+     * @brief Inserts the hash into the filter.
+     *
+     * @param hash The hash to insert.
+     *
+     * @return True if the hash was definitely not in the filter before, false if it may have been.
+     */
+    bool insert(std::uint64_t hash);
+
+    bool contains(std::uint64_t hash) const;
+
+    std::size_t memoryBytes() const;
+
+    unsigned numberOfHashes() const;
+
+    void clear();
+
+private:
+    std::vector<std::uint64_t> words;
+    std::size_t numberOfBlocks;
+    unsigned hashesPerElement;
+};
+}
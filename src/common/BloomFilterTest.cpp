@@ -0,0 +1,97 @@
+#include "BloomFilter.h"
+
+#include <stdexcept>
+
+#include "Fingerprint.h"
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+class BloomFilterTest : public Test
+{
+public:
+};
+
+TEST_F(BloomFilterTest, shouldContainInsertedHashes)
+{
+    BloomFilter bloomFilter{1000, 0.01};
+
+    for (std::uint64_t value = 0; value < 1000; value++)
+    {
+        bloomFilter.insert(Fingerprint::of(value));
+    }
+
+    for (std::uint64_t value = 0; value < 1000; value++)
+    {
+        ASSERT_TRUE(bloomFilter.contains(Fingerprint::of(value)));
+    }
+}
+
+TEST_F(BloomFilterTest, shouldReportRepeatedInsertion)
+{
+    BloomFilter bloomFilter{100, 0.01};
+
+    ASSERT_TRUE(bloomFilter.insert(Fingerprint::of(std::uint64_t{5})));
+    ASSERT_FALSE(bloomFilter.insert(Fingerprint::of(std::uint64_t{5})));
+}
+
+TEST_F(BloomFilterTest, shouldKeepFalsePositiveRateNearTarget)
+{
+    const std::uint64_t expectedSize = 10000;
+
+    BloomFilter bloomFilter{expectedSize, 0.01};
+
+    for (std::uint64_t value = 0; value < expectedSize; value++)
+    {
+        bloomFilter.insert(Fingerprint::of(value));
+    }
+
+    unsigned falsePositives = 0;
+
+    for (std::uint64_t value = expectedSize; value < 2 * expectedSize; value++)
+    {
+        falsePositives += bloomFilter.contains(Fingerprint::of(value)) ? 1 : 0;
+    }
+
+    ASSERT_LT(falsePositives, expectedSize * 3 / 200);
+}
+
+TEST_F(BloomFilterTest, shouldKeepLowFalsePositiveRateNearTarget)
+{
+    const std::uint64_t expectedSize = 20000;
+    const std::uint64_t queries = 200000;
+
+    BloomFilter bloomFilter{expectedSize, 0.001};
+
+    for (std::uint64_t value = 0; value < expectedSize; value++)
+    {
+        bloomFilter.insert(Fingerprint::of(value));
+    }
+
+    unsigned falsePositives = 0;
+
+    for (std::uint64_t value = expectedSize; value < expectedSize + queries; value++)
+    {
+        falsePositives += bloomFilter.contains(Fingerprint::of(value)) ? 1 : 0;
+    }
+
+    ASSERT_LT(falsePositives, queries * 3 / 2000);
+}
+
+TEST_F(BloomFilterTest, shouldThrowOnInvalidOptions)
+{
+    ASSERT_THROW(BloomFilter(0, 0.01), std::invalid_argument);
+    ASSERT_THROW(BloomFilter(100, 0.0), std::invalid_argument);
+    ASSERT_THROW(BloomFilter(100, 1.0), std::invalid_argument);
+}
+
+TEST_F(BloomFilterTest, shouldClearHashes)
+{
+    BloomFilter bloomFilter{100, 0.01};
+
+    bloomFilter.insert(Fingerprint::of(std::uint64_t{5}));
+    bloomFilter.clear();
+
+    ASSERT_FALSE(bloomFilter.contains(Fingerprint::of(std::uint64_t{5})));
+}
@@ -0,0 +1,75 @@
+#include "DateHelper.h"
+
+#include <array>
+#include <format>
+#include <stdexcept>
+
+namespace faker
+{
+namespace
+{
+// "00" to "99", so that two digits are copied with one lookup.
+constexpr auto digitPairs = []()
+{
+    std::array<char, 200> pairs{};
+
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        pairs[2 * i] = static_cast<char>('0' + i / 10);
+        pairs[2 * i + 1] = static_cast<char>('0' + i % 10);
+    }
+
+    return pairs;
+}();
+
+void writeDigitPair(char* output, std::uint64_t value)
+{
+    output[0] = digitPairs[2 * value];
+    output[1] = digitPairs[2 * value + 1];
+}
+}
+
+void DateHelper::formatIsoDateTime(std::chrono::sys_seconds time, char* output)
+{
+    const auto days = daysSinceEpoch(time);
+    const auto secondOfDay = static_cast<std::uint64_t>(time.time_since_epoch().count() - days * secondsInDay);
+    const auto date = civilFromDays(days);
+
+    if (date.year < 0 || date.year > 9999)
+    {
+        throw std::out_of_range("Year must be in range [0, 9999] to be formatted with four digits.");
+    }
+
+    const auto year = static_cast<std::uint64_t>(date.year);
+
+    writeDigitPair(output, year / 100);
+    writeDigitPair(output + 2, year % 100);
+    output[4] = '-';
+    writeDigitPair(output + 5, date.month);
+    output[7] = '-';
+    writeDigitPair(output + 8, date.day);
+    output[10] = 'T';
+    writeDigitPair(output + 11, secondOfDay / 3600);
+    output[13] = ':';
+    writeDigitPair(output + 14, secondOfDay / 60 % 60);
+    output[16] = ':';
+    writeDigitPair(output + 17, secondOfDay % 60);
+    output[19] = 'Z';
+}
+
+std::string DateHelper::isoDateTime(std::chrono::sys_seconds time)
+{
+    const auto year = civilFromDays(daysSinceEpoch(time)).year;
+
+    if (year < 0 || year > 9999)
+    {
+        return std::format("{:%FT%TZ}", time);
+    }
+
+    std::string result(isoDateTimeLength, '\0');
+
+    formatIsoDateTime(time, result.data());
+
+    return result;
+}
+}
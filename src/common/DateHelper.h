@@ -0,0 +1,102 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace faker
+{
+struct CivilDate {
+    std::int64_t year;
+    unsigned month;
+    unsigned day;
+};
+
+class DateHelper
+{
+public:
+    /**
+     * @brief Number of characters of a date time formatted by `formatIsoDateTime`, e.g. "2023-12-08T19:31:32Z".
+     */
+    static constexpr std::size_t isoDateTimeLength = 20;
+
+    /**
+     * @brief Returns the proleptic Gregorian calendar date of the given number of days since 1970-01-01.
+     *
+     * Computed with integer arithmetic only, so the result does not depend on the time zone of the host.
+     *
+     * @code
+     * DateHelper::civilFromDays(19699) // {2023, 12, 8}
+     * @endcode
+     */
+    static constexpr CivilDate civilFromDays(std::int64_t days)
+    {
+        // Days are counted from 0000-03-01, so that leap days end the 400-year era and every year.
+        const auto shiftedDays = days + 719468;
+        const auto era = (shiftedDays >= 0 ? shiftedDays : shiftedDays - 146096) / 146097;
+        const auto dayOfEra = static_cast<std::uint64_t>(shiftedDays - era * 146097);
+        const auto yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+        const auto dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+        const auto shiftedMonth = (5 * dayOfYear + 2) / 153;
+        const auto day = static_cast<unsigned>(dayOfYear - (153 * shiftedMonth + 2) / 5 + 1);
+        const auto month = static_cast<unsigned>(shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9);
+        const auto year = static_cast<std::int64_t>(yearOfEra) + era * 400 + (month <= 2 ? 1 : 0);
+
+        return {year, month, day};
+    }
+
+    /**
+     * @brief Returns the number of days since 1970-01-01 of the given proleptic Gregorian calendar date.
+     *
+     * Inverse of `civilFromDays`, computed with integer arithmetic only, so it takes no locks and gives the same result
+     * on every host, unlike `mktime`.
+     *
+     * @code
+     * DateHelper::daysFromCivil(2023, 12, 8) // 19699
+     * @endcode
+     */
+    static constexpr std::int64_t daysFromCivil(std::int64_t year, unsigned month, unsigned day)
+    {
+        // Years start on March 1st, so that the leap day is the last day of a year.
+        const auto shiftedYear = month <= 2 ? year - 1 : year;
+        const auto era = (shiftedYear >= 0 ? shiftedYear : shiftedYear - 399) / 400;
+        const auto yearOfEra = static_cast<std::uint64_t>(shiftedYear - era * 400);
+        const auto dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+        const auto dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+        return era * 146097 + static_cast<std::int64_t>(dayOfEra) - 719468;
+    }
+
+    /**
+     * @brief Writes the given time in ISO 8601 / RFC 3339 format with UTC designator.
+     *
+     * @param time The time to format.
+     * @param output Receives exactly `isoDateTimeLength` characters, no terminating null is written.
+     *
+     * @throws std::out_of_range if the year of the time is not in range `[0, 9999]`.
+     */
+    static void formatIsoDateTime(std::chrono::sys_seconds time, char* output);
+
+    /**
+     * @brief Returns the given time in ISO 8601 / RFC 3339 format with UTC designator.
+     *
+     * Years outside of `[0, 9999]` do not fit into four digits and are formatted with `std::format` instead.
+     *
+     * @code
+     * DateHelper::isoDateTime(std::chrono::sys_seconds{std::chrono::seconds{1702063892}}) // "2023-12-08T19:31:32Z"
+     * @endcode
+     */
+    static std::string isoDateTime(std::chrono::sys_seconds time);
+
+private:
+    static constexpr std::int64_t secondsInDay = 86400;
+
+    static constexpr std::int64_t daysSinceEpoch(std::chrono::sys_seconds time)
+    {
+        const auto seconds = time.time_since_epoch().count();
+
+        return (seconds >= 0 ? seconds : seconds - secondsInDay + 1) / secondsInDay;
+    }
+};
+}
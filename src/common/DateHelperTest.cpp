@@ -0,0 +1,106 @@
+#include "DateHelper.h"
+
+#include <chrono>
+#include <format>
+#include <random>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+class DateHelperTest : public Test
+{
+public:
+};
+
+TEST_F(DateHelperTest, shouldConvertDaysToCivilDate)
+{
+    static_assert(DateHelper::civilFromDays(0).year == 1970);
+
+    const auto date = DateHelper::civilFromDays(19699);
+
+    ASSERT_EQ(date.year, 2023);
+    ASSERT_EQ(date.month, 12);
+    ASSERT_EQ(date.day, 8);
+
+    const auto leapDay = DateHelper::civilFromDays(11016);
+
+    ASSERT_EQ(leapDay.year, 2000);
+    ASSERT_EQ(leapDay.month, 2);
+    ASSERT_EQ(leapDay.day, 29);
+
+    const auto dateBeforeEpoch = DateHelper::civilFromDays(-1);
+
+    ASSERT_EQ(dateBeforeEpoch.year, 1969);
+    ASSERT_EQ(dateBeforeEpoch.month, 12);
+    ASSERT_EQ(dateBeforeEpoch.day, 31);
+}
+
+TEST_F(DateHelperTest, shouldConvertCivilDateToDays)
+{
+    static_assert(DateHelper::daysFromCivil(1970, 1, 1) == 0);
+
+    ASSERT_EQ(DateHelper::daysFromCivil(2023, 12, 8), 19699);
+    ASSERT_EQ(DateHelper::daysFromCivil(2000, 2, 29), 11016);
+    ASSERT_EQ(DateHelper::daysFromCivil(1969, 12, 31), -1);
+    ASSERT_EQ(DateHelper::daysFromCivil(1, 1, 1), -719162);
+}
+
+TEST_F(DateHelperTest, shouldConvertDaysToCivilDateAndBack)
+{
+    for (std::int64_t days = -800000; days <= 3000000; days += 37)
+    {
+        const auto date = DateHelper::civilFromDays(days);
+
+        ASSERT_EQ(DateHelper::daysFromCivil(date.year, date.month, date.day), days);
+
+        const std::chrono::year_month_day chronoDate{std::chrono::sys_days{std::chrono::days{days}}};
+
+        ASSERT_EQ(date.year, static_cast<int>(chronoDate.year()));
+        ASSERT_EQ(date.month, static_cast<unsigned>(chronoDate.month()));
+        ASSERT_EQ(date.day, static_cast<unsigned>(chronoDate.day()));
+    }
+}
+
+TEST_F(DateHelperTest, shouldFormatIsoDateTime)
+{
+    ASSERT_EQ(DateHelper::isoDateTime(std::chrono::sys_seconds{std::chrono::seconds{1702063892}}),
+              "2023-12-08T19:31:32Z");
+    ASSERT_EQ(DateHelper::isoDateTime(std::chrono::sys_seconds{std::chrono::seconds{-1}}), "1969-12-31T23:59:59Z");
+}
+
+TEST_F(DateHelperTest, shouldFormatIsoDateTimeOfChronoCalendarDate)
+{
+    std::mt19937_64 generator{7};
+    // From 0001-01-01 to 9999-12-31.
+    std::uniform_int_distribution<std::int64_t> secondsDistribution(-62135596800, 253402300799);
+
+    for (int i = 0; i < 10000; i++)
+    {
+        const auto time = std::chrono::sys_seconds{std::chrono::seconds{secondsDistribution(generator)}};
+
+        const auto days = std::chrono::floor<std::chrono::days>(time);
+        const std::chrono::year_month_day date{days};
+        const std::chrono::hh_mm_ss timeOfDay{time - days};
+
+        const auto expected = std::format("{:04}-{:02}-{:02}T{:02}:{:02}:{:02}Z", static_cast<int>(date.year()),
+                                          static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()),
+                                          timeOfDay.hours().count(), timeOfDay.minutes().count(),
+                                          timeOfDay.seconds().count());
+
+        ASSERT_EQ(DateHelper::isoDateTime(time), expected);
+    }
+}
+
+TEST_F(DateHelperTest, shouldFormatYearsNotFittingFourDigitsWithChronoFormatting)
+{
+    const auto time = std::chrono::sys_seconds{std::chrono::sys_days{std::chrono::year{12345} / 6 / 7}};
+
+    ASSERT_EQ(DateHelper::isoDateTime(time), std::format("{:%FT%TZ}", time));
+
+    char output[DateHelper::isoDateTimeLength];
+
+    ASSERT_THROW(DateHelper::formatIsoDateTime(time, output), std::out_of_range);
+}
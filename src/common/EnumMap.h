@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace faker
+{
+/**
+ * @brief Fixed-size table mapping every enumerator of an enum with sequential values to a value.
+ *
+ * Lookup is a single indexed load. Tables are built with `EnumMapBuilder::build`.
+ */
+template <typename Enum, typename Value, std::size_t Size>
+class EnumMap
+{
+public:
+    constexpr explicit EnumMap(const std::array<Value, Size>& values) : values{values} {}
+
+    constexpr const Value& operator[](Enum key) const
+    {
+        return values[static_cast<std::size_t>(key)];
+    }
+
+    /**
+     * @throws std::out_of_range if the key is not an enumerator covered by the table.
+     */
+    constexpr const Value& at(Enum key) const
+    {
+        const auto index = static_cast<std::size_t>(key);
+
+        if (index >= Size)
+        {
+            throw std::out_of_range("Enum value is out of range.");
+        }
+
+        return values[index];
+    }
+
+    static constexpr std::size_t size()
+    {
+        return Size;
+    }
+
+private:
+    std::array<Value, Size> values;
+};
+
+class EnumMapBuilder
+{
+public:
+    /**
+     * @brief Builds an EnumMap from entries listed in the order of enumerators.
+     *
+     * Meant to be used in constant expressions, where a missing, repeated or misplaced enumerator fails the
+     * compilation. Passing `LastKey` also checks that the table covers all enumerators up to the last one.
+     *
+     * @code
+     * constexpr auto precisionToDecimalPlaces = EnumMapBuilder::build<Precision, unsigned, Precision::SevenDp>(
+     *     {{Precision::ZeroDp, 0}, {Precision::OneDp, 1}, ..., {Precision::SevenDp, 7}});
+     * precisionToDecimalPlaces[Precision::TwoDp] // 2
+     * @endcode
+     */
+    template <typename Enum, typename Value, Enum LastKey, std::size_t Size>
+    static constexpr EnumMap<Enum, Value, Size> build(const std::pair<Enum, Value> (&entries)[Size])
+    {
+        static_assert(static_cast<std::size_t>(LastKey) + 1 == Size, "Every enumerator needs exactly one entry.");
+
+        for (std::size_t i = 0; i < Size; i++)
+        {
+            if (static_cast<std::size_t>(entries[i].first) != i)
+            {
+                throw std::invalid_argument("Entries must list every enumerator once, in declaration order.");
+            }
+        }
+
+        return EnumMap<Enum, Value, Size>{
+            [&entries]<std::size_t... Indices>(std::index_sequence<Indices...>)
+            { return std::array<Value, Size>{entries[Indices].second...}; }(std::make_index_sequence<Size>{})};
+    }
+};
+}
@@ -0,0 +1,54 @@
+#include "EnumMap.h"
+
+#include <stdexcept>
+#include <string_view>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+namespace
+{
+enum class Shape
+{
+    Circle,
+    Square,
+    Triangle
+};
+
+constexpr auto shapeNames = EnumMapBuilder::build<Shape, std::string_view, Shape::Triangle>({
+    {Shape::Circle, "circle"},
+    {Shape::Square, "square"},
+    {Shape::Triangle, "triangle"},
+});
+}
+
+class EnumMapTest : public Test
+{
+public:
+};
+
+TEST_F(EnumMapTest, shouldLookUpValuesByEnumerator)
+{
+    static_assert(shapeNames[Shape::Square] == "square");
+    static_assert(shapeNames.size() == 3);
+
+    ASSERT_EQ(shapeNames[Shape::Circle], "circle");
+    ASSERT_EQ(shapeNames.at(Shape::Triangle), "triangle");
+}
+
+TEST_F(EnumMapTest, shouldThrowWhenKeyIsOutOfRange)
+{
+    ASSERT_THROW(shapeNames.at(static_cast<Shape>(3)), std::out_of_range);
+}
+
+TEST_F(EnumMapTest, shouldThrowWhenEntriesAreNotInEnumeratorOrder)
+{
+    ASSERT_THROW((EnumMapBuilder::build<Shape, int, Shape::Triangle>({
+                     {Shape::Circle, 0},
+                     {Shape::Triangle, 2},
+                     {Shape::Square, 1},
+                 })),
+                 std::invalid_argument);
+}
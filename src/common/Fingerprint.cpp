@@ -0,0 +1,67 @@
+#include "Fingerprint.h"
+
+#include <cstring>
+
+namespace faker
+{
+namespace
+{
+constexpr std::uint64_t murmurMultiplier = 0xc6a4a7935bd1e995ULL;
+constexpr int murmurShift = 47;
+constexpr std::uint64_t murmurSeed = 0x9e3779b97f4a7c15ULL;
+}
+
+std::uint64_t Fingerprint::of(std::string_view data)
+{
+    const auto length = data.size();
+
+    std::uint64_t hash = murmurSeed ^ (length * murmurMultiplier);
+
+    const auto* bytes = data.data();
+
+    const auto numberOfBlocks = length / sizeof(std::uint64_t);
+
+    for (std::size_t i = 0; i < numberOfBlocks; i++)
+    {
+        std::uint64_t block;
+
+        std::memcpy(&block, bytes + i * sizeof(std::uint64_t), sizeof(std::uint64_t));
+
+        block *= murmurMultiplier;
+        block ^= block >> murmurShift;
+        block *= murmurMultiplier;
+
+        hash ^= block;
+        hash *= murmurMultiplier;
+    }
+
+    const auto* tail = reinterpret_cast<const unsigned char*>(bytes + numberOfBlocks * sizeof(std::uint64_t));
+
+    const auto tailLength = length % sizeof(std::uint64_t);
+
+    if (tailLength > 0)
+    {
+        for (auto i = tailLength; i > 0; i--)
+        {
+            hash ^= static_cast<std::uint64_t>(tail[i - 1]) << (8 * (i - 1));
+        }
+
+        hash *= murmurMultiplier;
+    }
+
+    hash ^= hash >> murmurShift;
+    hash *= murmurMultiplier;
+    hash ^= hash >> murmurShift;
+
+    return hash;
+}
+
+std::uint64_t Fingerprint::of(std::uint64_t value)
+{
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+
+    return value ^ (value >> 31);
+}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace faker
+{
+class Fingerprint
+{
+public:
+    /**
+     * @brief Returns 64-bit fingerprint of the given bytes (MurmurHash64A).
+     *
+     * @param data The bytes to hash.
+     *
+     * @return The 64-bit fingerprint.
+     */
+    static std::uint64_t of(std::string_view data);
+
+    /**
+     * @brief Returns 64-bit fingerprint of the given integer (SplitMix64 finalizer).
+     *
+     * @param value The integer to hash.
+     *
+     * @return The 64-bit fingerprint.
+     */
+    static std::uint64_t of(std::uint64_t value);
+};
+}
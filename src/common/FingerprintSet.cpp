@@ -0,0 +1,114 @@
+#include "FingerprintSet.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace faker
+{
+namespace
+{
+constexpr std::uint64_t emptySlot = 0;
+constexpr std::uint64_t emptySlotReplacement = 1;
+constexpr std::size_t minCapacity = 16;
+
+std::uint64_t toStoredFingerprint(std::uint64_t fingerprint)
+{
+    return fingerprint == emptySlot ? emptySlotReplacement : fingerprint;
+}
+
+std::size_t capacityFor(std::size_t numberOfElements)
+{
+    return std::bit_ceil(std::max(minCapacity, numberOfElements + numberOfElements / 3 + 1));
+}
+}
+
+FingerprintSet::FingerprintSet(std::size_t expectedSize, std::size_t maxMemoryBytesInit)
+    : numberOfElements{0}, maxMemoryBytes{maxMemoryBytesInit}
+{
+    rehash(capacityFor(expectedSize));
+}
+
+bool FingerprintSet::insert(std::uint64_t fingerprint)
+{
+    const auto storedFingerprint = toStoredFingerprint(fingerprint);
+
+    auto slotIndex = findSlot(storedFingerprint);
+
+    if (slots[slotIndex] == storedFingerprint)
+    {
+        return false;
+    }
+
+    if ((numberOfElements + 1) * 4 > slots.size() * 3)
+    {
+        rehash(slots.size() * 2);
+
+        slotIndex = findSlot(storedFingerprint);
+    }
+
+    slots[slotIndex] = storedFingerprint;
+
+    numberOfElements++;
+
+    return true;
+}
+
+bool FingerprintSet::contains(std::uint64_t fingerprint) const
+{
+    const auto storedFingerprint = toStoredFingerprint(fingerprint);
+
+    return slots[findSlot(storedFingerprint)] == storedFingerprint;
+}
+
+std::size_t FingerprintSet::size() const
+{
+    return numberOfElements;
+}
+
+std::size_t FingerprintSet::memoryBytes() const
+{
+    return slots.size() * sizeof(std::uint64_t);
+}
+
+void FingerprintSet::clear()
+{
+    std::fill(slots.begin(), slots.end(), emptySlot);
+
+    numberOfElements = 0;
+}
+
+std::size_t FingerprintSet::findSlot(std::uint64_t fingerprint) const
+{
+    const auto mask = slots.size() - 1;
+
+    auto slotIndex = static_cast<std::size_t>(fingerprint) & mask;
+
+    while (slots[slotIndex] != emptySlot && slots[slotIndex] != fingerprint)
+    {
+        slotIndex = (slotIndex + 1) & mask;
+    }
+
+    return slotIndex;
+}
+
+void FingerprintSet::rehash(std::size_t newCapacity)
+{
+    if (maxMemoryBytes != 0 && newCapacity * sizeof(std::uint64_t) > maxMemoryBytes)
+    {
+        throw std::runtime_error("Fingerprint set exceeds its memory limit.");
+    }
+
+    auto oldSlots = std::move(slots);
+
+    slots.assign(newCapacity, emptySlot);
+
+    for (const auto fingerprint : oldSlots)
+    {
+        if (fingerprint != emptySlot)
+        {
+            slots[findSlot(fingerprint)] = fingerprint;
+        }
+    }
+}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace faker
+{
+/**
+ * @brief Open-addressing hash set of 64-bit fingerprints with linear probing.
+ *
+ * Every element takes a single 64-bit slot, the table is kept at most 3/4 full and doubles when needed.
+ */
+class FingerprintSet
+{
+public:
+    /**
+     * @param expectedSize The number of fingerprints the set is sized for up front.
+     * @param maxMemoryBytes The upper limit of the table size in bytes, `0` means no limit.
+     *
+     * @throws std::runtime_error if the initial table does not fit in the memory limit.
+     */
+    explicit FingerprintSet(std::size_t expectedSize = 0, std::size_t maxMemoryBytes = 0);
+
+    /**
+     * @brief Inserts the fingerprint into the set.
+     *
+     * @param fingerprint The fingerprint to insert.
+     *
+     * @throws std::runtime_error if the table has to grow beyond the memory limit.
+     *
+     * @return True if the fingerprint was not in the set before, false otherwise.
+     */
+    bool insert(std::uint64_t fingerprint);
+
+    bool contains(std::uint64_t fingerprint) const;
+
+    std::size_t size() const;
+
+    std::size_t memoryBytes() const;
+
+    void clear();
+
+private:
+    std::size_t findSlot(std::uint64_t fingerprint) const;
+    void rehash(std::size_t newCapacity);
+
+    std::vector<std::uint64_t> slots;
+    std::size_t numberOfElements;
+    std::size_t maxMemoryBytes;
+};
+}
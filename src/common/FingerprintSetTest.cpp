@@ -0,0 +1,75 @@
+#include "FingerprintSet.h"
+
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+class FingerprintSetTest : public Test
+{
+public:
+};
+
+TEST_F(FingerprintSetTest, shouldInsertFingerprintOnlyOnce)
+{
+    FingerprintSet fingerprints;
+
+    ASSERT_TRUE(fingerprints.insert(42));
+    ASSERT_FALSE(fingerprints.insert(42));
+    ASSERT_TRUE(fingerprints.contains(42));
+    ASSERT_FALSE(fingerprints.contains(43));
+    ASSERT_EQ(fingerprints.size(), 1);
+}
+
+TEST_F(FingerprintSetTest, shouldStoreZeroFingerprint)
+{
+    FingerprintSet fingerprints;
+
+    ASSERT_TRUE(fingerprints.insert(0));
+    ASSERT_FALSE(fingerprints.insert(0));
+    ASSERT_TRUE(fingerprints.contains(0));
+}
+
+TEST_F(FingerprintSetTest, shouldGrowKeepingAllFingerprints)
+{
+    FingerprintSet fingerprints;
+
+    for (std::uint64_t fingerprint = 1; fingerprint <= 10000; fingerprint++)
+    {
+        ASSERT_TRUE(fingerprints.insert(fingerprint * 0x9e3779b97f4a7c15ULL));
+    }
+
+    ASSERT_EQ(fingerprints.size(), 10000);
+
+    for (std::uint64_t fingerprint = 1; fingerprint <= 10000; fingerprint++)
+    {
+        ASSERT_TRUE(fingerprints.contains(fingerprint * 0x9e3779b97f4a7c15ULL));
+    }
+
+    ASSERT_GE(fingerprints.memoryBytes(), 10000 * sizeof(std::uint64_t));
+}
+
+TEST_F(FingerprintSetTest, shouldThrowWhenGrowingBeyondMemoryLimit)
+{
+    FingerprintSet fingerprints{0, 16 * sizeof(std::uint64_t)};
+
+    for (std::uint64_t fingerprint = 1; fingerprint <= 12; fingerprint++)
+    {
+        fingerprints.insert(fingerprint);
+    }
+
+    ASSERT_THROW(fingerprints.insert(13), std::runtime_error);
+}
+
+TEST_F(FingerprintSetTest, shouldClearFingerprints)
+{
+    FingerprintSet fingerprints;
+
+    fingerprints.insert(7);
+    fingerprints.clear();
+
+    ASSERT_EQ(fingerprints.size(), 0);
+    ASSERT_FALSE(fingerprints.contains(7));
+}
@@ -0,0 +1,33 @@
+#include "Fingerprint.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+class FingerprintTest : public Test
+{
+public:
+};
+
+TEST_F(FingerprintTest, shouldReturnSameFingerprintForSameBytes)
+{
+    const std::string text{"Sergio_Greenfelder@hotmail.com"};
+
+    ASSERT_EQ(Fingerprint::of(std::string_view{text}),
+              Fingerprint::of(std::string_view{"Sergio_Greenfelder@hotmail.com"}));
+}
+
+TEST_F(FingerprintTest, shouldReturnDifferentFingerprintsForDifferentBytes)
+{
+    ASSERT_NE(Fingerprint::of(std::string_view{"abcdefgh1"}), Fingerprint::of(std::string_view{"abcdefgh2"}));
+    ASSERT_NE(Fingerprint::of(std::string_view{""}), Fingerprint::of(std::string_view{"a"}));
+}
+
+TEST_F(FingerprintTest, shouldMixIntegers)
+{
+    ASSERT_NE(Fingerprint::of(std::uint64_t{1}), Fingerprint::of(std::uint64_t{2}));
+    ASSERT_NE(Fingerprint::of(std::uint64_t{1}), std::uint64_t{1});
+}
@@ -0,0 +1,78 @@
+#include "LengthIndex.h"
+
+#include <algorithm>
+
+namespace faker
+{
+LengthIndex::LengthIndex(std::span<const std::string_view> data) : stringsByLength(data.begin(), data.end())
+{
+    indexByLength();
+}
+
+LengthIndex::LengthIndex(StringPoolView data)
+{
+    stringsByLength.reserve(data.size());
+
+    for (std::size_t i = 0; i < data.size(); i++)
+    {
+        stringsByLength.push_back(data[i]);
+    }
+
+    indexByLength();
+}
+
+void LengthIndex::indexByLength()
+{
+    std::stable_sort(stringsByLength.begin(), stringsByLength.end(),
+                     [](std::string_view lhs, std::string_view rhs) { return lhs.size() < rhs.size(); });
+
+    const auto longestLength = stringsByLength.empty() ? 0 : stringsByLength.back().size();
+
+    lengthOffsets.assign(longestLength + 2, 0);
+
+    for (const auto& string : stringsByLength)
+    {
+        lengthOffsets[string.size() + 1]++;
+    }
+
+    for (std::size_t length = 1; length < lengthOffsets.size(); length++)
+    {
+        lengthOffsets[length] += lengthOffsets[length - 1];
+    }
+}
+
+std::span<const std::string_view> LengthIndex::all() const
+{
+    return stringsByLength;
+}
+
+std::span<const std::string_view> LengthIndex::withLength(std::size_t length) const
+{
+    return withLengthBetween(length, length);
+}
+
+std::span<const std::string_view> LengthIndex::withLengthBetween(std::size_t minLength, std::size_t maxLength) const
+{
+    const auto longestLength = lengthOffsets.size() - 2;
+
+    if (minLength > maxLength || minLength > longestLength)
+    {
+        return {};
+    }
+
+    const auto begin = lengthOffsets[minLength];
+    const auto end = lengthOffsets[std::min(maxLength, longestLength) + 1];
+
+    return std::span<const std::string_view>{stringsByLength}.subspan(begin, end - begin);
+}
+
+std::size_t LengthIndex::minLength() const
+{
+    return stringsByLength.empty() ? 0 : stringsByLength.front().size();
+}
+
+std::size_t LengthIndex::maxLength() const
+{
+    return stringsByLength.empty() ? 0 : stringsByLength.back().size();
+}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "StringPool.h"
+
+namespace faker
+{
+/**
+ * @brief Groups strings by their length, so strings of a given length or length range are one contiguous span.
+ *
+ * The index keeps views of the given strings, which must outlive it.
+ */
+class LengthIndex
+{
+public:
+    explicit LengthIndex(std::span<const std::string_view> data);
+
+    explicit LengthIndex(StringPoolView data);
+
+    /**
+     * @return All indexed strings, ordered by length.
+     */
+    std::span<const std::string_view> all() const;
+
+    /**
+     * @return Strings of the given length, empty if there are none.
+     */
+    std::span<const std::string_view> withLength(std::size_t length) const;
+
+    /**
+     * @return Strings with length in range `[minLength, maxLength]`, empty if there are none.
+     */
+    std::span<const std::string_view> withLengthBetween(std::size_t minLength, std::size_t maxLength) const;
+
+    std::size_t minLength() const;
+
+    std::size_t maxLength() const;
+
+private:
+    void indexByLength();
+
+    std::vector<std::string_view> stringsByLength;
+    std::vector<std::size_t> lengthOffsets;
+};
+}
@@ -0,0 +1,83 @@
+#include "LengthIndex.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+class LengthIndexTest : public Test
+{
+public:
+    const std::vector<std::string_view> words{"dog", "horse", "cat", "ox", "zebra", "elephant"};
+};
+
+TEST_F(LengthIndexTest, shouldReturnStringsWithGivenLength)
+{
+    const LengthIndex lengthIndex{words};
+
+    const auto threeLetterWords = lengthIndex.withLength(3);
+
+    ASSERT_EQ(threeLetterWords.size(), 2);
+    ASSERT_EQ(threeLetterWords[0], "dog");
+    ASSERT_EQ(threeLetterWords[1], "cat");
+}
+
+TEST_F(LengthIndexTest, shouldReturnEmptySpanForMissingLength)
+{
+    const LengthIndex lengthIndex{words};
+
+    ASSERT_TRUE(lengthIndex.withLength(4).empty());
+    ASSERT_TRUE(lengthIndex.withLength(100).empty());
+}
+
+TEST_F(LengthIndexTest, shouldReturnStringsWithLengthInRange)
+{
+    const LengthIndex lengthIndex{words};
+
+    const auto rangeWords = lengthIndex.withLengthBetween(3, 5);
+
+    ASSERT_EQ(rangeWords.size(), 4);
+    ASSERT_TRUE(std::all_of(rangeWords.begin(), rangeWords.end(),
+                            [](std::string_view word) { return word.size() >= 3 && word.size() <= 5; }));
+
+    ASSERT_EQ(lengthIndex.withLengthBetween(6, 100).size(), 1);
+    ASSERT_TRUE(lengthIndex.withLengthBetween(5, 3).empty());
+}
+
+TEST_F(LengthIndexTest, shouldReturnAllStringsOrderedByLength)
+{
+    const LengthIndex lengthIndex{words};
+
+    const auto allWords = lengthIndex.all();
+
+    ASSERT_EQ(allWords.size(), words.size());
+    ASSERT_TRUE(std::is_sorted(allWords.begin(), allWords.end(),
+                               [](std::string_view lhs, std::string_view rhs) { return lhs.size() < rhs.size(); }));
+}
+
+TEST_F(LengthIndexTest, shouldReturnMinAndMaxLength)
+{
+    const LengthIndex lengthIndex{words};
+
+    ASSERT_EQ(lengthIndex.minLength(), 2);
+    ASSERT_EQ(lengthIndex.maxLength(), 8);
+}
+
+TEST_F(LengthIndexTest, shouldIndexStringPoolView)
+{
+    static constexpr auto pooledWords = std::to_array<std::string_view>({"dog", "horse", "cat", "ox"});
+    static constexpr auto pool = StringPoolBuilder::build<pooledWords>();
+
+    const LengthIndex lengthIndex{pool.all()};
+
+    const auto threeLetterWords = lengthIndex.withLength(3);
+
+    ASSERT_EQ(threeLetterWords.size(), 2);
+    ASSERT_EQ(threeLetterWords[0], "dog");
+    ASSERT_EQ(threeLetterWords[1], "cat");
+    ASSERT_EQ(lengthIndex.maxLength(), 5);
+}
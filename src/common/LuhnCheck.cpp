@@ -1,20 +1,40 @@
 #include "LuhnCheck.h"
 
+#include <bit>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
 namespace faker
 {
-int LuhnCheck::luhnCheckSum(const std::string& inputString)
+namespace
+{
+constexpr std::uint64_t bytesOf(std::uint8_t value)
 {
-    std::string modifiedStr = inputString;
-    modifiedStr.erase(
-        std::remove_if(modifiedStr.begin(), modifiedStr.end(), [](char c) { return std::isspace(c) || c == '-'; }),
-        modifiedStr.end());
+    return 0x0101010101010101ull * value;
+}
 
+// Bytes 0, 2, 4 and 6 of a little-endian word, i.e. every second character starting at the first one.
+constexpr std::uint64_t evenBytesMask = 0x00FF00FF00FF00FFull;
+
+/**
+ * Returns the luhn sum of the given characters, where every second digit from the right is doubled, starting with
+ * the last digit if `doubleLast` is set. Spaces and dashes are skipped.
+ */
+int luhnSum(std::string_view characters, bool doubleLast)
+{
     int sum = 0;
-    bool alternate = false;
+    bool alternate = doubleLast;
 
-    for (std::string::size_type i = modifiedStr.length() - 1; i != std::string::size_type(-1); i--)
+    for (auto character = characters.rbegin(); character != characters.rend(); character++)
     {
-        int n = modifiedStr[i] - '0';
+        if (std::isspace(static_cast<unsigned char>(*character)) || *character == '-')
+        {
+            continue;
+        }
+
+        int n = *character - '0';
 
         if (alternate)
         {
@@ -29,18 +49,137 @@ int LuhnCheck::luhnCheckSum(const std::string& inputString)
         alternate = !alternate;
     }
 
-    return sum % 10;
+    return sum;
+}
+
+/**
+ * Adds luhn contributions of eight digits loaded into a word, with the digits selected by `doubledMask` doubled.
+ *
+ * Digits of all bytes are doubled at once as `2d - 9` for digits of at least five, and the bytes are summed with a
+ * single multiplication. Returns false if any of the characters is not a digit.
+ */
+bool addWordLuhnSum(std::uint64_t word, std::uint64_t doubledMask, unsigned& sum)
+{
+    const auto isNumeric =
+        (word & bytesOf(0xF0)) == bytesOf(0x30) && ((word + bytesOf(0x06)) & bytesOf(0xF0)) == bytesOf(0x30);
+
+    if (!isNumeric)
+    {
+        return false;
+    }
+
+    const auto digits = word - bytesOf(0x30);
+    const auto atLeastFive = ((digits + bytesOf(0x03)) >> 3) & bytesOf(0x01);
+    const auto doubled = (digits << 1) - atLeastFive * 9;
+    const auto contributions = (digits & ~doubledMask) | (doubled & doubledMask);
+
+    sum += static_cast<unsigned>((contributions * bytesOf(0x01)) >> 56);
+
+    return true;
 }
 
-bool LuhnCheck::luhnCheck(const std::string& inputString)
+/**
+ * Computes the luhn sum of a string of digits only, eight digits at a time on little-endian platforms.
+ *
+ * Returns false if any of the characters is not a digit.
+ */
+bool digitsLuhnSum(std::string_view digits, unsigned& sum)
+{
+    sum = 0;
+
+    std::size_t i = 0;
+
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        // Words start at multiples of eight, so the doubled positions are the same in all of them.
+        const auto doubledMask = digits.size() % 2 == 0 ? evenBytesMask : ~evenBytesMask;
+
+        for (; i + 8 <= digits.size(); i += 8)
+        {
+            std::uint64_t word;
+            std::memcpy(&word, digits.data() + i, sizeof(word));
+
+            if (!addWordLuhnSum(word, doubledMask, sum))
+            {
+                return false;
+            }
+        }
+    }
+
+    for (; i < digits.size(); i++)
+    {
+        if (digits[i] < '0' || digits[i] > '9')
+        {
+            return false;
+        }
+
+        const auto digit = static_cast<unsigned>(digits[i] - '0');
+        const auto isDoubled = (digits.size() - 1 - i) % 2 == 1;
+
+        sum += isDoubled ? (digit * 2 > 9 ? digit * 2 - 9 : digit * 2) : digit;
+    }
+
+    return true;
+}
+}
+
+int LuhnCheck::luhnCheckSum(std::string_view inputString)
+{
+    return luhnSum(inputString, false) % 10;
+}
+
+bool LuhnCheck::luhnCheck(std::string_view inputString)
 {
     return luhnCheckSum(inputString) == 0;
 }
 
-int LuhnCheck::luhnCheckValue(const std::string& inputString)
+int LuhnCheck::luhnCheckValue(std::string_view inputString)
 {
-    int checksum = luhnCheckSum(inputString.substr(0, inputString.length() - 1) + '0');
-    
+    // The placeholder is replaced with 0, which does not change the sum but makes the digit before it doubled.
+    int checksum = luhnSum(inputString.substr(0, inputString.empty() ? 0 : inputString.size() - 1), true) % 10;
+
     return checksum == 0 ? 0 : 10 - checksum;
 }
+
+std::size_t LuhnCheck::checkBatch(std::span<const std::string_view> inputStrings, std::span<bool> results)
+{
+    if (inputStrings.size() != results.size())
+    {
+        throw std::invalid_argument("Number of results must be equal to number of input strings.");
+    }
+
+    std::size_t passedCount = 0;
+
+    for (std::size_t i = 0; i < inputStrings.size(); i++)
+    {
+        unsigned sum{};
+
+        results[i] = digitsLuhnSum(inputStrings[i], sum) ? sum % 10 == 0 : luhnCheck(inputStrings[i]);
+
+        passedCount += results[i];
+    }
+
+    return passedCount;
+}
+
+std::size_t LuhnCheck::checkPacked(std::string_view packedDigits, std::size_t width, std::span<bool> results)
+{
+    if (width == 0 || packedDigits.size() % width != 0 || packedDigits.size() / width != results.size())
+    {
+        throw std::invalid_argument("Packed digits must consist of one number of given width per result.");
+    }
+
+    std::size_t passedCount = 0;
+
+    for (std::size_t i = 0; i < results.size(); i++)
+    {
+        unsigned sum{};
+
+        results[i] = digitsLuhnSum(packedDigits.substr(i * width, width), sum) && sum % 10 == 0;
+
+        passedCount += results[i];
+    }
+
+    return passedCount;
+}
 }
@@ -1,7 +1,8 @@
 #pragma once
 
-#include <string>
-#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <string_view>
 
 namespace faker
 {
@@ -17,7 +18,7 @@ public:
      * @return The luhn checksum value for the given value.
      *
      */
-    static int luhnCheckSum(const std::string& inputString);
+    static int luhnCheckSum(std::string_view inputString);
 
     /**
      * @brief Checks that the given string passes the luhn algorithm.
@@ -27,7 +28,7 @@ public:
      * @return Is the string pass the check or not.
      *
      */
-    static bool luhnCheck(const std::string& inputString);
+    static bool luhnCheck(std::string_view inputString);
 
     /**
      * @brief Returns the luhn check value for the given string.
@@ -38,6 +39,40 @@ public:
      * @return the luhn check value for the given string.
      *
      */
-    static int luhnCheckValue(const std::string& inputString);
+    static int luhnCheckValue(std::string_view inputString);
+
+    /**
+     * @brief Checks that each of the given strings passes the luhn algorithm.
+     *
+     * Strings of digits only are summed eight digits at a time, strings with separators are checked like in
+     * `luhnCheck`. Nothing is allocated.
+     *
+     * @param inputStrings The strings to validate.
+     * @param results Receives whether the string with the same index passes the check.
+     *
+     * @throws std::invalid_argument if the number of results differs from the number of strings.
+     *
+     * @return The number of strings passing the check.
+     *
+     */
+    static std::size_t checkBatch(std::span<const std::string_view> inputStrings, std::span<bool> results);
+
+    /**
+     * @brief Checks that each of the numbers packed into the given digits passes the luhn algorithm.
+     *
+     * The numbers are stored one after another without separators, each number taking exactly `width` digits.
+     * Numbers with a character other than a digit fail the check. Nothing is allocated.
+     *
+     * @param packedDigits The digits of all numbers.
+     * @param width The number of digits of each number.
+     * @param results Receives whether the number with the same index passes the check.
+     *
+     * @throws std::invalid_argument if width is 0, the digits are not a whole number of numbers, or the number of
+     * results differs from the number of numbers.
+     *
+     * @return The number of numbers passing the check.
+     *
+     */
+    static std::size_t checkPacked(std::string_view packedDigits, std::size_t width, std::span<bool> results);
 };
 }
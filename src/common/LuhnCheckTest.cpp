@@ -1,8 +1,12 @@
 #include "LuhnCheck.h"
 
 #include <algorithm>
+#include <array>
 #include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 using namespace faker;
 
@@ -17,3 +21,65 @@ TEST(LuhnCheckValueTest, BasicTest) {
     int result = LuhnCheck::luhnCheckValue(input);
     EXPECT_EQ(result, 1); // Replace 1 with the expected result for the given input.
 }
+
+TEST(LuhnCheckBatchTest, ChecksStringsWithAndWithoutSeparators) {
+    const std::array<std::string_view, 5> inputs{"6453-4876-8626-8995-3771", "4539148803436467", "4539148803436468",
+                                                 "4882664999007", "79927398713"};
+    std::array<bool, 5> results{};
+
+    const auto passedCount = LuhnCheck::checkBatch(inputs, results);
+
+    EXPECT_EQ(passedCount, 4);
+    EXPECT_EQ(results, (std::array<bool, 5>{true, true, false, true, true}));
+}
+
+TEST(LuhnCheckBatchTest, ThrowsWhenResultsDoNotMatchInputs) {
+    const std::array<std::string_view, 2> inputs{"4539148803436467", "4882664999007"};
+    std::array<bool, 1> results{};
+
+    EXPECT_THROW(LuhnCheck::checkBatch(inputs, results), std::invalid_argument);
+}
+
+TEST(LuhnCheckPackedTest, ChecksFixedWidthNumbers) {
+    const std::string packedDigits = "4539148803436467"
+                                     "4539148803436468"
+                                     "6011000990139424"
+                                     "60110009901394a4";
+    std::array<bool, 4> results{};
+
+    const auto passedCount = LuhnCheck::checkPacked(packedDigits, 16, results);
+
+    EXPECT_EQ(passedCount, 2);
+    EXPECT_EQ(results, (std::array<bool, 4>{true, false, true, false}));
+}
+
+TEST(LuhnCheckPackedTest, MatchesScalarCheckForAllWidths) {
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> digitDistribution(0, 9);
+
+    for (std::size_t width = 1; width <= 24; width++)
+    {
+        std::string packedDigits;
+
+        for (std::size_t i = 0; i < 50 * width; i++)
+        {
+            packedDigits += static_cast<char>('0' + digitDistribution(generator));
+        }
+
+        std::array<bool, 50> results{};
+
+        LuhnCheck::checkPacked(packedDigits, width, results);
+
+        for (std::size_t i = 0; i < results.size(); i++)
+        {
+            EXPECT_EQ(results[i], LuhnCheck::luhnCheck(std::string_view{packedDigits}.substr(i * width, width)));
+        }
+    }
+}
+
+TEST(LuhnCheckPackedTest, ThrowsWhenDigitsAreNotWholeNumbers) {
+    std::array<bool, 2> results{};
+
+    EXPECT_THROW(LuhnCheck::checkPacked("123456789", 5, results), std::invalid_argument);
+    EXPECT_THROW(LuhnCheck::checkPacked("1234567890", 0, results), std::invalid_argument);
+}
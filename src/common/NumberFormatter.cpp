@@ -0,0 +1,53 @@
+#include "NumberFormatter.h"
+
+namespace faker
+{
+std::string NumberFormatter::fixed(double value, unsigned decimalPlaces)
+{
+    // Sign, integer digits of the largest double, decimal point and decimal places.
+    std::string result(std::numeric_limits<double>::max_exponent10 + 3 + decimalPlaces, '\0');
+
+    const auto end = std::to_chars(result.data(), result.data() + result.size(), value, std::chars_format::fixed,
+                                   static_cast<int>(decimalPlaces))
+                         .ptr;
+
+    result.resize(static_cast<std::size_t>(end - result.data()));
+
+    return result;
+}
+
+std::string NumberFormatter::scaledDecimal(std::int64_t scaledValue, unsigned decimalPlaces)
+{
+    const auto isNegative = scaledValue < 0;
+    const auto magnitude =
+        isNegative ? std::uint64_t{0} - static_cast<std::uint64_t>(scaledValue) : static_cast<std::uint64_t>(scaledValue);
+
+    auto digits = format(magnitude);
+
+    if (digits.size() <= decimalPlaces)
+    {
+        digits.insert(0, decimalPlaces + 1 - digits.size(), '0');
+    }
+
+    std::string result;
+
+    result.reserve(digits.size() + 2);
+
+    if (isNegative)
+    {
+        result += '-';
+    }
+
+    const auto integerDigits = digits.size() - decimalPlaces;
+
+    result.append(digits, 0, integerDigits);
+
+    if (decimalPlaces > 0)
+    {
+        result += '.';
+        result.append(digits, integerDigits);
+    }
+
+    return result;
+}
+}
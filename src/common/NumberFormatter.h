@@ -0,0 +1,75 @@
+#pragma once
+
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace faker
+{
+/**
+ * @brief Formats numbers with `std::to_chars`.
+ *
+ * Unlike streams, the output does not depend on the global locale, so generated values are the same whatever locale
+ * the host process sets.
+ */
+class NumberFormatter
+{
+public:
+    /**
+     * @brief Returns digits of the given integer in the given base.
+     *
+     * @param value The integer to format.
+     * @param base The base, from 2 to 36. Defaults to `10`.
+     *
+     * @return Formatted integer, digits above 9 are lowercase letters.
+     *
+     * @code
+     * NumberFormatter::format(255) // "255"
+     * NumberFormatter::format(255, 16) // "ff"
+     * @endcode
+     */
+    template <std::integral I>
+    static std::string format(I value, int base = 10)
+    {
+        char buffer[std::numeric_limits<I>::digits + 2];
+
+        const auto end = std::to_chars(buffer, buffer + sizeof(buffer), value, base).ptr;
+
+        return {buffer, end};
+    }
+
+    /**
+     * @brief Returns the given number with a fixed number of decimal places.
+     *
+     * @param value The number to format.
+     * @param decimalPlaces The number of digits after the decimal point.
+     *
+     * @return Formatted number, rounded to the given number of decimal places.
+     *
+     * @code
+     * NumberFormatter::fixed(3.14159, 2) // "3.14"
+     * NumberFormatter::fixed(2, 0) // "2"
+     * @endcode
+     */
+    static std::string fixed(double value, unsigned decimalPlaces);
+
+    /**
+     * @brief Returns a decimal number given as an integer count of its smallest units.
+     *
+     * Formats the digits of the integer directly, so the result is exact for any value.
+     *
+     * @param scaledValue The number multiplied by `10^decimalPlaces`, e.g. an amount in cents.
+     * @param decimalPlaces The number of digits after the decimal point.
+     *
+     * @return Formatted number.
+     *
+     * @code
+     * NumberFormatter::scaledDecimal(12345, 2) // "123.45"
+     * NumberFormatter::scaledDecimal(-5, 2) // "-0.05"
+     * @endcode
+     */
+    static std::string scaledDecimal(std::int64_t scaledValue, unsigned decimalPlaces);
+};
+}
@@ -0,0 +1,78 @@
+#include "NumberFormatter.h"
+
+#include <cstdint>
+#include <limits>
+#include <locale>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+namespace
+{
+class CommaDecimalPoint : public std::numpunct<char>
+{
+protected:
+    char do_decimal_point() const override
+    {
+        return ',';
+    }
+
+    char do_thousands_sep() const override
+    {
+        return ' ';
+    }
+
+    std::string do_grouping() const override
+    {
+        return "\3";
+    }
+};
+}
+
+class NumberFormatterTest : public Test
+{
+public:
+};
+
+TEST_F(NumberFormatterTest, shouldFormatIntegers)
+{
+    ASSERT_EQ(NumberFormatter::format(0), "0");
+    ASSERT_EQ(NumberFormatter::format(-1234), "-1234");
+    ASSERT_EQ(NumberFormatter::format(255, 16), "ff");
+    ASSERT_EQ(NumberFormatter::format(std::numeric_limits<std::int64_t>::min()), "-9223372036854775808");
+    ASSERT_EQ(NumberFormatter::format(std::numeric_limits<std::uint64_t>::max(), 2), std::string(64, '1'));
+}
+
+TEST_F(NumberFormatterTest, shouldFormatFixedDecimals)
+{
+    ASSERT_EQ(NumberFormatter::fixed(3.14159, 2), "3.14");
+    ASSERT_EQ(NumberFormatter::fixed(2.5, 0), "2");
+    ASSERT_EQ(NumberFormatter::fixed(-0.125, 3), "-0.125");
+    ASSERT_EQ(NumberFormatter::fixed(1, 7), "1.0000000");
+    ASSERT_EQ(NumberFormatter::fixed(std::numeric_limits<double>::max(), 1).size(), 311);
+}
+
+TEST_F(NumberFormatterTest, shouldFormatScaledDecimals)
+{
+    ASSERT_EQ(NumberFormatter::scaledDecimal(12345, 2), "123.45");
+    ASSERT_EQ(NumberFormatter::scaledDecimal(5, 2), "0.05");
+    ASSERT_EQ(NumberFormatter::scaledDecimal(-5, 3), "-0.005");
+    ASSERT_EQ(NumberFormatter::scaledDecimal(0, 1), "0.0");
+    ASSERT_EQ(NumberFormatter::scaledDecimal(42, 0), "42");
+    ASSERT_EQ(NumberFormatter::scaledDecimal(std::numeric_limits<std::int64_t>::min(), 4), "-922337203685477.5808");
+}
+
+TEST_F(NumberFormatterTest, shouldNotDependOnGlobalLocale)
+{
+    const auto previousLocale = std::locale::global(std::locale(std::locale::classic(), new CommaDecimalPoint));
+
+    const auto fixed = NumberFormatter::fixed(1234.5, 1);
+    const auto integer = NumberFormatter::format(1234567);
+
+    std::locale::global(previousLocale);
+
+    ASSERT_EQ(fixed, "1234.5");
+    ASSERT_EQ(integer, "1234567");
+}
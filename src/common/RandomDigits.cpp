@@ -0,0 +1,90 @@
+#include "RandomDigits.h"
+
+#include <cstdint>
+
+#include "faker-cxx/Number.h"
+
+namespace faker
+{
+namespace
+{
+constexpr std::uint64_t digitsBound = 10'000'000'000'000'000'000ull;
+
+/**
+ * Hands out digits of one draw at a time, lowest first. Division by the constant 10 compiles to a multiply-high and a
+ * shift, so a digit costs a few instructions instead of a call into the distribution.
+ */
+class DigitSource
+{
+public:
+    char next()
+    {
+        if (remaining == 0)
+        {
+            digits = Number::integer<std::uint64_t>(digitsBound - 1);
+            remaining = RandomDigits::digitsPerDraw;
+        }
+
+        const auto digit = static_cast<char>('0' + digits % 10);
+
+        digits /= 10;
+        remaining--;
+
+        return digit;
+    }
+
+    // Digits below the minimum are rejected, which keeps the remaining digits uniform.
+    char nextFrom(char minDigit)
+    {
+        auto digit = next();
+
+        while (digit < minDigit)
+        {
+            digit = next();
+        }
+
+        return digit;
+    }
+
+private:
+    std::uint64_t digits = 0;
+    std::size_t remaining = 0;
+};
+}
+
+void RandomDigits::fill(std::span<char> digits)
+{
+    DigitSource source;
+
+    for (auto& digit : digits)
+    {
+        digit = source.next();
+    }
+}
+
+void RandomDigits::fillTemplate(std::span<char> text, char symbol, char minDigit)
+{
+    DigitSource source;
+
+    for (auto& character : text)
+    {
+        if (character == symbol)
+        {
+            character = source.nextFrom(minDigit);
+        }
+        else if (character == '!')
+        {
+            character = source.nextFrom('2');
+        }
+    }
+}
+
+std::string RandomDigits::fromTemplate(std::string_view pattern, char symbol, char minDigit)
+{
+    std::string text{pattern};
+
+    fillTemplate(text, symbol, minDigit);
+
+    return text;
+}
+}
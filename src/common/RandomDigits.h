@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace faker
+{
+/**
+ * @brief Fills digit slots of strings with random decimal digits.
+ *
+ * Digits are taken from 64-bit draws below 10^19, so a single draw supplies 19 uniformly distributed digits rather
+ * than a draw per digit.
+ */
+class RandomDigits
+{
+public:
+    static constexpr std::size_t digitsPerDraw = 19;
+
+    /**
+     * @brief Writes a random digit character into every character of `digits`.
+     */
+    static void fill(std::span<char> digits);
+
+    /**
+     * @brief Replaces every `symbol` in `text` with a random digit from `minDigit` to 9 and every `!` with a random
+     * digit from 2 to 9.
+     *
+     * @code
+     * std::string text{"!##-####"};
+     * RandomDigits::fillTemplate(text); // text == "405-1839"
+     * RandomDigits::fillTemplate(text, '#', '1'); // digits of `#` slots are never 0
+     * @endcode
+     */
+    static void fillTemplate(std::span<char> text, char symbol = '#', char minDigit = '0');
+
+    /**
+     * @return Copy of `pattern` with slots replaced as by `fillTemplate`.
+     *
+     * @code
+     * RandomDigits::fromTemplate("##-###") // "27-018"
+     * @endcode
+     */
+    static std::string fromTemplate(std::string_view pattern, char symbol = '#', char minDigit = '0');
+};
+}
@@ -0,0 +1,92 @@
+#include "RandomDigits.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+class RandomDigitsTest : public Test
+{
+public:
+};
+
+TEST_F(RandomDigitsTest, shouldFillEveryCharacterWithDigit)
+{
+    std::string digits(100, 'x');
+
+    RandomDigits::fill(digits);
+
+    ASSERT_TRUE(std::ranges::all_of(digits, [](char digit) { return digit >= '0' && digit <= '9'; }));
+}
+
+TEST_F(RandomDigitsTest, shouldFillEmptySpan)
+{
+    std::string digits;
+
+    RandomDigits::fill(digits);
+
+    ASSERT_TRUE(digits.empty());
+}
+
+TEST_F(RandomDigitsTest, shouldDrawEveryDigit)
+{
+    std::string digits(1000, '\0');
+
+    RandomDigits::fill(digits);
+
+    for (char digit = '0'; digit <= '9'; digit++)
+    {
+        ASSERT_NE(digits.find(digit), std::string::npos);
+    }
+}
+
+TEST_F(RandomDigitsTest, shouldReplaceSymbolsOfTemplate)
+{
+    const std::string pattern = "+1 (!##) ###-####";
+
+    for (int i = 0; i < 100; i++)
+    {
+        const auto text = RandomDigits::fromTemplate(pattern);
+
+        ASSERT_EQ(text.size(), pattern.size());
+
+        for (std::size_t j = 0; j < pattern.size(); j++)
+        {
+            if (pattern[j] == '#')
+            {
+                ASSERT_TRUE(text[j] >= '0' && text[j] <= '9');
+            }
+            else if (pattern[j] == '!')
+            {
+                ASSERT_TRUE(text[j] >= '2' && text[j] <= '9');
+            }
+            else
+            {
+                ASSERT_EQ(text[j], pattern[j]);
+            }
+        }
+    }
+}
+
+TEST_F(RandomDigitsTest, shouldReplaceCustomSymbol)
+{
+    const auto text = RandomDigits::fromTemplate("#-****", '*');
+
+    ASSERT_EQ(text.substr(0, 2), "#-");
+    ASSERT_TRUE(std::all_of(text.begin() + 2, text.end(), [](char digit) { return digit >= '0' && digit <= '9'; }));
+}
+
+TEST_F(RandomDigitsTest, shouldKeepSymbolDigitsAtOrAboveMinDigit)
+{
+    for (int i = 0; i < 100; i++)
+    {
+        const auto text = RandomDigits::fromTemplate("####-####", '#', '1');
+
+        ASSERT_EQ(text[4], '-');
+        ASSERT_EQ(text.find('0'), std::string::npos);
+    }
+}
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+#include "ArrayHelper.h"
+
+namespace faker
+{
+/**
+ * @brief Read-only view of strings stored in a StringPool.
+ *
+ * Every string is addressed by a 32-bit offset into the pool characters, where a length byte is followed by the
+ * string characters, so reading a string touches one offset and one run of characters.
+ */
+class StringPoolView
+{
+public:
+    constexpr StringPoolView(const char* characters, std::span<const std::uint32_t> offsets)
+        : characters{characters}, offsets{offsets}
+    {
+    }
+
+    constexpr std::string_view operator[](std::size_t index) const
+    {
+        const auto offset = offsets[index];
+
+        return {characters + offset + 1, static_cast<unsigned char>(characters[offset])};
+    }
+
+    constexpr std::size_t size() const
+    {
+        return offsets.size();
+    }
+
+    constexpr bool empty() const
+    {
+        return offsets.empty();
+    }
+
+    /**
+     * @return View of `count` strings starting at index `first`.
+     */
+    constexpr StringPoolView subview(std::size_t first, std::size_t count) const
+    {
+        return {characters, offsets.subspan(first, count)};
+    }
+
+private:
+    const char* characters;
+    std::span<const std::uint32_t> offsets;
+};
+
+/**
+ * @brief Strings of several lists packed into one contiguous block of characters.
+ *
+ * Strings repeated within or across lists are stored once. Pools are built at compile time with
+ * `StringPoolBuilder::build`.
+ */
+template <std::size_t CharacterCount, std::size_t StringCount, std::size_t ListCount>
+class StringPool
+{
+public:
+    constexpr StringPool(const std::array<char, CharacterCount>& characters,
+                         const std::array<std::uint32_t, StringCount>& offsets,
+                         const std::array<std::size_t, ListCount + 1>& listOffsets)
+        : characters{characters}, offsets{offsets}, listOffsets{listOffsets}
+    {
+    }
+
+    /**
+     * @return View of strings of all lists, in order of the lists given to the builder.
+     */
+    constexpr StringPoolView all() const
+    {
+        return {characters.data(), offsets};
+    }
+
+    /**
+     * @return View of strings of the list with given index.
+     */
+    constexpr StringPoolView list(std::size_t listIndex) const
+    {
+        return lists(listIndex, 1);
+    }
+
+    /**
+     * @return View of strings of `count` consecutive lists starting at list with index `firstList`.
+     */
+    constexpr StringPoolView lists(std::size_t firstList, std::size_t count) const
+    {
+        const auto first = listOffsets[firstList];
+
+        return all().subview(first, listOffsets[firstList + count] - first);
+    }
+
+    constexpr std::size_t memoryBytes() const
+    {
+        return sizeof(characters) + sizeof(offsets);
+    }
+
+private:
+    std::array<char, CharacterCount> characters;
+    std::array<std::uint32_t, StringCount> offsets;
+    std::array<std::size_t, ListCount + 1> listOffsets;
+};
+
+class StringPoolBuilder
+{
+public:
+    /**
+     * @brief Packs the given arrays of string views into a StringPool.
+     *
+     * Meant to be used in constant expressions, a string longer than 255 characters fails the compilation.
+     *
+     * @tparam Lists References to `std::array<std::string_view, N>` with static storage duration.
+     *
+     * @code
+     * constexpr auto pool = StringPoolBuilder::build<adjectives, nouns>();
+     * pool.list(1)[0] // first noun
+     * @endcode
+     */
+    template <const auto&... Lists>
+    static constexpr auto build()
+    {
+        constexpr auto strings = ArrayHelper::concat(Lists...);
+        constexpr auto firstOccurrences = findFirstOccurrences(strings);
+        constexpr auto characterCount = uniqueCharacterCount(strings, firstOccurrences);
+        constexpr auto stringCount = strings.size();
+
+        static_assert(characterCount <= std::numeric_limits<std::uint32_t>::max());
+
+        std::array<char, characterCount> characters{};
+        std::array<std::uint32_t, stringCount> offsets{};
+        std::size_t position = 0;
+
+        for (std::size_t i = 0; i < stringCount; i++)
+        {
+            if (firstOccurrences[i] != i)
+            {
+                offsets[i] = offsets[firstOccurrences[i]];
+
+                continue;
+            }
+
+            const auto string = strings[i];
+
+            if (string.size() > std::numeric_limits<unsigned char>::max())
+            {
+                throw std::length_error("String is too long to be stored in a string pool.");
+            }
+
+            offsets[i] = static_cast<std::uint32_t>(position);
+            characters[position++] = static_cast<char>(string.size());
+            std::ranges::copy(string, characters.begin() + static_cast<std::ptrdiff_t>(position));
+            position += string.size();
+        }
+
+        const std::array<std::size_t, sizeof...(Lists)> listSizes{Lists.size()...};
+
+        std::array<std::size_t, sizeof...(Lists) + 1> listOffsets{};
+
+        for (std::size_t i = 0; i < listSizes.size(); i++)
+        {
+            listOffsets[i + 1] = listOffsets[i] + listSizes[i];
+        }
+
+        return StringPool<characterCount, stringCount, sizeof...(Lists)>{characters, offsets, listOffsets};
+    }
+
+private:
+    /**
+     * @return Index of the first string equal to the string at each index.
+     *
+     * Strings are looked up in an open-addressing hash table rather than sorted, sorting thousands of strings
+     * exceeds compiler limits on constant evaluation.
+     */
+    template <std::size_t Size>
+    static constexpr std::array<std::size_t, Size>
+    findFirstOccurrences(const std::array<std::string_view, Size>& strings)
+    {
+        constexpr auto tableSize = std::bit_ceil(2 * Size + 1);
+        constexpr auto emptySlot = std::numeric_limits<std::size_t>::max();
+
+        std::array<std::size_t, tableSize> table{};
+        table.fill(emptySlot);
+
+        std::array<std::size_t, Size> firstOccurrences{};
+
+        for (std::size_t i = 0; i < Size; i++)
+        {
+            auto slot = static_cast<std::size_t>(hash(strings[i])) & (tableSize - 1);
+
+            while (table[slot] != emptySlot && strings[table[slot]] != strings[i])
+            {
+                slot = (slot + 1) & (tableSize - 1);
+            }
+
+            if (table[slot] == emptySlot)
+            {
+                table[slot] = i;
+            }
+
+            firstOccurrences[i] = table[slot];
+        }
+
+        return firstOccurrences;
+    }
+
+    template <std::size_t Size>
+    static constexpr std::size_t uniqueCharacterCount(const std::array<std::string_view, Size>& strings,
+                                                      const std::array<std::size_t, Size>& firstOccurrences)
+    {
+        std::size_t characterCount = 0;
+
+        for (std::size_t i = 0; i < Size; i++)
+        {
+            if (firstOccurrences[i] == i)
+            {
+                characterCount += strings[i].size() + 1;
+            }
+        }
+
+        return characterCount;
+    }
+
+    // FNV-1a
+    static constexpr std::uint64_t hash(std::string_view string)
+    {
+        std::uint64_t result = 14695981039346656037ull;
+
+        for (const auto character : string)
+        {
+            result = (result ^ static_cast<unsigned char>(character)) * 1099511628211ull;
+        }
+
+        return result;
+    }
+};
+}
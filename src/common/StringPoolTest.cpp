@@ -0,0 +1,68 @@
+#include "StringPool.h"
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+namespace
+{
+constexpr auto animals = std::to_array<std::string_view>({"dog", "horse", "cat", "dog"});
+constexpr auto colors = std::to_array<std::string_view>({"red", "horse", ""});
+constexpr auto pool = StringPoolBuilder::build<animals, colors>();
+}
+
+class StringPoolTest : public Test
+{
+public:
+};
+
+TEST_F(StringPoolTest, shouldKeepStringsOfAllListsInOrder)
+{
+    const auto strings = pool.all();
+
+    ASSERT_EQ(strings.size(), 7);
+    ASSERT_EQ(strings[0], "dog");
+    ASSERT_EQ(strings[1], "horse");
+    ASSERT_EQ(strings[2], "cat");
+    ASSERT_EQ(strings[3], "dog");
+    ASSERT_EQ(strings[4], "red");
+    ASSERT_EQ(strings[5], "horse");
+    ASSERT_EQ(strings[6], "");
+}
+
+TEST_F(StringPoolTest, shouldReturnStringsOfSingleList)
+{
+    const auto animalStrings = pool.list(0);
+    const auto colorStrings = pool.list(1);
+
+    ASSERT_EQ(animalStrings.size(), animals.size());
+    ASSERT_EQ(colorStrings.size(), colors.size());
+
+    for (std::size_t i = 0; i < animals.size(); i++)
+    {
+        ASSERT_EQ(animalStrings[i], animals[i]);
+    }
+
+    for (std::size_t i = 0; i < colors.size(); i++)
+    {
+        ASSERT_EQ(colorStrings[i], colors[i]);
+    }
+}
+
+TEST_F(StringPoolTest, shouldStoreRepeatedStringsOnce)
+{
+    const auto strings = pool.all();
+
+    ASSERT_EQ(strings[0].data(), strings[3].data());
+    ASSERT_EQ(strings[1].data(), strings[5].data());
+
+    // "dog", "horse", "cat", "red" and "" with one length byte each.
+    static_assert(pool.memoryBytes() == 3 + 5 + 3 + 3 + 0 + 5 + 7 * sizeof(std::uint32_t));
+}
+
+TEST_F(StringPoolTest, shouldBeUsableInConstantExpressions)
+{
+    static_assert(pool.list(1)[0] == "red");
+    static_assert(pool.lists(0, 2).size() == 7);
+}
@@ -1,11 +1,15 @@
 #include "PrecisionMapper.h"
 
+#include "../EnumMap.h"
+
 namespace faker
 {
-
-const std::map<Precision, unsigned> PrecisionMapper::precisionToDecimalPlacesMapping{
-    {Precision::ZeroDp, 0}, {Precision::OneDp, 1},  {Precision::TwoDp, 2}, {Precision::ThreeDp, 3},
-    {Precision::FourDp, 4}, {Precision::FiveDp, 5}, {Precision::SixDp, 6}, {Precision::SevenDp, 7}};
+namespace
+{
+constexpr auto precisionToDecimalPlacesMapping = EnumMapBuilder::build<Precision, unsigned, Precision::SevenDp>(
+    {{Precision::ZeroDp, 0}, {Precision::OneDp, 1},  {Precision::TwoDp, 2}, {Precision::ThreeDp, 3},
+     {Precision::FourDp, 4}, {Precision::FiveDp, 5}, {Precision::SixDp, 6}, {Precision::SevenDp, 7}});
+}
 
 unsigned PrecisionMapper::toDecimalPlaces(Precision precision)
 {
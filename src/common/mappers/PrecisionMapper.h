@@ -8,8 +8,5 @@ class PrecisionMapper
 {
 public:
     static unsigned toDecimalPlaces(Precision precision);
-
-private:
-    static const std::map<Precision, unsigned> precisionToDecimalPlacesMapping;
 };
 }
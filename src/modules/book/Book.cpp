@@ -1,37 +1,81 @@
 #include "faker-cxx/Book.h"
 
+#include "../../common/RandomDigits.h"
 #include "data/Authors.h"
 #include "data/Genres.h"
 #include "data/Publishers.h"
 #include "data/Titles.h"
 #include "faker-cxx/Helper.h"
-#include "faker-cxx/String.h"
 
 namespace faker
 {
 std::string Book::title()
 {
-    return Helper::arrayElement<std::string>(titles);
+    return std::string{titleView()};
+}
+
+std::string_view Book::titleView()
+{
+    return Helper::arrayElement<std::string_view>(titles);
+}
+
+Dictionary Book::titleDictionary()
+{
+    return Dictionary{titles};
 }
 
 std::string Book::genre()
 {
-    return Helper::arrayElement<std::string>(genres);
+    return std::string{genreView()};
+}
+
+std::string_view Book::genreView()
+{
+    return Helper::arrayElement<std::string_view>(genres);
+}
+
+Dictionary Book::genreDictionary()
+{
+    return Dictionary{genres};
 }
 
 std::string Book::author()
 {
-    return Helper::arrayElement<std::string>(authors);
+    return std::string{authorView()};
+}
+
+std::string_view Book::authorView()
+{
+    return Helper::arrayElement<std::string_view>(authors);
+}
+
+Dictionary Book::authorDictionary()
+{
+    return Dictionary{authors};
 }
 
 std::string Book::publisher()
 {
-    return Helper::arrayElement<std::string>(publishers);
+    return std::string{publisherView()};
+}
+
+std::string_view Book::publisherView()
+{
+    return Helper::arrayElement<std::string_view>(publishers);
+}
+
+Dictionary Book::publisherDictionary()
+{
+    return Dictionary{publishers};
 }
 
 std::string Book::isbn()
 {
-    return std::format("{}-{}-{}-{}-{}", String::numeric(3, false), String::numeric(2), String::numeric(2),
-                       String::numeric(5), String::numeric(1));
+    // The first digits of all groups but the first are never 0, marked by `@`.
+    auto isbn = RandomDigits::fromTemplate("###-@#-@#-@####-@", '@', '1');
+
+    RandomDigits::fillTemplate(isbn);
+
+    return isbn;
 }
 }
@@ -23,7 +23,7 @@ TEST_F(BookTest, shouldGenerateTitle)
     const auto bookTitle = Book::title();
 
     ASSERT_TRUE(std::any_of(titles.begin(), titles.end(),
-                            [bookTitle](const std::string& title) { return title == bookTitle; }));
+                            [bookTitle](std::string_view title) { return title == bookTitle; }));
 }
 
 TEST_F(BookTest, shouldGenerateGenre)
@@ -31,7 +31,15 @@ TEST_F(BookTest, shouldGenerateGenre)
     const auto bookGenre = Book::genre();
 
     ASSERT_TRUE(std::any_of(genres.begin(), genres.end(),
-                            [bookGenre](const std::string& genre) { return genre == bookGenre; }));
+                            [bookGenre](std::string_view genre) { return genre == bookGenre; }));
+}
+
+TEST_F(BookTest, shouldGenerateGenreView)
+{
+    const auto bookGenre = Book::genreView();
+
+    ASSERT_TRUE(std::any_of(genres.begin(), genres.end(),
+                            [bookGenre](std::string_view genre) { return genre == bookGenre; }));
 }
 
 TEST_F(BookTest, shouldGenerateAuthor)
@@ -39,7 +47,7 @@ TEST_F(BookTest, shouldGenerateAuthor)
     const auto bookAuthor = Book::author();
 
     ASSERT_TRUE(std::any_of(authors.begin(), authors.end(),
-                            [bookAuthor](const std::string& author) { return author == bookAuthor; }));
+                            [bookAuthor](std::string_view author) { return author == bookAuthor; }));
 }
 
 TEST_F(BookTest, shouldGeneratePublisher)
@@ -47,7 +55,7 @@ TEST_F(BookTest, shouldGeneratePublisher)
     const auto bookPublisher = Book::publisher();
 
     ASSERT_TRUE(std::any_of(publishers.begin(), publishers.end(),
-                            [bookPublisher](const std::string& publisher) { return publisher == bookPublisher; }));
+                            [bookPublisher](std::string_view publisher) { return publisher == bookPublisher; }));
 }
 
 TEST_F(BookTest, shouldGenerateIsbn)
@@ -62,4 +70,9 @@ TEST_F(BookTest, shouldGenerateIsbn)
     ASSERT_EQ(isbnNumbersGroups[2].size(), 2);
     ASSERT_EQ(isbnNumbersGroups[3].size(), 5);
     ASSERT_EQ(isbnNumbersGroups[4].size(), 1);
+
+    for (std::size_t i = 1; i < isbnNumbersGroups.size(); i++)
+    {
+        ASSERT_NE(isbnNumbersGroups[i][0], '0');
+    }
 }
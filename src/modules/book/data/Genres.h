@@ -1,33 +1,33 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> genres = {"Adventure stories",
-                                         "Classics",
-                                         "Crime",
-                                         "Fairy tales, fables, and folk tales",
-                                         "Fantasy",
-                                         "Historical fiction",
-                                         "Horror",
-                                         "Humour and satire",
-                                         "Literary fiction",
-                                         "Mystery",
-                                         "Poetry",
-                                         "Plays",
-                                         "Romance",
-                                         "Science fiction",
-                                         "Short stories",
-                                         "Thrillers",
-                                         "War",
-                                         "Women’s fiction",
-                                         "Young adult",
-                                         "Non-fiction",
-                                         "Autobiography and memoir",
-                                         "Biography",
-                                         "Essays",
-                                         "Non-fiction novel",
-                                         "Self-help"};
+inline constexpr auto genres = std::to_array<std::string_view>({"Adventure stories",
+                                                         "Classics",
+                                                         "Crime",
+                                                         "Fairy tales, fables, and folk tales",
+                                                         "Fantasy",
+                                                         "Historical fiction",
+                                                         "Horror",
+                                                         "Humour and satire",
+                                                         "Literary fiction",
+                                                         "Mystery",
+                                                         "Poetry",
+                                                         "Plays",
+                                                         "Romance",
+                                                         "Science fiction",
+                                                         "Short stories",
+                                                         "Thrillers",
+                                                         "War",
+                                                         "Women’s fiction",
+                                                         "Young adult",
+                                                         "Non-fiction",
+                                                         "Autobiography and memoir",
+                                                         "Biography",
+                                                         "Essays",
+                                                         "Non-fiction novel",
+                                                         "Self-help"});
 }
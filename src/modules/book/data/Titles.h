@@ -1,11 +1,11 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> titles = {
+inline constexpr auto titles = std::to_array<std::string_view>({
     "Romeo and Juliet",
     "Moby Dick",
     "A Room with a View",
@@ -105,5 +105,5 @@ const std::vector<std::string> titles = {
     "Josefine Mutzenbacher",
     "Heart of Darkness",
     "David Copperfield",
-    "Three Men in a Boat (To Say Nothing of the Dog)"};
+    "Three Men in a Boat (To Say Nothing of the Dog)"});
 }
@@ -1,8 +1,8 @@
 #include "faker-cxx/Color.h"
 
 #include <format>
-#include <sstream>
 
+#include "../../common/NumberFormatter.h"
 #include "data/Colors.h"
 #include "faker-cxx/Helper.h"
 #include "faker-cxx/Number.h"
@@ -12,7 +12,17 @@ namespace faker
 {
 std::string Color::name()
 {
-    return Helper::arrayElement<std::string>(colors);
+    return std::string{nameView()};
+}
+
+std::string_view Color::nameView()
+{
+    return Helper::arrayElement<std::string_view>(colors);
+}
+
+Dictionary Color::nameDictionary()
+{
+    return Dictionary{colors};
 }
 
 std::string Color::rgb(bool includeAlpha)
@@ -28,13 +38,7 @@ std::string Color::rgb(bool includeAlpha)
 
     const std::floating_point auto alpha = Number::decimal<double>(1);
 
-    std::stringstream ss;
-    ss << std::fixed;
-    ss.precision(2);
-    ss << alpha;
-    const auto formattedAlpha = ss.str();
-
-    return std::format("rgba({}, {}, {}, {})", red, green, blue, formattedAlpha);
+    return std::format("rgba({}, {}, {}, {})", red, green, blue, NumberFormatter::fixed(alpha, 2));
 }
 
 std::string Color::hex(HexCasing casing, HexPrefix prefix, bool includeAlpha)
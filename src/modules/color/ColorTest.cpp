@@ -21,7 +21,16 @@ TEST_F(ColorTest, shouldGenerateColorName)
     const auto generatedColorName = Color::name();
 
     ASSERT_TRUE(std::any_of(colors.begin(), colors.end(),
-                            [generatedColorName](const std::string& colorName)
+                            [generatedColorName](std::string_view colorName)
+                            { return colorName == generatedColorName; }));
+}
+
+TEST_F(ColorTest, shouldGenerateColorNameView)
+{
+    const auto generatedColorName = Color::nameView();
+
+    ASSERT_TRUE(std::any_of(colors.begin(), colors.end(),
+                            [generatedColorName](std::string_view colorName)
                             { return colorName == generatedColorName; }));
 }
 
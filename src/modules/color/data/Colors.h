@@ -1,11 +1,11 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> colors = {
+inline constexpr auto colors = std::to_array<std::string_view>({
     "red",
     "green",
     "blue",
@@ -37,5 +37,5 @@ const std::vector<std::string> colors = {
     "azure",
     "lavender",
     "silver",
-};
+});
 }
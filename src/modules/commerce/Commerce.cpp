@@ -11,7 +11,17 @@ namespace faker
 {
 std::string Commerce::department()
 {
-    return Helper::arrayElement<std::string>(departments);
+    return std::string{departmentView()};
+}
+
+std::string_view Commerce::departmentView()
+{
+    return Helper::arrayElement<std::string_view>(departments);
+}
+
+Dictionary Commerce::departmentDictionary()
+{
+    return Dictionary{departments};
 }
 
 std::string Commerce::price(double min, double max)
@@ -26,17 +36,47 @@ std::string Commerce::sku(unsigned int length)
 
 std::string Commerce::productAdjective()
 {
-    return Helper::arrayElement<std::string>(productAdjectives);
+    return std::string{productAdjectiveView()};
+}
+
+std::string_view Commerce::productAdjectiveView()
+{
+    return Helper::arrayElement<std::string_view>(productAdjectives);
+}
+
+Dictionary Commerce::productAdjectiveDictionary()
+{
+    return Dictionary{productAdjectives};
 }
 
 std::string Commerce::productMaterial()
 {
-    return Helper::arrayElement<std::string>(productMaterials);
+    return std::string{productMaterialView()};
+}
+
+std::string_view Commerce::productMaterialView()
+{
+    return Helper::arrayElement<std::string_view>(productMaterials);
+}
+
+Dictionary Commerce::productMaterialDictionary()
+{
+    return Dictionary{productMaterials};
 }
 
 std::string Commerce::productName()
 {
-    return Helper::arrayElement<std::string>(productNames);
+    return std::string{productNameView()};
+}
+
+std::string_view Commerce::productNameView()
+{
+    return Helper::arrayElement<std::string_view>(productNames);
+}
+
+Dictionary Commerce::productNameDictionary()
+{
+    return Dictionary{productNames};
 }
 
 std::string Commerce::productFullName()
@@ -21,7 +21,16 @@ TEST_F(CommerceTest, shouldGenerateCommerceDepartment)
     const auto generatedDepartment = Commerce::department();
 
     ASSERT_TRUE(std::any_of(departments.begin(), departments.end(),
-                            [generatedDepartment](const std::string& department)
+                            [generatedDepartment](std::string_view department)
+                            { return department == generatedDepartment; }));
+}
+
+TEST_F(CommerceTest, shouldGenerateCommerceDepartmentView)
+{
+    const auto generatedDepartment = Commerce::departmentView();
+
+    ASSERT_TRUE(std::any_of(departments.begin(), departments.end(),
+                            [generatedDepartment](std::string_view department)
                             { return department == generatedDepartment; }));
 }
 
@@ -80,13 +89,13 @@ TEST_F(CommerceTest, shouldGenerateProductFullName)
     const auto& generatedProductName = productFullNameElements[2];
 
     ASSERT_TRUE(std::any_of(productAdjectives.begin(), productAdjectives.end(),
-                            [generatedProductAdjective](const std::string& adjective)
+                            [generatedProductAdjective](std::string_view adjective)
                             { return adjective == generatedProductAdjective; }));
     ASSERT_TRUE(std::any_of(productMaterials.begin(), productMaterials.end(),
-                            [generatedProductMaterial](const std::string& material)
+                            [generatedProductMaterial](std::string_view material)
                             { return material == generatedProductMaterial; }));
     ASSERT_TRUE(std::any_of(productNames.begin(), productNames.end(),
-                            [generatedProductName](const std::string& productName)
+                            [generatedProductName](std::string_view productName)
                             { return productName == generatedProductName; }));
 }
 
@@ -95,7 +104,7 @@ TEST_F(CommerceTest, shouldGenerateProductAdjective)
     const auto generatedProductAdjective = Commerce::productAdjective();
 
     ASSERT_TRUE(std::any_of(productAdjectives.begin(), productAdjectives.end(),
-                            [generatedProductAdjective](const std::string& adjective)
+                            [generatedProductAdjective](std::string_view adjective)
                             { return adjective == generatedProductAdjective; }));
 }
 
@@ -104,7 +113,7 @@ TEST_F(CommerceTest, shouldGenerateProductMaterial)
     const auto generatedProductMaterial = Commerce::productMaterial();
 
     ASSERT_TRUE(std::any_of(productMaterials.begin(), productMaterials.end(),
-                            [generatedProductMaterial](const std::string& material)
+                            [generatedProductMaterial](std::string_view material)
                             { return material == generatedProductMaterial; }));
 }
 
@@ -113,6 +122,6 @@ TEST_F(CommerceTest, shouldGenerateProductName)
     const auto generatedProductName = Commerce::productName();
 
     ASSERT_TRUE(std::any_of(productNames.begin(), productNames.end(),
-                            [generatedProductName](const std::string& productName)
+                            [generatedProductName](std::string_view productName)
                             { return productName == generatedProductName; }));
 }
@@ -1,25 +1,25 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> departments = {
+inline constexpr auto departments = std::to_array<std::string_view>({
     "Books", "Movies",   "Music",  "Games",    "Electronics", "Computers", "Home", "Garden",
     "Tools", "Grocery",  "Health", "Beauty",   "Toys",        "Kids",      "Baby", "Clothing",
-    "Shoes", "Jewelery", "Sports", "Outdoors", "Automotive",  "Industrial"};
+    "Shoes", "Jewelery", "Sports", "Outdoors", "Automotive",  "Industrial"});
 
-const std::vector<std::string> productAdjectives = {
+inline constexpr auto productAdjectives = std::to_array<std::string_view>({
     "Small",       "Ergonomic", "Electronic", "Rustic",   "Intelligent", "Gorgeous", "Incredible", "Elegant",
     "Fantastic",   "Practical", "Modern",     "Recycled", "Sleek",       "Bespoke",  "Awesome",    "Generic",
-    "Handcrafted", "Handmade",  "Oriental",   "Licensed", "Luxurious",   "Refined",  "Unbranded",  "Tasty"};
+    "Handcrafted", "Handmade",  "Oriental",   "Licensed", "Luxurious",   "Refined",  "Unbranded",  "Tasty"});
 
-const std::vector<std::string> productMaterials = {"Steel",   "Bronze", "Wooden", "Concrete", "Plastic", "Cotton",
-                                                   "Granite", "Rubber", "Metal",  "Soft",     "Fresh",   "Frozen"};
+inline constexpr auto productMaterials = std::to_array<std::string_view>({
+    "Steel", "Bronze", "Wooden", "Concrete", "Plastic", "Cotton", "Granite", "Rubber", "Metal", "Soft", "Fresh",
+    "Frozen"});
 
-const std::vector<std::string> productNames = {"Chair",  "Car",    "Computer", "Keyboard", "Mouse",    "Bike",
-                                               "Ball",   "Gloves", "Pants",    "Shirt",    "Table",    "Shoes",
-                                               "Hat",    "Towels", "Soap",     "Tuna",     "Chicken",  "Fish",
-                                               "Cheese", "Bacon",  "Pizza",    "Salad",    "Sausages", "Chips"};
+inline constexpr auto productNames = std::to_array<std::string_view>({
+    "Chair", "Car", "Computer", "Keyboard", "Mouse", "Bike", "Ball", "Gloves", "Pants", "Shirt", "Table", "Shoes",
+    "Hat", "Towels", "Soap", "Tuna", "Chicken", "Fish", "Cheese", "Bacon", "Pizza", "Salad", "Sausages", "Chips"});
 }
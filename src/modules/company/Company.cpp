@@ -23,7 +23,7 @@ std::string Company::name()
     switch (Number::integer<int>(3))
     {
     case 0:
-        companyName = std::format("{} {}", Person::lastName(), Helper::arrayElement<std::string>(companySuffixes));
+        companyName = std::format("{} {}", Person::lastName(), std::string{Helper::arrayElement<std::string_view>(companySuffixes)});
         break;
     case 1:
         companyName = std::format("{} {} {}", Person::firstName(), Person::lastName(), Person::jobArea());
@@ -33,7 +33,7 @@ std::string Company::name()
         break;
     case 3:
         companyName = std::format("{} {} {} {}", Person::firstName(), Person::lastName(), Person::jobArea(),
-                                  Helper::arrayElement<std::string>(companySuffixes));
+                                  std::string{Helper::arrayElement<std::string_view>(companySuffixes)});
         break;
     }
 
@@ -42,12 +42,32 @@ std::string Company::name()
 
 std::string Company::type()
 {
-    return Helper::arrayElement<std::string>(companyTypes);
+    return std::string{typeView()};
+}
+
+std::string_view Company::typeView()
+{
+    return Helper::arrayElement<std::string_view>(companyTypes);
+}
+
+Dictionary Company::typeDictionary()
+{
+    return Dictionary{companyTypes};
 }
 
 std::string Company::industry()
 {
-    return Helper::arrayElement<std::string>(companyIndustries);
+    return std::string{industryView()};
+}
+
+std::string_view Company::industryView()
+{
+    return Helper::arrayElement<std::string_view>(companyIndustries);
+}
+
+Dictionary Company::industryDictionary()
+{
+    return Dictionary{companyIndustries};
 }
 
 std::string Company::buzzPhrase()
@@ -57,17 +77,47 @@ std::string Company::buzzPhrase()
 
 std::string Company::buzzAdjective()
 {
-    return Helper::arrayElement<std::string>(buzzAdjectives);
+    return std::string{buzzAdjectiveView()};
+}
+
+std::string_view Company::buzzAdjectiveView()
+{
+    return Helper::arrayElement<std::string_view>(buzzAdjectives);
+}
+
+Dictionary Company::buzzAdjectiveDictionary()
+{
+    return Dictionary{buzzAdjectives};
 }
 
 std::string Company::buzzNoun()
 {
-    return Helper::arrayElement<std::string>(buzzNouns);
+    return std::string{buzzNounView()};
+}
+
+std::string_view Company::buzzNounView()
+{
+    return Helper::arrayElement<std::string_view>(buzzNouns);
+}
+
+Dictionary Company::buzzNounDictionary()
+{
+    return Dictionary{buzzNouns};
 }
 
 std::string Company::buzzVerb()
 {
-    return Helper::arrayElement<std::string>(buzzVerbs);
+    return std::string{buzzVerbView()};
+}
+
+std::string_view Company::buzzVerbView()
+{
+    return Helper::arrayElement<std::string_view>(buzzVerbs);
+}
+
+Dictionary Company::buzzVerbDictionary()
+{
+    return Dictionary{buzzVerbs};
 }
 
 std::string Company::catchPhrase()
@@ -77,16 +127,46 @@ std::string Company::catchPhrase()
 
 std::string Company::catchPhraseAdjective()
 {
-    return Helper::arrayElement<std::string>(catchPhraseAdjectives);
+    return std::string{catchPhraseAdjectiveView()};
+}
+
+std::string_view Company::catchPhraseAdjectiveView()
+{
+    return Helper::arrayElement<std::string_view>(catchPhraseAdjectives);
+}
+
+Dictionary Company::catchPhraseAdjectiveDictionary()
+{
+    return Dictionary{catchPhraseAdjectives};
 }
 
 std::string Company::catchPhraseDescriptor()
 {
-    return Helper::arrayElement<std::string>(catchPhraseDescriptors);
+    return std::string{catchPhraseDescriptorView()};
+}
+
+std::string_view Company::catchPhraseDescriptorView()
+{
+    return Helper::arrayElement<std::string_view>(catchPhraseDescriptors);
+}
+
+Dictionary Company::catchPhraseDescriptorDictionary()
+{
+    return Dictionary{catchPhraseDescriptors};
 }
 
 std::string Company::catchPhraseNoun()
 {
-    return Helper::arrayElement<std::string>(catchPhraseNouns);
+    return std::string{catchPhraseNounView()};
+}
+
+std::string_view Company::catchPhraseNounView()
+{
+    return Helper::arrayElement<std::string_view>(catchPhraseNouns);
+}
+
+Dictionary Company::catchPhraseNounDictionary()
+{
+    return Dictionary{catchPhraseNouns};
 }
 }
@@ -33,7 +33,7 @@ TEST_F(CompanyTest, shouldGenerateCompanyName)
 
     const auto companyNameElements = StringHelper::split(companyName, " ");
 
-    std::vector<std::string> expectedFirstNames{firstNamesMales};
+    std::vector<std::string_view> expectedFirstNames(firstNamesMales.begin(), firstNamesMales.end());
 
     expectedFirstNames.insert(expectedFirstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
@@ -43,10 +43,10 @@ TEST_F(CompanyTest, shouldGenerateCompanyName)
         const auto& generatedCompanySuffix = companyNameElements[1];
 
         ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                                [generatedLastName](const std::string& lastName)
+                                [generatedLastName](std::string_view lastName)
                                 { return lastName == generatedLastName; }));
         ASSERT_TRUE(std::any_of(companySuffixes.begin(), companySuffixes.end(),
-                                [generatedCompanySuffix](const std::string& companySuffix)
+                                [generatedCompanySuffix](std::string_view companySuffix)
                                 { return companySuffix == generatedCompanySuffix; }));
     }
     else if (companyNameElements.size() == 3)
@@ -56,13 +56,13 @@ TEST_F(CompanyTest, shouldGenerateCompanyName)
         const auto& generatedJobArea = companyNameElements[2];
 
         ASSERT_TRUE(std::any_of(expectedFirstNames.begin(), expectedFirstNames.end(),
-                                [generatedFirstName](const std::string& firstName)
+                                [generatedFirstName](std::string_view firstName)
                                 { return firstName == generatedFirstName; }));
         ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                                [generatedLastName](const std::string& lastName)
+                                [generatedLastName](std::string_view lastName)
                                 { return lastName == generatedLastName; }));
         ASSERT_TRUE(std::any_of(jobAreas.begin(), jobAreas.end(),
-                                [generatedJobArea](const std::string& jobArea)
+                                [generatedJobArea](std::string_view jobArea)
                                 { return jobArea == generatedJobArea; }));
     }
     else if (companyNameElements.size() == 4)
@@ -73,16 +73,16 @@ TEST_F(CompanyTest, shouldGenerateCompanyName)
         const auto& lastElement = companyNameElements[3];
 
         ASSERT_TRUE(std::any_of(expectedFirstNames.begin(), expectedFirstNames.end(),
-                                [generatedFirstName](const std::string& firstName)
+                                [generatedFirstName](std::string_view firstName)
                                 { return firstName == generatedFirstName; }));
         ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                                [generatedLastName](const std::string& lastName)
+                                [generatedLastName](std::string_view lastName)
                                 { return lastName == generatedLastName; }));
         ASSERT_TRUE(std::any_of(jobAreas.begin(), jobAreas.end(),
-                                [generatedJobArea](const std::string& jobArea)
+                                [generatedJobArea](std::string_view jobArea)
                                 { return jobArea == generatedJobArea; }));
         ASSERT_TRUE(lastElement == "Services" || std::any_of(companySuffixes.begin(), companySuffixes.end(),
-                                                             [lastElement](const std::string& companySuffix)
+                                                             [lastElement](std::string_view companySuffix)
                                                              { return companySuffix == lastElement; }));
     }
 }
@@ -92,7 +92,7 @@ TEST_F(CompanyTest, shouldGenerateCompanyType)
     const auto generatedCompanyType = Company::type();
 
     ASSERT_TRUE(std::any_of(companyTypes.begin(), companyTypes.end(),
-                            [generatedCompanyType](const std::string& companyType)
+                            [generatedCompanyType](std::string_view companyType)
                             { return companyType == generatedCompanyType; }));
 }
 
@@ -101,7 +101,7 @@ TEST_F(CompanyTest, shouldGenerateCompanyIndustry)
     const auto generatedCompanyIndustry = Company::industry();
 
     ASSERT_TRUE(std::any_of(companyIndustries.begin(), companyIndustries.end(),
-                            [generatedCompanyIndustry](const std::string& companyIndustry)
+                            [generatedCompanyIndustry](std::string_view companyIndustry)
                             { return companyIndustry == generatedCompanyIndustry; }));
 }
 
@@ -110,13 +110,13 @@ TEST_F(CompanyTest, shouldGenerateBuzzPhrase)
     const auto buzzPhrase = Company::buzzPhrase();
 
     ASSERT_TRUE(std::any_of(buzzVerbs.begin(), buzzVerbs.end(),
-                            [buzzPhrase](const std::string& buzzVerb)
+                            [buzzPhrase](std::string_view buzzVerb)
                             { return buzzPhrase.find(buzzVerb) != std::string::npos; }));
     ASSERT_TRUE(std::any_of(buzzAdjectives.begin(), buzzAdjectives.end(),
-                            [buzzPhrase](const std::string& buzzAdjective)
+                            [buzzPhrase](std::string_view buzzAdjective)
                             { return buzzPhrase.find(buzzAdjective) != std::string::npos; }));
     ASSERT_TRUE(std::any_of(buzzNouns.begin(), buzzNouns.end(),
-                            [buzzPhrase](const std::string& buzzNoun)
+                            [buzzPhrase](std::string_view buzzNoun)
                             { return buzzPhrase.find(buzzNoun) != std::string::npos; }));
 }
 
@@ -125,7 +125,7 @@ TEST_F(CompanyTest, shouldGenerateBuzzVerb)
     const auto generatedBuzzVerb = Company::buzzVerb();
 
     ASSERT_TRUE(std::any_of(buzzVerbs.begin(), buzzVerbs.end(),
-                            [generatedBuzzVerb](const std::string& buzzVerb)
+                            [generatedBuzzVerb](std::string_view buzzVerb)
                             { return buzzVerb == generatedBuzzVerb; }));
 }
 
@@ -134,7 +134,7 @@ TEST_F(CompanyTest, shouldGenerateBuzzAdjective)
     const auto generatedBuzzAdjective = Company::buzzAdjective();
 
     ASSERT_TRUE(std::any_of(buzzAdjectives.begin(), buzzAdjectives.end(),
-                            [generatedBuzzAdjective](const std::string& buzzAdjective)
+                            [generatedBuzzAdjective](std::string_view buzzAdjective)
                             { return buzzAdjective == generatedBuzzAdjective; }));
 }
 
@@ -143,7 +143,16 @@ TEST_F(CompanyTest, shouldGenerateBuzzNoun)
     const auto generatedBuzzNoun = Company::buzzNoun();
 
     ASSERT_TRUE(std::any_of(buzzNouns.begin(), buzzNouns.end(),
-                            [generatedBuzzNoun](const std::string& buzzNoun)
+                            [generatedBuzzNoun](std::string_view buzzNoun)
+                            { return buzzNoun == generatedBuzzNoun; }));
+}
+
+TEST_F(CompanyTest, shouldGenerateBuzzNounView)
+{
+    const auto generatedBuzzNoun = Company::buzzNounView();
+
+    ASSERT_TRUE(std::any_of(buzzNouns.begin(), buzzNouns.end(),
+                            [generatedBuzzNoun](std::string_view buzzNoun)
                             { return buzzNoun == generatedBuzzNoun; }));
 }
 
@@ -152,13 +161,13 @@ TEST_F(CompanyTest, shouldGenerateCatchPhrase)
     const auto catchPhrase = Company::catchPhrase();
 
     ASSERT_TRUE(std::any_of(catchPhraseAdjectives.begin(), catchPhraseAdjectives.end(),
-                            [catchPhrase](const std::string& catchPhraseAdjective)
+                            [catchPhrase](std::string_view catchPhraseAdjective)
                             { return catchPhrase.find(catchPhraseAdjective) != std::string::npos; }));
     ASSERT_TRUE(std::any_of(catchPhraseDescriptors.begin(), catchPhraseDescriptors.end(),
-                            [catchPhrase](const std::string& catchPhraseDescriptor)
+                            [catchPhrase](std::string_view catchPhraseDescriptor)
                             { return catchPhrase.find(catchPhraseDescriptor) != std::string::npos; }));
     ASSERT_TRUE(std::any_of(catchPhraseNouns.begin(), catchPhraseNouns.end(),
-                            [catchPhrase](const std::string& catchPhraseNoun)
+                            [catchPhrase](std::string_view catchPhraseNoun)
                             { return catchPhrase.find(catchPhraseNoun) != std::string::npos; }));
 }
 
@@ -167,7 +176,7 @@ TEST_F(CompanyTest, shouldGenerateCatchPhraseAdjective)
     const auto generatedCatchPhraseAdjective = Company::catchPhraseAdjective();
 
     ASSERT_TRUE(std::any_of(catchPhraseAdjectives.begin(), catchPhraseAdjectives.end(),
-                            [generatedCatchPhraseAdjective](const std::string& catchPhraseAdjective)
+                            [generatedCatchPhraseAdjective](std::string_view catchPhraseAdjective)
                             { return catchPhraseAdjective == generatedCatchPhraseAdjective; }));
 }
 
@@ -176,7 +185,7 @@ TEST_F(CompanyTest, shouldGenerateCatchPhraseDescriptor)
     const auto generatedCatchPhraseDescriptor = Company::catchPhraseDescriptor();
 
     ASSERT_TRUE(std::any_of(catchPhraseDescriptors.begin(), catchPhraseDescriptors.end(),
-                            [generatedCatchPhraseDescriptor](const std::string& catchPhraseDescriptor)
+                            [generatedCatchPhraseDescriptor](std::string_view catchPhraseDescriptor)
                             { return catchPhraseDescriptor == generatedCatchPhraseDescriptor; }));
 }
 
@@ -185,6 +194,6 @@ TEST_F(CompanyTest, shouldGenerateCatchPhraseNoun)
     const auto generatedCatchPhraseNoun = Company::catchPhraseNoun();
 
     ASSERT_TRUE(std::any_of(catchPhraseNouns.begin(), catchPhraseNouns.end(),
-                            [generatedCatchPhraseNoun](const std::string& catchPhraseNoun)
+                            [generatedCatchPhraseNoun](std::string_view catchPhraseNoun)
                             { return catchPhraseNoun == generatedCatchPhraseNoun; }));
 }
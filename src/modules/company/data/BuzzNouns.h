@@ -1,49 +1,49 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> buzzNouns = {"synergies",
-                                            "paradigms",
-                                            "markets",
-                                            "partnerships",
-                                            "infrastructures",
-                                            "platforms",
-                                            "initiatives",
-                                            "channels",
-                                            "eyeballs",
-                                            "communities",
-                                            "ROI",
-                                            "solutions",
-                                            "action-items",
-                                            "portals",
-                                            "niches",
-                                            "technologies",
-                                            "content",
-                                            "supply-chains",
-                                            "convergence",
-                                            "relationships",
-                                            "architectures",
-                                            "interfaces",
-                                            "e-markets",
-                                            "e-commerce",
-                                            "systems",
-                                            "bandwidth",
-                                            "models",
-                                            "mindshare",
-                                            "deliverables",
-                                            "users",
-                                            "schemas",
-                                            "networks",
-                                            "applications",
-                                            "metrics",
-                                            "e-business",
-                                            "functionalities",
-                                            "experiences",
-                                            "web services",
-                                            "methodologies",
-                                            "blockchains"
-                                            "lifetime value"};
+inline constexpr auto buzzNouns = std::to_array<std::string_view>({"synergies",
+                                                            "paradigms",
+                                                            "markets",
+                                                            "partnerships",
+                                                            "infrastructures",
+                                                            "platforms",
+                                                            "initiatives",
+                                                            "channels",
+                                                            "eyeballs",
+                                                            "communities",
+                                                            "ROI",
+                                                            "solutions",
+                                                            "action-items",
+                                                            "portals",
+                                                            "niches",
+                                                            "technologies",
+                                                            "content",
+                                                            "supply-chains",
+                                                            "convergence",
+                                                            "relationships",
+                                                            "architectures",
+                                                            "interfaces",
+                                                            "e-markets",
+                                                            "e-commerce",
+                                                            "systems",
+                                                            "bandwidth",
+                                                            "models",
+                                                            "mindshare",
+                                                            "deliverables",
+                                                            "users",
+                                                            "schemas",
+                                                            "networks",
+                                                            "applications",
+                                                            "metrics",
+                                                            "e-business",
+                                                            "functionalities",
+                                                            "experiences",
+                                                            "web services",
+                                                            "methodologies",
+                                                            "blockchains"
+                                                            "lifetime value"});
 }
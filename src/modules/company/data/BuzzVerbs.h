@@ -1,11 +1,11 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> buzzVerbs = {
+inline constexpr auto buzzVerbs = std::to_array<std::string_view>({
     "implement",     "utilize",     "integrate",       "streamline",     "optimize",       "evolve",     "transform",
     "embrace",       "enable",      "orchestrate",     "leverage",       "reinvent",       "aggregate",  "architect",
     "enhance",       "incentivize", "morph",           "empower",        "envisioneer",    "monetize",   "harness",
@@ -14,5 +14,5 @@ const std::vector<std::string> buzzVerbs = {
     "engage",        "maximize",    "benchmark",       "expedite",       "reintermediate", "whiteboard", "visualize",
     "repurpose",     "innovate",    "scale",           "unleash",        "drive",          "extend",     "engineer",
     "revolutionize", "generate",    "exploit",         "transition",     "e-enable",       "iterate",    "cultivate",
-    "matrix",        "productize",  "redefine",        "recontextualize"};
+    "matrix",        "productize",  "redefine",        "recontextualize"});
 }
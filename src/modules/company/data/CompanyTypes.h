@@ -2,12 +2,12 @@
 
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> companyTypes = {
+inline constexpr auto companyTypes = std::to_array<std::string_view>({
     "Public Company", "Educational Institution", "Self-Employed",  "Government Agency",
-    "Nonprofit",      "Sole Proprietorship",     "Privately Held", "Partnership"};
+    "Nonprofit",      "Sole Proprietorship",     "Privately Held", "Partnership"});
 }
@@ -1,155 +1,155 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> companyIndustries = {"Defense & Space",
-                                                    "Computer Hardware",
-                                                    "Computer Software",
-                                                    "Computer Networking",
-                                                    "Internet",
-                                                    "Semiconductors",
-                                                    "Telecommunications",
-                                                    "Law Practice",
-                                                    "Legal Services",
-                                                    "Management Consulting",
-                                                    "Biotechnology",
-                                                    "Medical Practice",
-                                                    "Hospital & Health Care",
-                                                    "Pharmaceuticals",
-                                                    "Veterinary",
-                                                    "Medical Devices",
-                                                    "Cosmetics",
-                                                    "Apparel & Fashion",
-                                                    "Sporting Goods",
-                                                    "Tobacco",
-                                                    "Supermarkets",
-                                                    "Food Production",
-                                                    "Consumer Electronics",
-                                                    "Consumer Goods",
-                                                    "Furniture",
-                                                    "Retail",
-                                                    "Entertainment",
-                                                    "Gambling & Casinos",
-                                                    "Leisure, Travel & Tourism",
-                                                    "Hospitality",
-                                                    "Restaurants",
-                                                    "Sports",
-                                                    "Food & Beverages",
-                                                    "Motion Pictures and Film",
-                                                    "Broadcast Media",
-                                                    "Museums and Institutions",
-                                                    "Fine Art",
-                                                    "Performing Arts",
-                                                    "Recreational Facilities and Services",
-                                                    "Banking",
-                                                    "Insurance",
-                                                    "Financial Services",
-                                                    "Real Estate",
-                                                    "Investment Banking",
-                                                    "Investment Management",
-                                                    "Accounting",
-                                                    "Construction",
-                                                    "Building Materials",
-                                                    "Architecture & Planning",
-                                                    "Civil Engineering",
-                                                    "Aviation & Aerospace",
-                                                    "Automotive",
-                                                    "Chemicals",
-                                                    "Machinery",
-                                                    "Mining & Metals",
-                                                    "Oil & Energy",
-                                                    "Shipbuilding",
-                                                    "Utilities",
-                                                    "Textiles",
-                                                    "Paper & Forest Products",
-                                                    "Railroad Manufacture",
-                                                    "Farming",
-                                                    "Ranching",
-                                                    "Dairy",
-                                                    "Fishery",
-                                                    "Primary / Secondary Education",
-                                                    "Higher Education",
-                                                    "Education Management",
-                                                    "Research",
-                                                    "Military",
-                                                    "Legislative Office",
-                                                    "Judiciary",
-                                                    "International Affairs",
-                                                    "Government Administration",
-                                                    "Executive Office",
-                                                    "Law Enforcement",
-                                                    "Public Safety",
-                                                    "Public Policy",
-                                                    "Marketing and Advertising",
-                                                    "Newspapers",
-                                                    "Publishing",
-                                                    "Printing",
-                                                    "Information Services",
-                                                    "Libraries",
-                                                    "Environmental Services",
-                                                    "Package / Freight Delivery",
-                                                    "Individual & Family Services",
-                                                    "Religious Institutions",
-                                                    "Civic & Social Organization",
-                                                    "Consumer Services",
-                                                    "Transportationg / Trucking / Railroad",
-                                                    "Warehousing",
-                                                    "Airlines / Aviation",
-                                                    "Maritime",
-                                                    "Information Technology and Services",
-                                                    "Market Research",
-                                                    "Public Relations and Communications",
-                                                    "Design",
-                                                    "Nonprofit Organization Management",
-                                                    "Fund-Raising",
-                                                    "Program Development",
-                                                    "Writing and Editing",
-                                                    "Staffing and Recruiting",
-                                                    "Professional Training & Coaching",
-                                                    "Venture Capital & Private Equity",
-                                                    "Political Organization",
-                                                    "Translation and Localization",
-                                                    "Computer Games",
-                                                    "Events Services",
-                                                    "Arts and Crafts",
-                                                    "Electrical / Electronic Manufacturing",
-                                                    "Online Media",
-                                                    "Nanotechnology",
-                                                    "Music",
-                                                    "Logistics and Supply Chain",
-                                                    "Plastics",
-                                                    "Computer & Network Security",
-                                                    "Wireless",
-                                                    "Alternative Dispute Resolution",
-                                                    "Security and Investigations",
-                                                    "Facilities Services",
-                                                    "Outsourcing / Offshoring",
-                                                    "Health, Wellness and Fitness",
-                                                    "Alternative Medicine",
-                                                    "Media Production",
-                                                    "Animation",
-                                                    "Commercial Real Estate",
-                                                    "Capital Markets",
-                                                    "Think Tanks",
-                                                    "Philanthropy",
-                                                    "E-Learning",
-                                                    "Wholesale",
-                                                    "Import and Export",
-                                                    "Mechanical or Industrial Engineering",
-                                                    "Photography",
-                                                    "Human Resources",
-                                                    "Business Supplies and Equipment",
-                                                    "Mental Health Care",
-                                                    "Graphic Design",
-                                                    "International Trade and Development",
-                                                    "Wine and Spirits",
-                                                    "Luxury Goods & Jewelry",
-                                                    "Renewables & Environment",
-                                                    "Glass, Ceramics & Concrete",
-                                                    "Packaging and Containers",
-                                                    "Industrial Automation",
-                                                    "Government Relations"};
+inline constexpr auto companyIndustries = std::to_array<std::string_view>({"Defense & Space",
+                                                                    "Computer Hardware",
+                                                                    "Computer Software",
+                                                                    "Computer Networking",
+                                                                    "Internet",
+                                                                    "Semiconductors",
+                                                                    "Telecommunications",
+                                                                    "Law Practice",
+                                                                    "Legal Services",
+                                                                    "Management Consulting",
+                                                                    "Biotechnology",
+                                                                    "Medical Practice",
+                                                                    "Hospital & Health Care",
+                                                                    "Pharmaceuticals",
+                                                                    "Veterinary",
+                                                                    "Medical Devices",
+                                                                    "Cosmetics",
+                                                                    "Apparel & Fashion",
+                                                                    "Sporting Goods",
+                                                                    "Tobacco",
+                                                                    "Supermarkets",
+                                                                    "Food Production",
+                                                                    "Consumer Electronics",
+                                                                    "Consumer Goods",
+                                                                    "Furniture",
+                                                                    "Retail",
+                                                                    "Entertainment",
+                                                                    "Gambling & Casinos",
+                                                                    "Leisure, Travel & Tourism",
+                                                                    "Hospitality",
+                                                                    "Restaurants",
+                                                                    "Sports",
+                                                                    "Food & Beverages",
+                                                                    "Motion Pictures and Film",
+                                                                    "Broadcast Media",
+                                                                    "Museums and Institutions",
+                                                                    "Fine Art",
+                                                                    "Performing Arts",
+                                                                    "Recreational Facilities and Services",
+                                                                    "Banking",
+                                                                    "Insurance",
+                                                                    "Financial Services",
+                                                                    "Real Estate",
+                                                                    "Investment Banking",
+                                                                    "Investment Management",
+                                                                    "Accounting",
+                                                                    "Construction",
+                                                                    "Building Materials",
+                                                                    "Architecture & Planning",
+                                                                    "Civil Engineering",
+                                                                    "Aviation & Aerospace",
+                                                                    "Automotive",
+                                                                    "Chemicals",
+                                                                    "Machinery",
+                                                                    "Mining & Metals",
+                                                                    "Oil & Energy",
+                                                                    "Shipbuilding",
+                                                                    "Utilities",
+                                                                    "Textiles",
+                                                                    "Paper & Forest Products",
+                                                                    "Railroad Manufacture",
+                                                                    "Farming",
+                                                                    "Ranching",
+                                                                    "Dairy",
+                                                                    "Fishery",
+                                                                    "Primary / Secondary Education",
+                                                                    "Higher Education",
+                                                                    "Education Management",
+                                                                    "Research",
+                                                                    "Military",
+                                                                    "Legislative Office",
+                                                                    "Judiciary",
+                                                                    "International Affairs",
+                                                                    "Government Administration",
+                                                                    "Executive Office",
+                                                                    "Law Enforcement",
+                                                                    "Public Safety",
+                                                                    "Public Policy",
+                                                                    "Marketing and Advertising",
+                                                                    "Newspapers",
+                                                                    "Publishing",
+                                                                    "Printing",
+                                                                    "Information Services",
+                                                                    "Libraries",
+                                                                    "Environmental Services",
+                                                                    "Package / Freight Delivery",
+                                                                    "Individual & Family Services",
+                                                                    "Religious Institutions",
+                                                                    "Civic & Social Organization",
+                                                                    "Consumer Services",
+                                                                    "Transportationg / Trucking / Railroad",
+                                                                    "Warehousing",
+                                                                    "Airlines / Aviation",
+                                                                    "Maritime",
+                                                                    "Information Technology and Services",
+                                                                    "Market Research",
+                                                                    "Public Relations and Communications",
+                                                                    "Design",
+                                                                    "Nonprofit Organization Management",
+                                                                    "Fund-Raising",
+                                                                    "Program Development",
+                                                                    "Writing and Editing",
+                                                                    "Staffing and Recruiting",
+                                                                    "Professional Training & Coaching",
+                                                                    "Venture Capital & Private Equity",
+                                                                    "Political Organization",
+                                                                    "Translation and Localization",
+                                                                    "Computer Games",
+                                                                    "Events Services",
+                                                                    "Arts and Crafts",
+                                                                    "Electrical / Electronic Manufacturing",
+                                                                    "Online Media",
+                                                                    "Nanotechnology",
+                                                                    "Music",
+                                                                    "Logistics and Supply Chain",
+                                                                    "Plastics",
+                                                                    "Computer & Network Security",
+                                                                    "Wireless",
+                                                                    "Alternative Dispute Resolution",
+                                                                    "Security and Investigations",
+                                                                    "Facilities Services",
+                                                                    "Outsourcing / Offshoring",
+                                                                    "Health, Wellness and Fitness",
+                                                                    "Alternative Medicine",
+                                                                    "Media Production",
+                                                                    "Animation",
+                                                                    "Commercial Real Estate",
+                                                                    "Capital Markets",
+                                                                    "Think Tanks",
+                                                                    "Philanthropy",
+                                                                    "E-Learning",
+                                                                    "Wholesale",
+                                                                    "Import and Export",
+                                                                    "Mechanical or Industrial Engineering",
+                                                                    "Photography",
+                                                                    "Human Resources",
+                                                                    "Business Supplies and Equipment",
+                                                                    "Mental Health Care",
+                                                                    "Graphic Design",
+                                                                    "International Trade and Development",
+                                                                    "Wine and Spirits",
+                                                                    "Luxury Goods & Jewelry",
+                                                                    "Renewables & Environment",
+                                                                    "Glass, Ceramics & Concrete",
+                                                                    "Packaging and Containers",
+                                                                    "Industrial Automation",
+                                                                    "Government Relations"});
 }
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> companySuffixes{"Inc", "LLC", "Group"};
+inline constexpr auto companySuffixes = std::to_array<std::string_view>({"Inc", "LLC", "Group"});
 }
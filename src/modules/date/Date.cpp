@@ -1,7 +1,10 @@
 #include "faker-cxx/Date.h"
 
+#include <atomic>
 #include <chrono>
+#include <limits>
 
+#include "../../common/DateHelper.h"
 #include "data/MonthNames.h"
 #include "data/WeekdayNames.h"
 #include "faker-cxx/Helper.h"
@@ -11,119 +14,204 @@ namespace faker
 {
 namespace
 {
-std::string betweenDate(
-    std::chrono::time_point<std::chrono::system_clock, std::chrono::duration<int64_t, std::ratio<1, 1000000000>>> from,
-    std::chrono::time_point<std::chrono::system_clock, std::chrono::duration<int64_t, std::ratio<1, 1000000000>>> to)
+const auto numberOfHoursInDay = 24;
+const auto numberOfDaysInYear = 365;
+const auto numberOfSecondsInDay = 86400;
+
+constexpr auto unpinnedReferenceDate = std::numeric_limits<std::chrono::sys_seconds::rep>::min();
+
+std::atomic<std::chrono::sys_seconds::rep> pinnedReferenceDate{unpinnedReferenceDate};
+
+std::chrono::sys_seconds betweenTimestamp(std::chrono::sys_seconds from, std::chrono::sys_seconds to)
 {
     if (from > to)
     {
         throw std::runtime_error{std::format("Start date is greater than end date. {{from: {}, to: {}}}", from, to)};
     }
 
-    const auto size = std::chrono::duration_cast<std::chrono::seconds>(to - from).count();
+    const auto size = (to - from).count();
 
-    const auto randomDateWithinRange = from + std::chrono::seconds{Number::integer(size - 1)};
+    return from + std::chrono::seconds{Number::integer(size - 1)};
+}
 
-    return std::format("{:%FT%TZ}", std::chrono::floor<std::chrono::seconds>(randomDateWithinRange));
+std::chrono::hours yearsDuration(int years)
+{
+    return std::chrono::hours{numberOfHoursInDay * numberOfDaysInYear * years};
 }
 
-const auto numberOfHoursInDay = 24;
-const auto numberOfDaysInYear = 365;
+std::chrono::seconds yearStart(int year)
+{
+    return std::chrono::seconds{DateHelper::daysFromCivil(year, 1, 1) * numberOfSecondsInDay};
+}
+
+std::chrono::hours daysDuration(int days)
+{
+    return std::chrono::hours{numberOfHoursInDay * days};
+}
 }
 
 std::string Date::futureDate(int years)
 {
-    const auto startDate = std::chrono::system_clock::now() + std::chrono::hours{1};
+    return DateHelper::isoDateTime(futureTimestamp(years));
+}
+
+std::chrono::sys_seconds Date::futureTimestamp(int years)
+{
+    const auto startDate = referenceDate() + std::chrono::hours{1};
 
-    const auto endDate = startDate + std::chrono::hours{numberOfHoursInDay * numberOfDaysInYear * years};
+    const auto endDate = startDate + yearsDuration(years);
 
-    return betweenDate(startDate, endDate);
+    return betweenTimestamp(startDate, endDate);
 }
 
 std::string Date::pastDate(int years)
 {
-    const auto startDate =
-        std::chrono::system_clock::now() - std::chrono::hours{numberOfHoursInDay * numberOfDaysInYear * years};
+    return DateHelper::isoDateTime(pastTimestamp(years));
+}
 
-    const auto endDate = std::chrono::system_clock::now() - std::chrono::hours{1};
+std::chrono::sys_seconds Date::pastTimestamp(int years)
+{
+    const auto now = referenceDate();
 
-    return betweenDate(startDate, endDate);
+    return betweenTimestamp(now - yearsDuration(years), now - std::chrono::hours{1});
 }
 
 std::string Date::soonDate(int days)
 {
-    const auto startDate = std::chrono::system_clock::now() + std::chrono::hours{1};
+    return DateHelper::isoDateTime(soonTimestamp(days));
+}
+
+std::chrono::sys_seconds Date::soonTimestamp(int days)
+{
+    const auto startDate = referenceDate() + std::chrono::hours{1};
 
-    const auto endDate = startDate + std::chrono::hours{numberOfHoursInDay * days};
+    const auto endDate = startDate + daysDuration(days);
 
-    return betweenDate(startDate, endDate);
+    return betweenTimestamp(startDate, endDate);
 }
 
 std::string Date::recentDate(int days)
 {
-    const auto startDate = std::chrono::system_clock::now() - std::chrono::hours{numberOfHoursInDay * days};
+    return DateHelper::isoDateTime(recentTimestamp(days));
+}
 
-    const auto endDate = std::chrono::system_clock::now() - std::chrono::hours{1};
+std::chrono::sys_seconds Date::recentTimestamp(int days)
+{
+    const auto now = referenceDate();
 
-    return betweenDate(startDate, endDate);
+    return betweenTimestamp(now - daysDuration(days), now - std::chrono::hours{1});
 }
 
 std::string Date::birthdateByAge(int minAge, int maxAge)
 {
-    const auto startDate =
-        std::chrono::system_clock::now() - std::chrono::hours{numberOfHoursInDay * numberOfDaysInYear * maxAge};
+    return DateHelper::isoDateTime(birthdateByAgeTimestamp(minAge, maxAge));
+}
 
-    const auto endDate =
-        std::chrono::system_clock::now() - std::chrono::hours{numberOfHoursInDay * numberOfDaysInYear * minAge};
+std::chrono::sys_seconds Date::birthdateByAgeTimestamp(int minAge, int maxAge)
+{
+    const auto now = referenceDate();
 
-    return betweenDate(startDate, endDate);
+    return betweenTimestamp(now - yearsDuration(maxAge), now - yearsDuration(minAge));
 }
 
 std::string Date::birthdateByYear(int minYear, int maxYear)
 {
-    tm startDateTime{};
-    startDateTime.tm_year = minYear - 1900;
-    startDateTime.tm_mon = 0;
-    startDateTime.tm_mday = 0;
-    startDateTime.tm_hour = 0;
-    startDateTime.tm_min = 0;
-    startDateTime.tm_sec = 0;
-    startDateTime.tm_isdst = -1;
+    return DateHelper::isoDateTime(birthdateByYearTimestamp(minYear, maxYear));
+}
+
+std::chrono::sys_seconds Date::birthdateByYearTimestamp(int minYear, int maxYear)
+{
+    const auto startDate = std::chrono::sys_seconds{yearStart(minYear)};
 
-    const auto startDate = std::chrono::system_clock::from_time_t(mktime(&startDateTime));
+    // Exclusive end, so that the last second of the max year can be generated.
+    const auto endDate = std::chrono::sys_seconds{yearStart(maxYear + 1)};
 
-    tm endDateTime{};
-    endDateTime.tm_year = maxYear - 1900;
-    endDateTime.tm_mon = 11;
-    endDateTime.tm_mday = 31;
-    endDateTime.tm_hour = 23;
-    endDateTime.tm_min = 59;
-    endDateTime.tm_sec = 59;
-    endDateTime.tm_isdst = -1;
+    return betweenTimestamp(startDate, endDate);
+}
 
-    const auto endDate = std::chrono::system_clock::from_time_t(mktime(&endDateTime));
+void Date::pinReferenceDate(std::optional<std::chrono::sys_seconds> referenceDate)
+{
+    const auto pinnedDate =
+        referenceDate ? *referenceDate : std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
 
-    return betweenDate(startDate, endDate);
+    pinnedReferenceDate.store(pinnedDate.time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+void Date::unpinReferenceDate()
+{
+    pinnedReferenceDate.store(unpinnedReferenceDate, std::memory_order_relaxed);
+}
+
+std::chrono::sys_seconds Date::referenceDate()
+{
+    const auto pinnedDate = pinnedReferenceDate.load(std::memory_order_relaxed);
+
+    if (pinnedDate != unpinnedReferenceDate)
+    {
+        return std::chrono::sys_seconds{std::chrono::seconds{pinnedDate}};
+    }
+
+    return std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
 }
 
 std::string Date::weekdayName()
 {
-    return Helper::arrayElement<std::string>(weekdayNames);
+    return std::string{weekdayNameView()};
+}
+
+std::string_view Date::weekdayNameView()
+{
+    return Helper::arrayElement<std::string_view>(weekdayNames);
+}
+
+Dictionary Date::weekdayNameDictionary()
+{
+    return Dictionary{weekdayNames};
 }
 
 std::string Date::weekdayAbbreviatedName()
 {
-    return Helper::arrayElement<std::string>(weekdayAbbreviatedNames);
+    return std::string{weekdayAbbreviatedNameView()};
+}
+
+std::string_view Date::weekdayAbbreviatedNameView()
+{
+    return Helper::arrayElement<std::string_view>(weekdayAbbreviatedNames);
+}
+
+Dictionary Date::weekdayAbbreviatedNameDictionary()
+{
+    return Dictionary{weekdayAbbreviatedNames};
 }
 
 std::string Date::monthName()
 {
-    return Helper::arrayElement<std::string>(monthNames);
+    return std::string{monthNameView()};
+}
+
+std::string_view Date::monthNameView()
+{
+    return Helper::arrayElement<std::string_view>(monthNames);
+}
+
+Dictionary Date::monthNameDictionary()
+{
+    return Dictionary{monthNames};
 }
 
 std::string Date::monthAbbreviatedName()
 {
-    return Helper::arrayElement<std::string>(monthAbbreviatedNames);
+    return std::string{monthAbbreviatedNameView()};
+}
+
+std::string_view Date::monthAbbreviatedNameView()
+{
+    return Helper::arrayElement<std::string_view>(monthAbbreviatedNames);
+}
+
+Dictionary Date::monthAbbreviatedNameDictionary()
+{
+    return Dictionary{monthAbbreviatedNames};
 }
 
 }
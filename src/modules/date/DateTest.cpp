@@ -147,12 +147,78 @@ TEST_F(DateTest, shouldGenerateBirthDateByRangeYear)
     EXPECT_LE(birthdate.tm_year + 1900, 2000);
 }
 
+TEST_F(DateTest, shouldGenerateBirthdateByYearTimestampWithinYears)
+{
+    const auto startDate = std::chrono::sys_seconds{std::chrono::sys_days{std::chrono::year{1990} / 1 / 1}};
+    const auto endDate = std::chrono::sys_seconds{std::chrono::sys_days{std::chrono::year{2001} / 1 / 1}};
+
+    for (int i = 0; i < 100; i++)
+    {
+        const auto birthdate = Date::birthdateByYearTimestamp(1990, 2000);
+
+        EXPECT_GE(birthdate, startDate);
+        EXPECT_LT(birthdate, endDate);
+    }
+}
+
+TEST_F(DateTest, shouldGenerateTimestamps)
+{
+    const auto currentDate = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+
+    const auto pastTimestamp = Date::pastTimestamp();
+    const auto futureTimestamp = Date::futureTimestamp();
+    const auto recentTimestamp = Date::recentTimestamp(5);
+    const auto soonTimestamp = Date::soonTimestamp(5);
+    const auto birthdate = Date::birthdateByAgeTimestamp(5, 15);
+
+    EXPECT_TRUE(pastTimestamp < currentDate);
+    EXPECT_TRUE(currentDate - pastTimestamp <= std::chrono::hours{numberOfHoursInDay * numberOfDaysInYear});
+    EXPECT_TRUE(futureTimestamp > currentDate);
+    EXPECT_TRUE(recentTimestamp < currentDate);
+    EXPECT_TRUE(currentDate - recentTimestamp <= std::chrono::hours{numberOfHoursInDay * 5});
+    EXPECT_TRUE(soonTimestamp > currentDate);
+    EXPECT_TRUE(currentDate - birthdate >= std::chrono::hours{numberOfHoursInDay * numberOfDaysInYear * 5} -
+                                               std::chrono::seconds{1});
+    EXPECT_TRUE(currentDate - birthdate <= std::chrono::hours{numberOfHoursInDay * numberOfDaysInYear * 15} +
+                                               std::chrono::seconds{1});
+}
+
+TEST_F(DateTest, shouldGenerateDatesRelativeToPinnedReferenceDate)
+{
+    const auto referenceDate = std::chrono::sys_seconds{std::chrono::sys_days{std::chrono::year{2024} / 1 / 1}};
+
+    Date::pinReferenceDate(referenceDate);
+
+    const auto pinnedDate = Date::referenceDate();
+    const auto recentDate = Date::recentDate(2);
+    const auto soonTimestamp = Date::soonTimestamp(2);
+
+    Date::unpinReferenceDate();
+
+    EXPECT_EQ(pinnedDate, referenceDate);
+    EXPECT_TRUE(recentDate >= "2023-12-30T00:00:00Z" && recentDate <= "2023-12-31T23:00:00Z") << recentDate;
+    EXPECT_TRUE(soonTimestamp > referenceDate && soonTimestamp <= referenceDate + std::chrono::hours{49});
+    EXPECT_TRUE(Date::referenceDate() > referenceDate);
+}
+
+TEST_F(DateTest, shouldPinCurrentTimeAsReferenceDate)
+{
+    Date::pinReferenceDate();
+
+    const auto pinnedDate = Date::referenceDate();
+    const auto pinnedDateAgain = Date::referenceDate();
+
+    Date::unpinReferenceDate();
+
+    EXPECT_EQ(pinnedDate, pinnedDateAgain);
+}
+
 TEST_F(DateTest, shouldGenerateWeekdayName)
 {
     const auto generatedWeekdayName = Date::weekdayName();
 
     ASSERT_TRUE(std::any_of(weekdayNames.begin(), weekdayNames.end(),
-                            [generatedWeekdayName](const std::string& weekdayName)
+                            [generatedWeekdayName](std::string_view weekdayName)
                             { return weekdayName == generatedWeekdayName; }));
 }
 
@@ -161,7 +227,7 @@ TEST_F(DateTest, shouldGenerateWeekdayAbbreviatedName)
     const auto generatedWeekdayAbbreviatedName = Date::weekdayAbbreviatedName();
 
     ASSERT_TRUE(std::any_of(weekdayAbbreviatedNames.begin(), weekdayAbbreviatedNames.end(),
-                            [generatedWeekdayAbbreviatedName](const std::string& weekdayAbbreviatedName)
+                            [generatedWeekdayAbbreviatedName](std::string_view weekdayAbbreviatedName)
                             { return weekdayAbbreviatedName == generatedWeekdayAbbreviatedName; }));
 }
 
@@ -170,7 +236,16 @@ TEST_F(DateTest, shouldGenerateMonthName)
     const auto generatedMonthName = Date::monthName();
 
     ASSERT_TRUE(std::any_of(monthNames.begin(), monthNames.end(),
-                            [generatedMonthName](const std::string& monthName)
+                            [generatedMonthName](std::string_view monthName)
+                            { return monthName == generatedMonthName; }));
+}
+
+TEST_F(DateTest, shouldGenerateMonthNameView)
+{
+    const auto generatedMonthName = Date::monthNameView();
+
+    ASSERT_TRUE(std::any_of(monthNames.begin(), monthNames.end(),
+                            [generatedMonthName](std::string_view monthName)
                             { return monthName == generatedMonthName; }));
 }
 
@@ -179,6 +254,6 @@ TEST_F(DateTest, shouldGenerateMonthAbbreviatedName)
     const auto generatedMonthAbbreviatedName = Date::monthAbbreviatedName();
 
     ASSERT_TRUE(std::any_of(monthAbbreviatedNames.begin(), monthAbbreviatedNames.end(),
-                            [generatedMonthAbbreviatedName](const std::string& monthAbbreviatedName)
+                            [generatedMonthAbbreviatedName](std::string_view monthAbbreviatedName)
                             { return monthAbbreviatedName == generatedMonthAbbreviatedName; }));
 }
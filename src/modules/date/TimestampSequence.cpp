@@ -0,0 +1,141 @@
+#include "faker-cxx/TimestampSequence.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+#include "faker-cxx/Number.h"
+
+namespace faker
+{
+TimestampSequence::TimestampSequence(TimePoint from, TimePoint to, std::uint64_t count, TimestampSpacing spacing,
+                                     std::optional<TimestampLateness> lateness)
+    : from{from},
+      windowNanoseconds{static_cast<double>((to - from).count())},
+      count{count},
+      spacing{spacing},
+      lateness{lateness},
+      generatedCount{0},
+      position{0}
+{
+    if (from >= to)
+    {
+        throw std::invalid_argument("Start of the time window must be before its end.");
+    }
+
+    if (lateness && (lateness->max.count() < 0 || !(lateness->probability >= 0 && lateness->probability <= 1)))
+    {
+        throw std::invalid_argument("Lateness must not be negative and its probability must be in range [0, 1].");
+    }
+
+    upcomingTimestamp = generateTimestamp();
+}
+
+bool TimestampSequence::hasNext() const
+{
+    return upcomingTimestamp.has_value() || !delayedTimestamps.empty();
+}
+
+TimestampSequence::TimePoint TimestampSequence::next()
+{
+    if (!hasNext())
+    {
+        throw std::out_of_range("All timestamps of the sequence were already returned.");
+    }
+
+    if (!lateness)
+    {
+        const auto timestamp = *upcomingTimestamp;
+
+        upcomingTimestamp = generateTimestamp();
+
+        return timestamp;
+    }
+
+    // Timestamps generated later are delayed to at least their own time, so the earliest delayed timestamp not later
+    // than the upcoming one is the next in order of delayed times.
+    while (upcomingTimestamp && (delayedTimestamps.empty() || delayedTimestamps.top().first > *upcomingTimestamp))
+    {
+        delayedTimestamps.emplace(*upcomingTimestamp + generateLateness(), *upcomingTimestamp);
+
+        upcomingTimestamp = generateTimestamp();
+    }
+
+    const auto timestamp = delayedTimestamps.top().second;
+
+    delayedTimestamps.pop();
+
+    return timestamp;
+}
+
+std::size_t TimestampSequence::nextChunk(std::span<TimePoint> chunk)
+{
+    std::size_t size = 0;
+
+    while (size < chunk.size() && hasNext())
+    {
+        chunk[size++] = next();
+    }
+
+    return size;
+}
+
+std::optional<TimestampSequence::TimePoint> TimestampSequence::generateTimestamp()
+{
+    if (count == 0)
+    {
+        return std::nullopt;
+    }
+
+    if (spacing == TimestampSpacing::Uniform)
+    {
+        if (generatedCount == count)
+        {
+            return std::nullopt;
+        }
+
+        // The minimum of k uniform values in [0, 1) is 1 - U^(1/k), so each next order statistic is drawn from the
+        // remaining part of the window.
+        const auto remainingCount = static_cast<double>(count - generatedCount);
+        const auto uniform = 1.0 - Number::decimal<double>(0.0, 1.0);
+
+        position += (1.0 - position) * -std::expm1(std::log(uniform) / remainingCount);
+    }
+    else
+    {
+        const auto rate = static_cast<double>(count) / windowNanoseconds;
+
+        position += Number::decimal<double>(std::exponential_distribution<double>(rate));
+
+        if (position >= windowNanoseconds)
+        {
+            return std::nullopt;
+        }
+    }
+
+    generatedCount++;
+
+    const auto offset = spacing == TimestampSpacing::Uniform ? position * windowNanoseconds : position;
+
+    return from + std::chrono::nanoseconds{
+                      static_cast<std::int64_t>(std::min(std::floor(offset), windowNanoseconds - 1))};
+}
+
+std::chrono::nanoseconds TimestampSequence::generateLateness() const
+{
+    const auto maxLateness = static_cast<double>(lateness->max.count());
+
+    if (maxLateness == 0 || Number::decimal<double>(0.0, 1.0) >= lateness->probability)
+    {
+        return std::chrono::nanoseconds{0};
+    }
+
+    const auto generatedLateness =
+        lateness->distribution == LatenessDistribution::Uniform ?
+            Number::decimal<double>(0.0, maxLateness) :
+            Number::decimal<double>(std::exponential_distribution<double>(4.0 / maxLateness));
+
+    return std::chrono::nanoseconds{static_cast<std::int64_t>(std::min(generatedLateness, maxLateness))};
+}
+}
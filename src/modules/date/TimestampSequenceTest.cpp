@@ -0,0 +1,135 @@
+#include "faker-cxx/TimestampSequence.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+namespace
+{
+const TimestampSequence::TimePoint windowStart{std::chrono::sys_days{std::chrono::year{2024} / 1 / 1}};
+const auto windowEnd = windowStart + std::chrono::hours{1};
+}
+
+class TimestampSequenceTest : public Test
+{
+public:
+    static std::vector<TimestampSequence::TimePoint> generateAll(TimestampSequence& sequence)
+    {
+        std::vector<TimestampSequence::TimePoint> timestamps;
+
+        while (sequence.hasNext())
+        {
+            timestamps.push_back(sequence.next());
+        }
+
+        return timestamps;
+    }
+};
+
+TEST_F(TimestampSequenceTest, shouldGenerateSortedUniformTimestampsWithinWindow)
+{
+    TimestampSequence sequence{windowStart, windowEnd, 10000};
+
+    const auto timestamps = generateAll(sequence);
+
+    ASSERT_EQ(timestamps.size(), 10000);
+    ASSERT_TRUE(std::is_sorted(timestamps.begin(), timestamps.end()));
+    ASSERT_GE(timestamps.front(), windowStart);
+    ASSERT_LT(timestamps.back(), windowEnd);
+
+    const auto firstHalfCount = std::count_if(timestamps.begin(), timestamps.end(),
+                                              [](const auto& timestamp)
+                                              { return timestamp < windowStart + std::chrono::minutes{30}; });
+
+    ASSERT_GT(firstHalfCount, 4500);
+    ASSERT_LT(firstHalfCount, 5500);
+}
+
+TEST_F(TimestampSequenceTest, shouldGenerateSortedPoissonTimestampsWithinWindow)
+{
+    TimestampSequence sequence{windowStart, windowEnd, 10000, TimestampSpacing::Poisson};
+
+    const auto timestamps = generateAll(sequence);
+
+    ASSERT_GT(timestamps.size(), 9000);
+    ASSERT_LT(timestamps.size(), 11000);
+    ASSERT_TRUE(std::is_sorted(timestamps.begin(), timestamps.end()));
+    ASSERT_GE(timestamps.front(), windowStart);
+    ASSERT_LT(timestamps.back(), windowEnd);
+}
+
+TEST_F(TimestampSequenceTest, shouldBoundDisorderByMaxLateness)
+{
+    const auto maxLateness = std::chrono::seconds{10};
+
+    for (const auto distribution : {LatenessDistribution::Uniform, LatenessDistribution::Exponential})
+    {
+        TimestampSequence sequence{windowStart, windowEnd, 10000, TimestampSpacing::Uniform,
+                                   TimestampLateness{maxLateness, distribution, 0.5}};
+
+        const auto timestamps = generateAll(sequence);
+
+        ASSERT_EQ(timestamps.size(), 10000);
+        ASSERT_FALSE(std::is_sorted(timestamps.begin(), timestamps.end()));
+
+        auto latestTimestamp = timestamps.front();
+
+        for (const auto& timestamp : timestamps)
+        {
+            ASSERT_GE(timestamp, latestTimestamp - maxLateness);
+
+            latestTimestamp = std::max(latestTimestamp, timestamp);
+        }
+
+        auto sortedTimestamps = timestamps;
+        std::sort(sortedTimestamps.begin(), sortedTimestamps.end());
+
+        ASSERT_GE(sortedTimestamps.front(), windowStart);
+        ASSERT_LT(sortedTimestamps.back(), windowEnd);
+    }
+}
+
+TEST_F(TimestampSequenceTest, shouldGenerateTimestampsInChunks)
+{
+    TimestampSequence sequence{windowStart, windowEnd, 1000};
+
+    std::array<TimestampSequence::TimePoint, 300> chunk{};
+    std::vector<TimestampSequence::TimePoint> timestamps;
+
+    while (const auto size = sequence.nextChunk(chunk))
+    {
+        timestamps.insert(timestamps.end(), chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(size));
+    }
+
+    ASSERT_EQ(timestamps.size(), 1000);
+    ASSERT_TRUE(std::is_sorted(timestamps.begin(), timestamps.end()));
+    ASSERT_FALSE(sequence.hasNext());
+    ASSERT_THROW(sequence.next(), std::out_of_range);
+}
+
+TEST_F(TimestampSequenceTest, shouldGenerateNoTimestampsForZeroCount)
+{
+    TimestampSequence uniformSequence{windowStart, windowEnd, 0};
+    TimestampSequence poissonSequence{windowStart, windowEnd, 0, TimestampSpacing::Poisson};
+
+    ASSERT_FALSE(uniformSequence.hasNext());
+    ASSERT_FALSE(poissonSequence.hasNext());
+}
+
+TEST_F(TimestampSequenceTest, shouldThrowForInvalidArguments)
+{
+    ASSERT_THROW(TimestampSequence(windowEnd, windowStart, 10), std::invalid_argument);
+    ASSERT_THROW(TimestampSequence(windowStart, windowEnd, 10, TimestampSpacing::Uniform,
+                                   TimestampLateness{std::chrono::seconds{-1}}),
+                 std::invalid_argument);
+    ASSERT_THROW(TimestampSequence(windowStart, windowEnd, 10, TimestampSpacing::Uniform,
+                                   TimestampLateness{std::chrono::seconds{1}, LatenessDistribution::Uniform, 2.0}),
+                 std::invalid_argument);
+}
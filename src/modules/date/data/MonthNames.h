@@ -1,16 +1,16 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> monthNames = {
+inline constexpr auto monthNames = std::to_array<std::string_view>({
 
     "January", "February", "March",     "April",   "May",      "June",
     "July",    "August",   "September", "October", "November", "December",
-};
+});
 
-const std::vector<std::string> monthAbbreviatedNames = {"Jan",  "Feb", "Mar",  "Apr", "May", "June",
-                                                        "July", "Aug", "Sept", "Oct", "Nov", "Dec"};
+inline constexpr auto monthAbbreviatedNames = std::to_array<std::string_view>({"Jan",  "Feb", "Mar",  "Apr", "May", "June",
+                                                                        "July", "Aug", "Sept", "Oct", "Nov", "Dec"});
 }
@@ -1,12 +1,13 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> weekdayNames = {"Monday", "Tuesday",  "Wednesday", "Thursday",
-                                               "Friday", "Saturday", "Sunday"};
+inline constexpr auto weekdayNames = std::to_array<std::string_view>({"Monday", "Tuesday",  "Wednesday", "Thursday",
+                                                               "Friday", "Saturday", "Sunday"});
 
-const std::vector<std::string> weekdayAbbreviatedNames = {"Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"};
+inline constexpr auto weekdayAbbreviatedNames = std::to_array<std::string_view>({
+    "Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"});
 }
@@ -0,0 +1,67 @@
+#include "faker-cxx/Dictionary.h"
+
+#include <stdexcept>
+
+#include "faker-cxx/Number.h"
+
+namespace faker
+{
+Dictionary::Dictionary(std::span<const std::string_view> entries) : entries{entries} {}
+
+Dictionary::Dictionary(StringPoolView entries) : entries{entries} {}
+
+std::size_t Dictionary::size() const
+{
+    return std::visit([](const auto& dictionaryEntries) { return dictionaryEntries.size(); }, entries);
+}
+
+bool Dictionary::empty() const
+{
+    return size() == 0;
+}
+
+std::string_view Dictionary::operator[](std::size_t index) const
+{
+    return std::visit([index](const auto& dictionaryEntries) -> std::string_view { return dictionaryEntries[index]; },
+                      entries);
+}
+
+std::string_view Dictionary::at(std::size_t index) const
+{
+    if (index >= size())
+    {
+        throw std::out_of_range("Dictionary index is out of range.");
+    }
+
+    return (*this)[index];
+}
+
+std::size_t Dictionary::randomIndex() const
+{
+    if (empty())
+    {
+        throw std::invalid_argument("Dictionary is empty.");
+    }
+
+    return Number::integer<std::size_t>(size() - 1);
+}
+
+std::vector<std::size_t> Dictionary::randomIndices(std::size_t count) const
+{
+    if (empty())
+    {
+        throw std::invalid_argument("Dictionary is empty.");
+    }
+
+    const auto maxIndex = size() - 1;
+
+    std::vector<std::size_t> indices(count);
+
+    for (auto& index : indices)
+    {
+        index = Number::integer<std::size_t>(maxIndex);
+    }
+
+    return indices;
+}
+}
@@ -0,0 +1,67 @@
+#include "faker-cxx/Dictionary.h"
+
+#include <algorithm>
+#include <array>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+namespace
+{
+constexpr auto animals = std::to_array<std::string_view>({"dog", "horse", "cat"});
+constexpr auto animalPool = StringPoolBuilder::build<animals>();
+}
+
+class DictionaryTest : public Test
+{
+public:
+};
+
+TEST_F(DictionaryTest, shouldReturnEntriesOfSpan)
+{
+    const Dictionary dictionary{animals};
+
+    ASSERT_EQ(dictionary.size(), 3);
+    ASSERT_FALSE(dictionary.empty());
+    ASSERT_EQ(dictionary[0], "dog");
+    ASSERT_EQ(dictionary[2], "cat");
+}
+
+TEST_F(DictionaryTest, shouldReturnEntriesOfStringPool)
+{
+    const Dictionary dictionary{animalPool.all()};
+
+    ASSERT_EQ(dictionary.size(), 3);
+    ASSERT_EQ(dictionary[1], "horse");
+    ASSERT_EQ(dictionary.at(2), "cat");
+}
+
+TEST_F(DictionaryTest, shouldThrowForIndexOutOfRange)
+{
+    const Dictionary dictionary{animals};
+
+    ASSERT_THROW(dictionary.at(3), std::out_of_range);
+}
+
+TEST_F(DictionaryTest, shouldGenerateIndicesInRange)
+{
+    const Dictionary dictionary{animalPool.all()};
+
+    const auto index = dictionary.randomIndex();
+    const auto indices = dictionary.randomIndices(100);
+
+    ASSERT_LT(index, dictionary.size());
+    ASSERT_EQ(indices.size(), 100);
+    ASSERT_TRUE(std::all_of(indices.begin(), indices.end(),
+                            [&dictionary](std::size_t generatedIndex) { return generatedIndex < dictionary.size(); }));
+}
+
+TEST_F(DictionaryTest, shouldThrowWhenGeneratingIndexOfEmptyDictionary)
+{
+    const Dictionary dictionary{std::span<const std::string_view>{}};
+
+    ASSERT_THROW(dictionary.randomIndex(), std::invalid_argument);
+    ASSERT_THROW(dictionary.randomIndices(1), std::invalid_argument);
+}
@@ -1,8 +1,17 @@
 #include "faker-cxx/Finance.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <format>
+#include <span>
+#include <stdexcept>
+#include <vector>
 
+#include "../../common/EnumMap.h"
 #include "../../common/mappers/PrecisionMapper.h"
+#include "../../common/NumberFormatter.h"
+#include "../../common/RandomDigits.h"
 #include "data/AccountTypes.h"
 #include "data/BankIndentifiersCodes.h"
 #include "data/CreditCardsFormats.h"
@@ -16,83 +25,405 @@ namespace faker
 {
 namespace
 {
-const std::map<CreditCardType, std::vector<std::string>> creditCardTypeToNumberFormats{
-    {CreditCardType::AmericanExpress, americanExpressCreditCardFormats},
-    {CreditCardType::Discover, discoverCreditCardFormats},
-    {CreditCardType::MasterCard, masterCardCreditCardFormats},
-    {CreditCardType::Visa, visaCreditCardFormats},
+// Largest absolute count of smallest units an amount is generated as, larger amounts are generated as doubles.
+constexpr double maxScaledAmount = 1e18;
+
+/**
+ * Rounds a bound of the amount range, multiplied by the scale of the precision, to a whole count of smallest units
+ * within the range. Bounds differing from an integer only by a rounding error of the multiplication, like
+ * `0.07 * 100 == 7.000000000000001`, are taken as that integer.
+ */
+double scaledAmountBound(double scaledBound, bool isLowerBound)
+{
+    const auto nearest = std::nearbyint(scaledBound);
+
+    if (std::abs(scaledBound - nearest) <= 1e-9 * std::max(1.0, std::abs(scaledBound)))
+    {
+        return nearest;
+    }
+
+    return isLowerBound ? std::ceil(scaledBound) : std::floor(scaledBound);
+}
+
+constexpr std::array creditCardTypes{CreditCardType::AmericanExpress, CreditCardType::Discover,
+                                     CreditCardType::MasterCard, CreditCardType::Visa};
+
+constexpr std::size_t maxCreditCardNumberLength = 32;
+
+/**
+ * Credit card number format with its length and number of digits counted at compile time.
+ *
+ * In the pattern, `#` is a random digit, `[a-b]` a random digit from `a` to `b`, `L` the Luhn check digit, which must
+ * be the last digit, and any other character is copied as is.
+ */
+struct CreditCardFormat {
+    std::string_view pattern;
+    std::size_t length;
+    std::size_t digitCount;
 };
 
-const std::vector<CreditCardType> creditCardTypes{CreditCardType::AmericanExpress, CreditCardType::Discover,
-                                                  CreditCardType::MasterCard, CreditCardType::Visa};
+constexpr bool isDigit(char character)
+{
+    return character >= '0' && character <= '9';
 }
 
-std::string Finance::currencyCode()
+constexpr CreditCardFormat compileCreditCardFormat(std::string_view pattern)
 {
-    return Helper::arrayElement<std::string>(currenciesCodes);
+    CreditCardFormat format{pattern, 0, 0};
+
+    bool hasCheckDigit = false;
+
+    for (std::size_t i = 0; i < pattern.size(); i++)
+    {
+        const auto character = pattern[i];
+
+        if (character == '[')
+        {
+            if (i + 4 >= pattern.size() || !isDigit(pattern[i + 1]) || pattern[i + 2] != '-' ||
+                !isDigit(pattern[i + 3]) || pattern[i + 3] < pattern[i + 1] || pattern[i + 4] != ']')
+            {
+                throw std::invalid_argument("Credit card format range must be of form [a-b].");
+            }
+
+            i += 4;
+        }
+
+        if (hasCheckDigit && (character == '[' || character == '#' || character == 'L' || isDigit(character)))
+        {
+            throw std::invalid_argument("Luhn check digit must be the last digit of credit card format.");
+        }
+
+        if (character == '[' || character == '#' || character == 'L' || isDigit(character))
+        {
+            format.digitCount++;
+        }
+
+        hasCheckDigit = hasCheckDigit || character == 'L';
+        format.length++;
+    }
+
+    if (!hasCheckDigit || format.length > maxCreditCardNumberLength)
+    {
+        throw std::invalid_argument("Credit card format must end with a check digit and fit into 32 characters.");
+    }
+
+    return format;
 }
 
-std::string Finance::accountType()
+template <std::size_t Size>
+constexpr std::array<CreditCardFormat, Size> compileCreditCardFormats(const std::array<std::string_view, Size>& patterns)
 {
-    return Helper::arrayElement<std::string>(accountTypes);
+    std::array<CreditCardFormat, Size> formats{};
+
+    for (std::size_t i = 0; i < Size; i++)
+    {
+        formats[i] = compileCreditCardFormat(patterns[i]);
+    }
+
+    return formats;
 }
 
-std::string Finance::amount(double min, double max, Precision precision, const std::string& symbol)
+constexpr auto americanExpressFormats = compileCreditCardFormats(americanExpressCreditCardFormats);
+constexpr auto discoverFormats = compileCreditCardFormats(discoverCreditCardFormats);
+constexpr auto masterCardFormats = compileCreditCardFormats(masterCardCreditCardFormats);
+constexpr auto visaFormats = compileCreditCardFormats(visaCreditCardFormats);
+
+constexpr auto creditCardTypeToNumberFormats =
+    EnumMapBuilder::build<CreditCardType, std::span<const CreditCardFormat>, CreditCardType::Visa>({
+        {CreditCardType::AmericanExpress, americanExpressFormats},
+        {CreditCardType::Discover, discoverFormats},
+        {CreditCardType::MasterCard, masterCardFormats},
+        {CreditCardType::Visa, visaFormats},
+    });
+
+// Sum of digits of each digit doubled, as added to the Luhn sum for every second digit from the right.
+constexpr std::array<unsigned, 10> luhnDoubledDigits{0, 2, 4, 6, 8, 1, 3, 5, 7, 9};
+
+/**
+ * Writes a random credit card number of the given format into `number`, which must hold `format.length` characters.
+ *
+ * The Luhn sum is accumulated while the digits are written, the position of each digit from the right is known from
+ * the digit count of the format, so the check digit needs no second pass.
+ */
+void generateCreditCardNumber(const CreditCardFormat& format, char* number)
 {
-    const std::floating_point auto generatedNumber = Number::decimal<double>(min, max);
+    const auto pattern = format.pattern;
+
+    char randomDigits[maxCreditCardNumberLength];
+    RandomDigits::fill({randomDigits, format.digitCount});
 
-    std::stringstream ss;
+    unsigned luhnSum = 0;
+    std::size_t digitIndex = 0;
+    std::size_t position = 0;
 
-    ss << std::fixed;
+    for (std::size_t i = 0; i < pattern.size(); i++)
+    {
+        const auto character = pattern[i];
 
-    ss.precision(PrecisionMapper::toDecimalPlaces(precision));
+        unsigned digit{};
 
-    ss << generatedNumber;
+        if (character == '#')
+        {
+            digit = static_cast<unsigned>(randomDigits[digitIndex] - '0');
+        }
+        else if (character == '[')
+        {
+            digit = Number::integer<unsigned>(static_cast<unsigned>(pattern[i + 1] - '0'),
+                                              static_cast<unsigned>(pattern[i + 3] - '0'));
+            i += 4;
+        }
+        else if (isDigit(character))
+        {
+            digit = static_cast<unsigned>(character - '0');
+        }
+        else if (character == 'L')
+        {
+            digit = (10 - luhnSum % 10) % 10;
+        }
+        else
+        {
+            number[position++] = character;
 
-    return std::format("{}{}", symbol, ss.str());
+            continue;
+        }
+
+        const auto isDoubled = (format.digitCount - 1 - digitIndex) % 2 == 1;
+
+        luhnSum += isDoubled ? luhnDoubledDigits[digit] : digit;
+        digitIndex++;
+
+        number[position++] = static_cast<char>('0' + digit);
+    }
 }
 
-std::string Finance::iban(std::optional<IbanCountry> country)
+const CreditCardFormat& randomCreditCardFormat(std::optional<CreditCardType> creditCardType)
 {
-    const auto ibanCountry = country ? *country : Helper::arrayElement<IbanCountry>(supportedIbanCountries);
+    const auto creditCardTargetType =
+        creditCardType ? *creditCardType : Helper::arrayElement<CreditCardType>(creditCardTypes);
 
-    // TODO: error handling
-    const auto& ibanFormat = ibanFormats.at(ibanCountry);
+    const auto formats = creditCardTypeToNumberFormats.at(creditCardTargetType);
 
-    const auto& countryCode = ibanFormat[0];
+    return formats[Number::integer<std::size_t>(formats.size() - 1)];
+}
 
-    std::string iban{countryCode};
+constexpr std::size_t maxIbanLength = 34;
+constexpr std::size_t maxIbanSegments = 8;
 
-    for (size_t i = 1; i < ibanFormat.size(); i++)
+struct IbanSegment {
+    char dataType;
+    std::size_t length;
+};
+
+/**
+ * IBAN format parsed at compile time. Segments describe the basic bank account number (BBAN) following the country
+ * code and check digits.
+ */
+struct IbanSpec {
+    std::string_view countryCode;
+    std::array<IbanSegment, maxIbanSegments> segments;
+    std::size_t segmentCount;
+    std::size_t length;
+    // Country code followed by "00" with letters converted to numbers, as appended to the BBAN by ISO 7064 mod-97.
+    std::uint64_t countryCodeNumber;
+};
+
+constexpr unsigned ibanLetterValue(char letter)
+{
+    return static_cast<unsigned>(letter - 'A') + 10;
+}
+
+constexpr IbanSpec compileIbanFormat(std::span<const std::string_view> format)
+{
+    if (format.size() < 3 || format.size() - 2 > maxIbanSegments || format[0].size() != 2 || format[1] != "2n")
+    {
+        throw std::invalid_argument("IBAN format must consist of country code, check digits and BBAN segments.");
+    }
+
+    IbanSpec spec{format[0], {}, format.size() - 2, 4, 0};
+
+    for (std::size_t i = 0; i < spec.segmentCount; i++)
     {
-        const auto& ibanFormatEntry = ibanFormat[i];
+        const auto entry = format[i + 2];
 
-        const auto ibanFormatEntryDataType = ibanFormatEntry[ibanFormatEntry.size() - 1];
-        const auto ibanFormatEntryDataLength = std::stoi(ibanFormatEntry.substr(0, ibanFormatEntry.size() - 1));
+        std::size_t length = 0;
 
-        if (ibanFormatEntryDataType == 'a')
+        for (const auto character : entry.substr(0, entry.size() - 1))
         {
-            iban += String::alpha(static_cast<unsigned>(ibanFormatEntryDataLength), StringCasing::Upper);
+            length = length * 10 + static_cast<std::size_t>(character - '0');
         }
-        else if (ibanFormatEntryDataType == 'c')
+
+        if (entry.back() != 'a' && entry.back() != 'c' && entry.back() != 'n')
         {
-            iban += String::alphanumeric(static_cast<unsigned>(ibanFormatEntryDataLength), StringCasing::Upper);
+            throw std::invalid_argument("IBAN format segment must be of type a, c or n.");
         }
-        else if (ibanFormatEntryDataType == 'n')
+
+        spec.segments[i] = {entry.back(), length};
+        spec.length += length;
+    }
+
+    if (spec.length > maxIbanLength)
+    {
+        throw std::invalid_argument("IBAN must not be longer than 34 characters.");
+    }
+
+    spec.countryCodeNumber = (ibanLetterValue(spec.countryCode[0]) * 100 + ibanLetterValue(spec.countryCode[1])) * 100;
+
+    return spec;
+}
+
+constexpr auto ibanSpecs = EnumMapBuilder::build<IbanCountry, IbanSpec, IbanCountry::Italy>({
+    {IbanCountry::Poland, compileIbanFormat(ibanFormats[IbanCountry::Poland])},
+    {IbanCountry::France, compileIbanFormat(ibanFormats[IbanCountry::France])},
+    {IbanCountry::Germany, compileIbanFormat(ibanFormats[IbanCountry::Germany])},
+    {IbanCountry::Italy, compileIbanFormat(ibanFormats[IbanCountry::Italy])},
+});
+
+/**
+ * Writes a random IBAN of the given format into `iban`, which must hold `spec.length` characters.
+ *
+ * The mod-97 remainder of the BBAN is updated with every generated character, so the check digits are known as soon
+ * as the last character is written.
+ */
+void generateIban(const IbanSpec& spec, char* iban)
+{
+    iban[0] = spec.countryCode[0];
+    iban[1] = spec.countryCode[1];
+
+    std::uint64_t remainder = 0;
+    std::size_t position = 4;
+
+    for (std::size_t i = 0; i < spec.segmentCount; i++)
+    {
+        const auto [dataType, length] = spec.segments[i];
+
+        if (dataType == 'n')
         {
-            iban += String::numeric(static_cast<unsigned>(ibanFormatEntryDataLength));
+            RandomDigits::fill({iban + position, length});
+
+            for (std::size_t j = 0; j < length; j++)
+            {
+                remainder = (remainder * 10 + static_cast<std::uint64_t>(iban[position++] - '0')) % 97;
+            }
+
+            continue;
+        }
+
+        for (std::size_t j = 0; j < length; j++)
+        {
+            const auto value = Number::integer<unsigned>(dataType == 'a' ? 25 : 35);
+
+            if (dataType == 'c' && value < 10)
+            {
+                iban[position++] = static_cast<char>('0' + value);
+                remainder = (remainder * 10 + value) % 97;
+            }
+            else
+            {
+                const auto letterValue = dataType == 'a' ? value + 10 : value;
+
+                iban[position++] = static_cast<char>('A' + letterValue - 10);
+                remainder = (remainder * 100 + letterValue) % 97;
+            }
         }
     }
 
+    const auto checkDigits = 98 - (remainder * 1000000 + spec.countryCodeNumber) % 97;
+
+    iban[2] = static_cast<char>('0' + checkDigits / 10);
+    iban[3] = static_cast<char>('0' + checkDigits % 10);
+}
+}
+
+std::string Finance::currencyCode()
+{
+    return std::string{currencyCodeView()};
+}
+
+std::string_view Finance::currencyCodeView()
+{
+    return Helper::arrayElement<std::string_view>(currenciesCodes);
+}
+
+Dictionary Finance::currencyCodeDictionary()
+{
+    return Dictionary{currenciesCodes};
+}
+
+std::string Finance::accountType()
+{
+    return std::string{accountTypeView()};
+}
+
+std::string_view Finance::accountTypeView()
+{
+    return Helper::arrayElement<std::string_view>(accountTypes);
+}
+
+Dictionary Finance::accountTypeDictionary()
+{
+    return Dictionary{accountTypes};
+}
+
+std::string Finance::amount(double min, double max, Precision precision, const std::string& symbol)
+{
+    const auto decimalPlaces = PrecisionMapper::toDecimalPlaces(precision);
+    const auto scale = std::pow(10.0, decimalPlaces);
+
+    const auto scaledMin = scaledAmountBound(min * scale, true);
+    const auto scaledMax = scaledAmountBound(max * scale, false);
+
+    if (scaledMin <= scaledMax && std::abs(scaledMin) <= maxScaledAmount && std::abs(scaledMax) <= maxScaledAmount)
+    {
+        const auto scaledAmount = Number::integer<std::int64_t>(std::llround(scaledMin), std::llround(scaledMax));
+
+        return symbol + NumberFormatter::scaledDecimal(scaledAmount, decimalPlaces);
+    }
+
+    // No amount with the given precision lies in the range, or the amounts do not fit into an integer.
+    return symbol + NumberFormatter::fixed(Number::decimal<double>(min, max), decimalPlaces);
+}
+
+std::string Finance::iban(std::optional<IbanCountry> country)
+{
+    const auto ibanCountry = country ? *country : Helper::arrayElement<IbanCountry>(supportedIbanCountries);
+
+    const auto& spec = ibanSpecs.at(ibanCountry);
+
+    std::string iban(spec.length, '\0');
+
+    generateIban(spec, iban.data());
+
     return iban;
 }
 
+std::vector<std::string> Finance::ibans(std::size_t count, std::optional<IbanCountry> country)
+{
+    std::vector<std::string> ibans;
+
+    ibans.reserve(count);
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        const auto ibanCountry = country ? *country : Helper::arrayElement<IbanCountry>(supportedIbanCountries);
+
+        const auto& spec = ibanSpecs.at(ibanCountry);
+
+        char iban[maxIbanLength];
+
+        generateIban(spec, iban);
+
+        ibans.emplace_back(iban, spec.length);
+    }
+
+    return ibans;
+}
+
 std::string Finance::bic(std::optional<BicCountry> country)
 {
     const auto bicCountry = country ? *country : Helper::arrayElement<BicCountry>(supportedBicCountries);
 
     // TODO: error handling
-    return Helper::arrayElement<std::string>(bankIdentifiersCodesMapping.at(bicCountry));
+    return std::string{Helper::arrayElement<std::string_view>(bankIdentifiersCodesMapping.at(bicCountry))};
 }
 
 std::string Finance::accountNumber(unsigned int length)
@@ -112,14 +443,33 @@ std::string Finance::routingNumber()
 
 std::string Finance::creditCardNumber(std::optional<CreditCardType> creditCardType)
 {
-    const auto creditCardTargetType =
-        creditCardType ? *creditCardType : Helper::arrayElement<CreditCardType>(creditCardTypes);
+    const auto& format = randomCreditCardFormat(creditCardType);
+
+    std::string creditCardNumber(format.length, '\0');
 
-    const auto& creditCardFormats = creditCardTypeToNumberFormats.at(creditCardTargetType);
+    generateCreditCardNumber(format, creditCardNumber.data());
 
-    const auto creditCardFormat = Helper::arrayElement<std::string>(creditCardFormats);
+    return creditCardNumber;
+}
+
+std::vector<std::string> Finance::creditCardNumbers(std::size_t count, std::optional<CreditCardType> creditCardType)
+{
+    std::vector<std::string> creditCardNumbers;
+
+    creditCardNumbers.reserve(count);
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        const auto& format = randomCreditCardFormat(creditCardType);
+
+        char creditCardNumber[maxCreditCardNumberLength];
+
+        generateCreditCardNumber(format, creditCardNumber);
+
+        creditCardNumbers.emplace_back(creditCardNumber, format.length);
+    }
 
-    return Helper::replaceCreditCardSymbols(creditCardFormat);
+    return creditCardNumbers;
 }
 
 std::string Finance::creditCardCvv()
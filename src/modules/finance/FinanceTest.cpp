@@ -56,6 +56,27 @@ public:
                            });
     }
 
+    static bool checkIfIbanHasValidCheckDigits(const std::string& iban)
+    {
+        const auto rearrangedIban = iban.substr(4) + iban.substr(0, 4);
+
+        unsigned remainder = 0;
+
+        for (const auto character : rearrangedIban)
+        {
+            if (character >= 'A' && character <= 'Z')
+            {
+                remainder = (remainder * 100 + static_cast<unsigned>(character - 'A' + 10)) % 97;
+            }
+            else
+            {
+                remainder = (remainder * 10 + static_cast<unsigned>(character - '0')) % 97;
+            }
+        }
+
+        return remainder == 1;
+    }
+
     static bool checkIfAllCharactersAreAlpha(const std::string& data)
     {
         return std::all_of(data.begin(), data.end(),
@@ -73,16 +94,37 @@ TEST_F(FinanceTest, shouldGenerateCurrencyCode)
     const auto generatedCurrencyCode = Finance::currencyCode();
 
     ASSERT_TRUE(std::any_of(currenciesCodes.begin(), currenciesCodes.end(),
-                            [generatedCurrencyCode](const std::string& currencyCode)
+                            [generatedCurrencyCode](std::string_view currencyCode)
+                            { return currencyCode == generatedCurrencyCode; }));
+}
+
+TEST_F(FinanceTest, shouldGenerateCurrencyCodeView)
+{
+    const auto generatedCurrencyCode = Finance::currencyCodeView();
+
+    ASSERT_TRUE(std::any_of(currenciesCodes.begin(), currenciesCodes.end(),
+                            [generatedCurrencyCode](std::string_view currencyCode)
                             { return currencyCode == generatedCurrencyCode; }));
 }
 
+TEST_F(FinanceTest, shouldReturnCurrencyCodeDictionary)
+{
+    const auto currencyCodes = Finance::currencyCodeDictionary();
+
+    const auto indices = currencyCodes.randomIndices(10);
+
+    ASSERT_EQ(currencyCodes.size(), currenciesCodes.size());
+    ASSERT_TRUE(std::all_of(indices.begin(), indices.end(),
+                            [&currencyCodes](std::size_t index)
+                            { return currencyCodes[index] == currenciesCodes[index]; }));
+}
+
 TEST_F(FinanceTest, shouldGenerateAccountType)
 {
     const auto generatedAccountType = Finance::accountType();
 
     ASSERT_TRUE(std::any_of(accountTypes.begin(), accountTypes.end(),
-                            [generatedAccountType](const std::string& accountType)
+                            [generatedAccountType](std::string_view accountType)
                             { return accountType == generatedAccountType; }));
 }
 
@@ -120,6 +162,18 @@ TEST_F(FinanceTest, shouldGenerateAmountWithSymbol)
     ASSERT_LE(amountAsFloat, max);
 }
 
+TEST_F(FinanceTest, shouldGenerateAmountOnBoundsGivenWithPrecision)
+{
+    ASSERT_EQ(Finance::amount(0.07, 0.07), "0.07");
+    ASSERT_EQ(Finance::amount(-1.5, -1.5, Precision::ThreeDp), "-1.500");
+    ASSERT_EQ(Finance::amount(0, 0, Precision::ZeroDp, "$"), "$0");
+}
+
+TEST_F(FinanceTest, shouldGenerateAmountBetweenUnitsOfPrecision)
+{
+    ASSERT_EQ(Finance::amount(1.231, 1.234), "1.23");
+}
+
 TEST_F(FinanceTest, shouldGenerateIban)
 {
     const auto iban = Finance::iban();
@@ -204,6 +258,43 @@ TEST_F(FinanceTest, shouldGenerateGermanyIban)
     ASSERT_TRUE(checkIfAllCharactersAreNumeric(accountNumber));
 }
 
+TEST_F(FinanceTest, shouldGenerateIbanWithValidCheckDigits)
+{
+    for (const auto country : supportedIbanCountries)
+    {
+        const auto iban = Finance::iban(country);
+
+        ASSERT_TRUE(checkIfIbanHasValidCheckDigits(iban)) << iban;
+    }
+}
+
+TEST_F(FinanceTest, shouldGenerateIbans)
+{
+    const auto ibans = Finance::ibans(100, IbanCountry::France);
+
+    ASSERT_EQ(ibans.size(), 100);
+
+    for (const auto& iban : ibans)
+    {
+        ASSERT_EQ(iban.size(), 27);
+        ASSERT_TRUE(iban.starts_with("FR"));
+        ASSERT_TRUE(checkIfAllCharactersAreAlphanumeric(iban.substr(14, 11)));
+        ASSERT_TRUE(checkIfIbanHasValidCheckDigits(iban)) << iban;
+    }
+}
+
+TEST_F(FinanceTest, shouldGenerateIbansOfRandomCountries)
+{
+    const auto ibans = Finance::ibans(50);
+
+    ASSERT_EQ(ibans.size(), 50);
+
+    for (const auto& iban : ibans)
+    {
+        ASSERT_TRUE(checkIfIbanHasValidCheckDigits(iban)) << iban;
+    }
+}
+
 TEST_F(FinanceTest, shouldGenerateBic)
 {
     const auto bic = Finance::bic();
@@ -211,7 +302,7 @@ TEST_F(FinanceTest, shouldGenerateBic)
     const auto polandBankIdentifiersCodes = bankIdentifiersCodesMapping.at(BicCountry::Poland);
 
     ASSERT_TRUE(std::any_of(polandBankIdentifiersCodes.begin(), polandBankIdentifiersCodes.end(),
-                            [bic](const std::string& polandBankIdentifierCode)
+                            [bic](std::string_view polandBankIdentifierCode)
                             { return bic == polandBankIdentifierCode; }));
 }
 
@@ -222,7 +313,7 @@ TEST_F(FinanceTest, shouldGeneratePolandBic)
     const auto polandBankIdentifiersCodes = bankIdentifiersCodesMapping.at(BicCountry::Poland);
 
     ASSERT_TRUE(std::any_of(polandBankIdentifiersCodes.begin(), polandBankIdentifiersCodes.end(),
-                            [bic](const std::string& polandBankIdentifierCode)
+                            [bic](std::string_view polandBankIdentifierCode)
                             { return bic == polandBankIdentifierCode; }));
 }
 
@@ -320,6 +411,34 @@ TEST_F(FinanceTest, shouldGenerateVisaCreditCardNumber)
     ASSERT_TRUE(LuhnCheck::luhnCheck(creditCardNumber));
 }
 
+TEST_F(FinanceTest, shouldGenerateCreditCardNumbers)
+{
+    const auto creditCardNumbers = Finance::creditCardNumbers(100, CreditCardType::Visa);
+
+    ASSERT_EQ(creditCardNumbers.size(), 100);
+
+    for (const auto& creditCardNumber : creditCardNumbers)
+    {
+        ASSERT_TRUE(creditCardNumber.size() == 13 || creditCardNumber.size() == 19);
+        ASSERT_TRUE(creditCardNumber.starts_with("4"));
+        ASSERT_TRUE(checkIfAllCharactersAreCreditCardCharacters(creditCardNumber));
+        ASSERT_TRUE(LuhnCheck::luhnCheck(creditCardNumber)) << creditCardNumber;
+    }
+}
+
+TEST_F(FinanceTest, shouldGenerateCreditCardNumbersOfRandomTypes)
+{
+    const auto creditCardNumbers = Finance::creditCardNumbers(100);
+
+    ASSERT_EQ(creditCardNumbers.size(), 100);
+
+    for (const auto& creditCardNumber : creditCardNumbers)
+    {
+        ASSERT_TRUE(checkIfAllCharactersAreCreditCardCharacters(creditCardNumber));
+        ASSERT_TRUE(LuhnCheck::luhnCheck(creditCardNumber)) << creditCardNumber;
+    }
+}
+
 TEST_F(FinanceTest, shouldGenerateCreditCardCvv)
 {
     const auto creditCardCvv = Finance::creditCardCvv();
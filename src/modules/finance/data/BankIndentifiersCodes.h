@@ -1,17 +1,20 @@
 #pragma once
 
-#include <map>
-#include <string>
-#include <vector>
+#include <array>
+#include <span>
+#include <string_view>
 
+#include "../../../common/EnumMap.h"
 #include "faker-cxx/types/BicCountry.h"
 
 namespace faker
 {
-const std::map<BicCountry, std::vector<std::string>> bankIdentifiersCodesMapping = {
-    {BicCountry::Poland,
-     {"BPKOPLPW", "PKOPPLPW", "BREXPLPWMUL", "BNPAPLP", "POLUPLPR", "BIGBPLPW", "WBKPPLPP", "CITIPLPX", "INGBPLPW",
-      "DEUTPLPK", "DEUTPLP"}}
+inline constexpr auto polandBankIdentifiersCodes =
+    std::to_array<std::string_view>({"BPKOPLPW", "PKOPPLPW", "BREXPLPWMUL", "BNPAPLP", "POLUPLPR", "BIGBPLPW",
+                                     "WBKPPLPP", "CITIPLPX", "INGBPLPW", "DEUTPLPK", "DEUTPLP"});
 
-};
+inline constexpr auto bankIdentifiersCodesMapping =
+    EnumMapBuilder::build<BicCountry, std::span<const std::string_view>, BicCountry::Poland>({
+        {BicCountry::Poland, polandBankIdentifiersCodes},
+    });
 }
@@ -1,17 +1,19 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> americanExpressCreditCardFormats = {"34##-######-####L", "37##-######-####L"};
+inline constexpr auto americanExpressCreditCardFormats = std::to_array<std::string_view>({
+    "34##-######-####L", "37##-######-####L"});
 
-const std::vector<std::string> discoverCreditCardFormats = {"6011-####-####-###L",      "65##-####-####-###L",
-                                                            "64[4-9]#-####-####-###L",  "6011-62##-####-####-###L",
-                                                            "65##-62##-####-####-###L", "64[4-9]#-62##-####-####-###L"};
+inline constexpr auto discoverCreditCardFormats = std::to_array<std::string_view>({
+    "6011-####-####-###L", "65##-####-####-###L", "64[4-9]#-####-####-###L", "6011-62##-####-####-###L",
+    "65##-62##-####-####-###L", "64[4-9]#-62##-####-####-###L"});
 
-const std::vector<std::string> masterCardCreditCardFormats = {"5[1-5]##-####-####-###L", "6771-89##-####-###L"};
+inline constexpr auto masterCardCreditCardFormats = std::to_array<std::string_view>({
+    "5[1-5]##-####-####-###L", "6771-89##-####-###L"});
 
-const std::vector<std::string> visaCreditCardFormats = {"4###########L", "4###-####-####-###L"};
+inline constexpr auto visaCreditCardFormats = std::to_array<std::string_view>({"4###########L", "4###-####-####-###L"});
 }
@@ -1,10 +1,10 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> currenciesCodes = {"USD", "EUR", "CHF", "JPY", "GBP", "PLN",
-                                                  "AUD", "CAD", "CNH", "HKD", "NZD"};
+inline constexpr auto currenciesCodes = std::to_array<std::string_view>({"USD", "EUR", "CHF", "JPY", "GBP", "PLN",
+                                                                  "AUD", "CAD", "CNH", "HKD", "NZD"});
 }
@@ -1,19 +1,26 @@
 #pragma once
 
-#include <map>
-#include <string>
-#include <vector>
+#include <array>
+#include <span>
+#include <string_view>
 
+#include "../../../common/EnumMap.h"
 #include "faker-cxx/types/IbanCountry.h"
 
 namespace faker
 {
 // Iban format structure from https://bank.codes/iban/structure/
 // Note: a - alphabets (letters only), c - characters (letters & numbers), n - numbers (numbers only)
-const std::map<IbanCountry, std::vector<std::string>> ibanFormats{
-    {IbanCountry::Poland, {"PL", "2n", "3n", "4n", "1n", "16n"}},
-    {IbanCountry::France, {"FR", "2n", "5n", "5n", "11c", "2n"}},
-    {IbanCountry::Italy, {"IT", "2n", "1a", "5n", "5n", "12c"}},
-    {IbanCountry::Germany, {"DE", "2n", "8n", "10n"}},
-};
+inline constexpr auto polandIbanFormat = std::to_array<std::string_view>({"PL", "2n", "3n", "4n", "1n", "16n"});
+inline constexpr auto franceIbanFormat = std::to_array<std::string_view>({"FR", "2n", "5n", "5n", "11c", "2n"});
+inline constexpr auto italyIbanFormat = std::to_array<std::string_view>({"IT", "2n", "1a", "5n", "5n", "12c"});
+inline constexpr auto germanyIbanFormat = std::to_array<std::string_view>({"DE", "2n", "8n", "10n"});
+
+inline constexpr auto ibanFormats =
+    EnumMapBuilder::build<IbanCountry, std::span<const std::string_view>, IbanCountry::Italy>({
+        {IbanCountry::Poland, polandIbanFormat},
+        {IbanCountry::France, franceIbanFormat},
+        {IbanCountry::Germany, germanyIbanFormat},
+        {IbanCountry::Italy, italyIbanFormat},
+    });
 }
@@ -1,24 +1,46 @@
 #include "faker-cxx/Helper.h"
 
+#include "../../common/RandomDigits.h"
+
 namespace faker
 {
 std::random_device Helper::randomDevice;
 
 std::mt19937 Helper::pseudoRandomGenerator(Helper::randomDevice());
 
-std::string Helper::replaceSymbolWithNumber(std::string str, const char& symbol)
+std::vector<std::size_t> Helper::sampleIndices(std::size_t size, std::size_t count)
 {
-    for (char& ch : str)
+    if (count > size)
     {
-        if(ch == symbol)
-        {
-            ch = static_cast<char>(Number::integer(0,9) + '0');
-        }
-        else if(ch == '!')
-        {
-            ch = static_cast<char>(Number::integer(2,9) + '0');
-        }
+        throw std::invalid_argument("Sample count must not be greater than the number of elements.");
     }
+
+    std::vector<std::size_t> indices;
+    std::unordered_set<std::size_t> pickedIndices;
+
+    indices.reserve(count);
+    pickedIndices.reserve(count);
+
+    for (auto upperBound = size - count; upperBound < size; upperBound++)
+    {
+        const auto index = Number::integer<std::size_t>(upperBound);
+
+        const auto pickedIndex = pickedIndices.contains(index) ? upperBound : index;
+
+        pickedIndices.insert(pickedIndex);
+
+        indices.push_back(pickedIndex);
+    }
+
+    std::shuffle(indices.begin(), indices.end(), pseudoRandomGenerator);
+
+    return indices;
+}
+
+std::string Helper::replaceSymbolWithNumber(std::string str, const char& symbol)
+{
+    RandomDigits::fillTemplate(str, symbol);
+
     return str;
 }
 
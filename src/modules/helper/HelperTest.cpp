@@ -2,6 +2,8 @@
 #include "gtest/gtest.h"
 #include <regex>
 #include <algorithm>
+#include <memory>
+#include <set>
 #include <unordered_map>
 #include <stdexcept>
 #include "faker-cxx/String.h"
@@ -77,6 +79,45 @@ TEST_F(HelperTest, ObjectKeyTest)
     }, std::runtime_error);
 }
 
+TEST_F(HelperTest, SampleIndices)
+{
+    const auto indices = Helper::sampleIndices(10, 4);
+
+    ASSERT_EQ(indices.size(), 4);
+    ASSERT_TRUE(std::all_of(indices.begin(), indices.end(), [](std::size_t index) { return index < 10; }));
+
+    std::set<std::size_t> uniqueIndices(indices.begin(), indices.end());
+    ASSERT_EQ(uniqueIndices.size(), indices.size());
+}
+
+TEST_F(HelperTest, SampleIndicesWholeRange)
+{
+    auto indices = Helper::sampleIndices(5, 5);
+
+    std::sort(indices.begin(), indices.end());
+
+    ASSERT_EQ(indices, (std::vector<std::size_t>{0, 1, 2, 3, 4}));
+}
+
+TEST_F(HelperTest, SampleIndicesThrowsWhenCountIsGreaterThanSize)
+{
+    ASSERT_THROW(Helper::sampleIndices(3, 4), std::invalid_argument);
+}
+
+TEST_F(HelperTest, Sample)
+{
+    const std::vector<std::string> data{"hello", "world", "foo", "bar"};
+
+    const auto sampledElements = Helper::sample<std::string>(data, 3);
+
+    ASSERT_EQ(sampledElements.size(), 3);
+    ASSERT_TRUE(std::all_of(sampledElements.begin(), sampledElements.end(), [&data](std::string_view element)
+                            { return std::find(data.begin(), data.end(), element) != data.end(); }));
+
+    std::set<std::string> uniqueElements(sampledElements.begin(), sampledElements.end());
+    ASSERT_EQ(uniqueElements.size(), sampledElements.size());
+}
+
 TEST_F(HelperTest, MaybeString)
 {
     double highProbability = 1;
@@ -110,4 +151,74 @@ TEST_F(HelperTest, MaybeDouble)
     result = Helper::maybe<double>([]() { return 3.14; }, lowProbability);
     EXPECT_EQ(result, 0.0);
 }
-}
\ No newline at end of file
+
+TEST_F(HelperTest, MaybeAcceptsNonCopyableCallable)
+{
+    auto value = std::make_unique<int>(7);
+
+    const auto result = Helper::maybe<int>([value = std::move(value)]() { return *value; }, 1);
+
+    EXPECT_EQ(result, 7);
+}
+
+TEST_F(HelperTest, OneOf)
+{
+    const auto result =
+        Helper::oneOf([]() { return "first"; }, []() { return std::string{"second"}; }, []() { return "third"; });
+
+    ASSERT_TRUE(result == "first" || result == "second" || result == "third");
+}
+
+TEST_F(HelperTest, OneOfWithSingleGenerator)
+{
+    const auto result = Helper::oneOf([]() { return 42; });
+
+    ASSERT_EQ(result, 42);
+}
+
+TEST_F(HelperTest, Weighted)
+{
+    for (int i = 0; i < 100; i++)
+    {
+        const auto result = Helper::weighted(std::pair{0, []() { return 1; }}, std::pair{5u, []() { return 2; }},
+                                             std::pair{0, []() { return 3; }});
+
+        ASSERT_EQ(result, 2);
+    }
+}
+
+TEST_F(HelperTest, WeightedThrowsWhenAllWeightsAreZero)
+{
+    ASSERT_THROW(Helper::weighted(std::pair{0, []() { return 1; }}), std::invalid_argument);
+}
+
+TEST_F(HelperTest, WeightedThrowsWhenWeightIsNegative)
+{
+    ASSERT_THROW(Helper::weighted(std::pair{-1, []() { return 1; }}, std::pair{3, []() { return 2; }}),
+                 std::invalid_argument);
+    ASSERT_THROW(Helper::weighted(std::pair{2, []() { return 1; }}, std::pair{-1, []() { return 2; }}),
+                 std::invalid_argument);
+}
+
+TEST_F(HelperTest, Repeat)
+{
+    const auto result = Helper::repeat(3, []() { return "ab"; }, "-");
+
+    ASSERT_EQ(result, "ab-ab-ab");
+}
+
+TEST_F(HelperTest, RepeatZeroTimes)
+{
+    const auto result = Helper::repeat(0, []() { return 'a'; });
+
+    ASSERT_EQ(result, "");
+}
+
+TEST_F(HelperTest, Join)
+{
+    const auto result = Helper::join(", ", []() { return "first"; }, []() { return std::string{"second"}; },
+                                     []() { return 'c'; });
+
+    ASSERT_EQ(result, "first, second, c");
+}
+}
@@ -1,9 +1,12 @@
 #include "faker-cxx/Internet.h"
 
 #include <format>
-#include <map>
+#include <span>
 #include <utility>
 
+#include "../../common/ArrayHelper.h"
+#include "../../common/EnumMap.h"
+#include "../../common/StringPool.h"
 #include "data/EmailHosts.h"
 #include "data/Emojis.h"
 #include "faker-cxx/Helper.h"
@@ -13,22 +16,28 @@ namespace faker
 {
 namespace
 {
-const std::vector<std::string> webProtocols{"http", "https"};
-const std::vector<std::string> httpMethodNames{"GET", "POST", "DELETE", "PATCH", "PUT"};
-const std::vector<unsigned> httpStatusInformationalCodes{100, 101, 102, 103};
-const std::vector<unsigned> httpStatusSuccessCodes{200, 201, 202, 203, 204, 205, 206, 207, 208, 226};
-const std::vector<unsigned> httpStatusRedirectionCodes{300, 301, 302, 303, 304, 305, 306, 307, 308};
-const std::vector<unsigned> httpStatusClientErrorCodes{400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
-                                                       410, 411, 412, 413, 414, 415, 416, 417, 418, 421,
-                                                       422, 423, 424, 425, 426, 428, 429, 431, 451};
-const std::vector<unsigned> httpStatusServerErrorCodes{500, 501, 502, 503, 504, 505, 506, 507, 508, 510, 511};
-const std::map<HttpResponseType, std::vector<unsigned>> httpResponseTypeToCodesMapping{
-    {HttpResponseType::Informational, httpStatusInformationalCodes},
-    {HttpResponseType::Success, httpStatusSuccessCodes},
-    {HttpResponseType::Redirection, httpStatusRedirectionCodes},
-    {HttpResponseType::ClientError, httpStatusClientErrorCodes},
-    {HttpResponseType::ServerError, httpStatusServerErrorCodes},
-};
+constexpr auto webProtocols = std::to_array<std::string_view>({"http", "https"});
+constexpr auto httpMethodNames = std::to_array<std::string_view>({"GET", "POST", "DELETE", "PATCH", "PUT"});
+constexpr auto usernameSeparators = std::to_array<std::string_view>({".", "_", ""});
+constexpr auto httpStatusInformationalCodes = std::to_array<unsigned>({100, 101, 102, 103});
+constexpr auto httpStatusSuccessCodes = std::to_array<unsigned>({200, 201, 202, 203, 204, 205, 206, 207, 208, 226});
+constexpr auto httpStatusRedirectionCodes = std::to_array<unsigned>({300, 301, 302, 303, 304, 305, 306, 307, 308});
+constexpr auto httpStatusClientErrorCodes =
+    std::to_array<unsigned>({400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414,
+                             415, 416, 417, 418, 421, 422, 423, 424, 425, 426, 428, 429, 431, 451});
+constexpr auto httpStatusServerErrorCodes =
+    std::to_array<unsigned>({500, 501, 502, 503, 504, 505, 506, 507, 508, 510, 511});
+constexpr auto httpResponseTypeToCodesMapping =
+    EnumMapBuilder::build<HttpResponseType, std::span<const unsigned>, HttpResponseType::ServerError>({
+        {HttpResponseType::Informational, httpStatusInformationalCodes},
+        {HttpResponseType::Success, httpStatusSuccessCodes},
+        {HttpResponseType::Redirection, httpStatusRedirectionCodes},
+        {HttpResponseType::ClientError, httpStatusClientErrorCodes},
+        {HttpResponseType::ServerError, httpStatusServerErrorCodes},
+    });
+constexpr auto allHttpStatusCodes =
+    ArrayHelper::concat(httpStatusInformationalCodes, httpStatusSuccessCodes, httpStatusRedirectionCodes,
+                        httpStatusClientErrorCodes, httpStatusServerErrorCodes);
 constexpr unsigned int ipv4AddressSectors = 4u;
 constexpr unsigned int ipv4ClassCFirstSector = 192u;
 constexpr unsigned int ipv4ClassCSecondSector = 168u;
@@ -37,12 +46,17 @@ constexpr unsigned int ipv4ClassBFirstSector = 172;
 constexpr unsigned int ipv4ClassBSecondSectorLowerBound = 16u;
 constexpr unsigned int ipv4ClassBSecondSectorUpperBound = 31u;
 constexpr unsigned int ipv4SectorUpperBound = 255u;
-const std::map<EmojiType, std::vector<std::string>> emojiTypeToEmojisMapping{
-    {EmojiType::Smiley, smileyEmojis},     {EmojiType::Body, bodyEmojis},     {EmojiType::Person, personEmojis},
-    {EmojiType::Nature, natureEmojis},     {EmojiType::Food, foodEmojis},     {EmojiType::Travel, travelEmojis},
-    {EmojiType::Activity, activityEmojis}, {EmojiType::Object, objectEmojis}, {EmojiType::Symbol, symbolEmojis},
-    {EmojiType::Flag, flagEmojis},
-};
+constexpr auto emojiPool = StringPoolBuilder::build<smileyEmojis, bodyEmojis, personEmojis, natureEmojis, foodEmojis,
+                                                     travelEmojis, activityEmojis, objectEmojis, symbolEmojis,
+                                                     flagEmojis>();
+constexpr auto emojiTypeToEmojisMapping = EnumMapBuilder::build<EmojiType, StringPoolView, EmojiType::Flag>({
+    {EmojiType::Smiley, emojiPool.list(0)},   {EmojiType::Body, emojiPool.list(1)},
+    {EmojiType::Person, emojiPool.list(2)},   {EmojiType::Nature, emojiPool.list(3)},
+    {EmojiType::Food, emojiPool.list(4)},     {EmojiType::Travel, emojiPool.list(5)},
+    {EmojiType::Activity, emojiPool.list(6)}, {EmojiType::Object, emojiPool.list(7)},
+    {EmojiType::Symbol, emojiPool.list(8)},   {EmojiType::Flag, emojiPool.list(9)},
+});
+constexpr auto allEmojis = emojiPool.all();
 }
 
 std::string Internet::username(std::optional<std::string> firstNameInit, std::optional<std::string> lastNameInit)
@@ -58,13 +72,12 @@ std::string Internet::username(std::optional<std::string> firstNameInit, std::op
         username = std::format("{}{}{}", firstName, lastName, Number::integer<int>(999));
         break;
     case 1:
-        username = std::format("{}{}{}", firstName,
-                               Helper::arrayElement<std::string>(std::vector<std::string>{".", "_", ""}), lastName);
+        username =
+            std::format("{}{}{}", firstName, Helper::arrayElement<std::string_view>(usernameSeparators), lastName);
         break;
     case 2:
-        username = std::format("{}{}{}{}", firstName,
-                               Helper::arrayElement<std::string>(std::vector<std::string>{".", "_", ""}), lastName,
-                               Number::integer<int>(99));
+        username = std::format("{}{}{}{}", firstName, Helper::arrayElement<std::string_view>(usernameSeparators),
+                               lastName, Number::integer<int>(99));
         break;
     }
 
@@ -75,13 +88,13 @@ std::string Internet::email(std::optional<std::string> firstName, std::optional<
                             std::optional<std::string> emailHost)
 {
     return std::format("{}@{}", username(std::move(firstName), std::move(lastName)),
-                       emailHost ? *emailHost : Helper::arrayElement<std::string>(emailHosts));
+                       emailHost ? *emailHost : std::string{Helper::arrayElement<std::string_view>(emailHosts)});
 }
 
 std::string Internet::exampleEmail(std::optional<std::string> firstName, std::optional<std::string> lastName)
 {
     return std::format("{}@{}", username(std::move(firstName), std::move(lastName)),
-                       Helper::arrayElement<std::string>(emailExampleHosts));
+                       std::string{Helper::arrayElement<std::string_view>(emailExampleHosts)});
 }
 
 std::string Internet::password(int length)
@@ -109,58 +122,67 @@ std::string Internet::githubAvatarUrl()
 }
 
 std::string Internet::emoji(std::optional<EmojiType> type)
+{
+    return std::string{emojiView(type)};
+}
+
+std::string_view Internet::emojiView(std::optional<EmojiType> type)
+{
+    const auto emojis = emojiDictionary(type);
+
+    return emojis[emojis.randomIndex()];
+}
+
+Dictionary Internet::emojiDictionary(std::optional<EmojiType> type)
 {
     if (type)
     {
-        const auto& emojis = emojiTypeToEmojisMapping.at(*type);
-
-        return Helper::arrayElement<std::string>(emojis);
+        return Dictionary{emojiTypeToEmojisMapping.at(*type)};
     }
 
-    std::vector<std::string> emojis;
+    return Dictionary{allEmojis};
+}
 
-    emojis.insert(emojis.end(), smileyEmojis.begin(), smileyEmojis.end());
-    emojis.insert(emojis.end(), bodyEmojis.begin(), bodyEmojis.end());
-    emojis.insert(emojis.end(), personEmojis.begin(), personEmojis.end());
-    emojis.insert(emojis.end(), natureEmojis.begin(), natureEmojis.end());
-    emojis.insert(emojis.end(), foodEmojis.begin(), foodEmojis.end());
-    emojis.insert(emojis.end(), travelEmojis.begin(), travelEmojis.end());
-    emojis.insert(emojis.end(), activityEmojis.begin(), activityEmojis.end());
-    emojis.insert(emojis.end(), objectEmojis.begin(), objectEmojis.end());
-    emojis.insert(emojis.end(), symbolEmojis.begin(), symbolEmojis.end());
-    emojis.insert(emojis.end(), flagEmojis.begin(), flagEmojis.end());
+std::string Internet::protocol()
+{
+    return std::string{protocolView()};
+}
 
-    return Helper::arrayElement<std::string>(emojis);
+std::string_view Internet::protocolView()
+{
+    return Helper::arrayElement<std::string_view>(webProtocols);
 }
 
-std::string Internet::protocol()
+Dictionary Internet::protocolDictionary()
 {
-    return Helper::arrayElement<std::string>(webProtocols);
+    return Dictionary{webProtocols};
 }
 
 std::string Internet::httpMethod()
 {
-    return Helper::arrayElement<std::string>(httpMethodNames);
+    return std::string{httpMethodView()};
+}
+
+std::string_view Internet::httpMethodView()
+{
+    return Helper::arrayElement<std::string_view>(httpMethodNames);
+}
+
+Dictionary Internet::httpMethodDictionary()
+{
+    return Dictionary{httpMethodNames};
 }
 
 unsigned Internet::httpStatusCode(std::optional<HttpResponseType> responseType)
 {
     if (responseType)
     {
-        const auto& statusCodes = httpResponseTypeToCodesMapping.at(*responseType);
+        const auto statusCodes = httpResponseTypeToCodesMapping.at(*responseType);
 
         return Helper::arrayElement<unsigned>(statusCodes);
     }
 
-    std::vector<unsigned> statusCodes;
-
-    statusCodes.insert(statusCodes.end(), httpStatusInformationalCodes.begin(), httpStatusInformationalCodes.end());
-    statusCodes.insert(statusCodes.end(), httpStatusSuccessCodes.begin(), httpStatusSuccessCodes.end());
-    statusCodes.insert(statusCodes.end(), httpStatusRedirectionCodes.begin(), httpStatusRedirectionCodes.end());
-    statusCodes.insert(statusCodes.end(), httpStatusClientErrorCodes.begin(), httpStatusClientErrorCodes.end());
-    statusCodes.insert(statusCodes.end(), httpStatusServerErrorCodes.begin(), httpStatusServerErrorCodes.end());
-
-    return Helper::arrayElement<unsigned>(statusCodes);
+    return Helper::arrayElement<unsigned>(allHttpStatusCodes);
 }
 
 std::string Internet::ipv4(IPv4Class ipv4class)
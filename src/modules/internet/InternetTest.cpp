@@ -61,17 +61,17 @@ public:
 
 TEST_F(InternetTest, shouldGenerateUsername)
 {
-    std::vector<std::string> firstNames{firstNamesMales};
+    std::vector<std::string_view> firstNames(firstNamesMales.begin(), firstNamesMales.end());
 
     firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
     const auto username = Internet::username();
 
     ASSERT_TRUE(std::any_of(firstNames.begin(), firstNames.end(),
-                            [username](const std::string& firstName)
+                            [username](std::string_view firstName)
                             { return username.find(firstName) != std::string::npos; }));
     ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                            [username](const std::string& lastName)
+                            [username](std::string_view lastName)
                             { return username.find(lastName) != std::string::npos; }));
 }
 
@@ -83,13 +83,13 @@ TEST_F(InternetTest, shouldGenerateUsernameWithFirstNameProvided)
 
     ASSERT_TRUE(username.find(firstName) != std::string::npos);
     ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                            [username](const std::string& lastName)
+                            [username](std::string_view lastName)
                             { return username.find(lastName) != std::string::npos; }));
 }
 
 TEST_F(InternetTest, shouldGenerateUsernameWithLastNameProvided)
 {
-    std::vector<std::string> firstNames{firstNamesMales};
+    std::vector<std::string_view> firstNames(firstNamesMales.begin(), firstNamesMales.end());
 
     firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
@@ -98,7 +98,7 @@ TEST_F(InternetTest, shouldGenerateUsernameWithLastNameProvided)
     const auto username = Internet::username(std::nullopt, lastName);
 
     ASSERT_TRUE(std::any_of(firstNames.begin(), firstNames.end(),
-                            [username](const std::string& firstName)
+                            [username](std::string_view firstName)
                             { return username.find(firstName) != std::string::npos; }));
     ASSERT_TRUE(username.find(lastName) != std::string::npos);
 }
@@ -117,7 +117,7 @@ TEST_F(InternetTest, shouldGenerateUsernameWithFullNameProvided)
 
 TEST_F(InternetTest, shouldGenerateEmail)
 {
-    std::vector<std::string> firstNames{firstNamesMales};
+    std::vector<std::string_view> firstNames(firstNamesMales.begin(), firstNamesMales.end());
 
     firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
@@ -131,13 +131,13 @@ TEST_F(InternetTest, shouldGenerateEmail)
     const auto& generatedEmailHost = emailParts[1];
 
     ASSERT_TRUE(std::any_of(emailHosts.begin(), emailHosts.end(),
-                            [generatedEmailHost](const std::string& emailHost)
+                            [generatedEmailHost](std::string_view emailHost)
                             { return generatedEmailHost == emailHost; }));
     ASSERT_TRUE(std::any_of(firstNames.begin(), firstNames.end(),
-                            [generatedUsername](const std::string& firstName)
+                            [generatedUsername](std::string_view firstName)
                             { return generatedUsername.find(firstName) != std::string::npos; }));
     ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                            [generatedUsername](const std::string& lastName)
+                            [generatedUsername](std::string_view lastName)
                             { return generatedUsername.find(lastName) != std::string::npos; }));
 }
 
@@ -155,17 +155,17 @@ TEST_F(InternetTest, shouldGenerateEmailWithFirstName)
     const auto& generatedEmailHost = emailParts[1];
 
     ASSERT_TRUE(std::any_of(emailHosts.begin(), emailHosts.end(),
-                            [generatedEmailHost](const std::string& emailHost)
+                            [generatedEmailHost](std::string_view emailHost)
                             { return generatedEmailHost == emailHost; }));
     ASSERT_TRUE(generatedUsername.find(firstName) != std::string::npos);
     ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                            [generatedUsername](const std::string& lastName)
+                            [generatedUsername](std::string_view lastName)
                             { return generatedUsername.find(lastName) != std::string::npos; }));
 }
 
 TEST_F(InternetTest, shouldGenerateEmailWithLastName)
 {
-    std::vector<std::string> firstNames{firstNamesMales};
+    std::vector<std::string_view> firstNames(firstNamesMales.begin(), firstNamesMales.end());
 
     firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
@@ -181,17 +181,17 @@ TEST_F(InternetTest, shouldGenerateEmailWithLastName)
     const auto& generatedEmailHost = emailParts[1];
 
     ASSERT_TRUE(std::any_of(emailHosts.begin(), emailHosts.end(),
-                            [generatedEmailHost](const std::string& emailHost)
+                            [generatedEmailHost](std::string_view emailHost)
                             { return generatedEmailHost == emailHost; }));
     ASSERT_TRUE(std::any_of(firstNames.begin(), firstNames.end(),
-                            [generatedUsername](const std::string& firstName)
+                            [generatedUsername](std::string_view firstName)
                             { return generatedUsername.find(firstName) != std::string::npos; }));
     ASSERT_TRUE(generatedUsername.find(lastName) != std::string::npos);
 }
 
 TEST_F(InternetTest, shouldGenerateEmailWithFullName)
 {
-    std::vector<std::string> firstNames{firstNamesMales};
+    std::vector<std::string_view> firstNames(firstNamesMales.begin(), firstNamesMales.end());
 
     firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
@@ -209,7 +209,7 @@ TEST_F(InternetTest, shouldGenerateEmailWithFullName)
     const auto& generatedEmailHost = emailParts[1];
 
     ASSERT_TRUE(std::any_of(emailHosts.begin(), emailHosts.end(),
-                            [generatedEmailHost](const std::string& emailHost)
+                            [generatedEmailHost](std::string_view emailHost)
                             { return generatedEmailHost == emailHost; }));
     ASSERT_TRUE(generatedUsername.find(firstName) != std::string::npos);
     ASSERT_TRUE(generatedUsername.find(lastName) != std::string::npos);
@@ -217,7 +217,7 @@ TEST_F(InternetTest, shouldGenerateEmailWithFullName)
 
 TEST_F(InternetTest, shouldGenerateEmailWithSpecifiedEmailHost)
 {
-    std::vector<std::string> firstNames{firstNamesMales};
+    std::vector<std::string_view> firstNames(firstNamesMales.begin(), firstNamesMales.end());
 
     firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
@@ -234,16 +234,16 @@ TEST_F(InternetTest, shouldGenerateEmailWithSpecifiedEmailHost)
 
     ASSERT_EQ(generatedEmailHost, emailHost);
     ASSERT_TRUE(std::any_of(firstNames.begin(), firstNames.end(),
-                            [generatedUsername](const std::string& firstName)
+                            [generatedUsername](std::string_view firstName)
                             { return generatedUsername.find(firstName) != std::string::npos; }));
     ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                            [generatedUsername](const std::string& lastName)
+                            [generatedUsername](std::string_view lastName)
                             { return generatedUsername.find(lastName) != std::string::npos; }));
 }
 
 TEST_F(InternetTest, shouldGenerateExampleEmail)
 {
-    std::vector<std::string> firstNames{firstNamesMales};
+    std::vector<std::string_view> firstNames(firstNamesMales.begin(), firstNamesMales.end());
 
     firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
@@ -257,13 +257,13 @@ TEST_F(InternetTest, shouldGenerateExampleEmail)
     const auto& generatedEmailHost = emailParts[1];
 
     ASSERT_TRUE(std::any_of(emailExampleHosts.begin(), emailExampleHosts.end(),
-                            [generatedEmailHost](const std::string& emailHost)
+                            [generatedEmailHost](std::string_view emailHost)
                             { return generatedEmailHost == emailHost; }));
     ASSERT_TRUE(std::any_of(firstNames.begin(), firstNames.end(),
-                            [generatedUsername](const std::string& firstName)
+                            [generatedUsername](std::string_view firstName)
                             { return generatedUsername.find(firstName) != std::string::npos; }));
     ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                            [generatedUsername](const std::string& lastName)
+                            [generatedUsername](std::string_view lastName)
                             { return generatedUsername.find(lastName) != std::string::npos; }));
 }
 
@@ -281,17 +281,17 @@ TEST_F(InternetTest, shouldGenerateExampleEmailWithFirstName)
     const auto& generatedEmailHost = emailParts[1];
 
     ASSERT_TRUE(std::any_of(emailExampleHosts.begin(), emailExampleHosts.end(),
-                            [generatedEmailHost](const std::string& emailHost)
+                            [generatedEmailHost](std::string_view emailHost)
                             { return generatedEmailHost == emailHost; }));
     ASSERT_TRUE(generatedUsername.find(firstName) != std::string::npos);
     ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                            [generatedUsername](const std::string& lastName)
+                            [generatedUsername](std::string_view lastName)
                             { return generatedUsername.find(lastName) != std::string::npos; }));
 }
 
 TEST_F(InternetTest, shouldGenerateExampleEmailWithLastName)
 {
-    std::vector<std::string> firstNames{firstNamesMales};
+    std::vector<std::string_view> firstNames(firstNamesMales.begin(), firstNamesMales.end());
 
     firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
@@ -307,17 +307,17 @@ TEST_F(InternetTest, shouldGenerateExampleEmailWithLastName)
     const auto& generatedEmailHost = emailParts[1];
 
     ASSERT_TRUE(std::any_of(emailExampleHosts.begin(), emailExampleHosts.end(),
-                            [generatedEmailHost](const std::string& emailHost)
+                            [generatedEmailHost](std::string_view emailHost)
                             { return generatedEmailHost == emailHost; }));
     ASSERT_TRUE(std::any_of(firstNames.begin(), firstNames.end(),
-                            [generatedUsername](const std::string& firstName)
+                            [generatedUsername](std::string_view firstName)
                             { return generatedUsername.find(firstName) != std::string::npos; }));
     ASSERT_TRUE(generatedUsername.find(lastName) != std::string::npos);
 }
 
 TEST_F(InternetTest, shouldGenerateExampleEmailWithFullName)
 {
-    std::vector<std::string> firstNames{firstNamesMales};
+    std::vector<std::string_view> firstNames(firstNamesMales.begin(), firstNamesMales.end());
 
     firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
@@ -335,7 +335,7 @@ TEST_F(InternetTest, shouldGenerateExampleEmailWithFullName)
     const auto& generatedEmailHost = emailParts[1];
 
     ASSERT_TRUE(std::any_of(emailExampleHosts.begin(), emailExampleHosts.end(),
-                            [generatedEmailHost](const std::string& emailHost)
+                            [generatedEmailHost](std::string_view emailHost)
                             { return generatedEmailHost == emailHost; }));
     ASSERT_TRUE(generatedUsername.find(firstName) != std::string::npos);
     ASSERT_TRUE(generatedUsername.find(lastName) != std::string::npos);
@@ -407,7 +407,7 @@ TEST_F(InternetTest, shouldGenerateEmoji)
     emojis.insert(emojis.end(), flagEmojis.begin(), flagEmojis.end());
 
     ASSERT_TRUE(std::any_of(emojis.begin(), emojis.end(),
-                            [generatedEmoji](const std::string& emoji)
+                            [generatedEmoji](std::string_view emoji)
                             { return generatedEmoji == emoji; }));
 }
 
@@ -416,7 +416,7 @@ TEST_F(InternetTest, shouldGenerateSmileyEmoji)
     const auto generatedEmoji = Internet::emoji(EmojiType::Smiley);
 
     ASSERT_TRUE(std::any_of(smileyEmojis.begin(), smileyEmojis.end(),
-                            [generatedEmoji](const std::string& emoji)
+                            [generatedEmoji](std::string_view emoji)
                             { return generatedEmoji == emoji; }));
 }
 
@@ -425,16 +425,34 @@ TEST_F(InternetTest, shouldGenerateBodyEmoji)
     const auto generatedEmoji = Internet::emoji(EmojiType::Body);
 
     ASSERT_TRUE(std::any_of(bodyEmojis.begin(), bodyEmojis.end(),
-                            [generatedEmoji](const std::string& emoji)
+                            [generatedEmoji](std::string_view emoji)
                             { return generatedEmoji == emoji; }));
 }
 
+TEST_F(InternetTest, shouldGenerateBodyEmojiView)
+{
+    const auto generatedEmoji = Internet::emojiView(EmojiType::Body);
+
+    ASSERT_TRUE(std::any_of(bodyEmojis.begin(), bodyEmojis.end(),
+                            [generatedEmoji](std::string_view emoji)
+                            { return generatedEmoji == emoji; }));
+}
+
+TEST_F(InternetTest, shouldReturnEmojiDictionary)
+{
+    const auto bodyEmojiDictionary = Internet::emojiDictionary(EmojiType::Body);
+
+    ASSERT_EQ(bodyEmojiDictionary.size(), bodyEmojis.size());
+    ASSERT_EQ(bodyEmojiDictionary[0], bodyEmojis[0]);
+    ASSERT_GT(Internet::emojiDictionary().size(), bodyEmojiDictionary.size());
+}
+
 TEST_F(InternetTest, shouldGeneratePersonEmoji)
 {
     const auto generatedEmoji = Internet::emoji(EmojiType::Person);
 
     ASSERT_TRUE(std::any_of(personEmojis.begin(), personEmojis.end(),
-                            [generatedEmoji](const std::string& emoji)
+                            [generatedEmoji](std::string_view emoji)
                             { return generatedEmoji == emoji; }));
 }
 
@@ -443,7 +461,7 @@ TEST_F(InternetTest, shouldGenerateNatureEmoji)
     const auto generatedEmoji = Internet::emoji(EmojiType::Nature);
 
     ASSERT_TRUE(std::any_of(natureEmojis.begin(), natureEmojis.end(),
-                            [generatedEmoji](const std::string& emoji)
+                            [generatedEmoji](std::string_view emoji)
                             { return generatedEmoji == emoji; }));
 }
 
@@ -452,7 +470,7 @@ TEST_F(InternetTest, shouldGenerateFoodEmoji)
     const auto generatedEmoji = Internet::emoji(EmojiType::Food);
 
     ASSERT_TRUE(std::any_of(foodEmojis.begin(), foodEmojis.end(),
-                            [generatedEmoji](const std::string& emoji)
+                            [generatedEmoji](std::string_view emoji)
                             { return generatedEmoji == emoji; }));
 }
 
@@ -461,7 +479,7 @@ TEST_F(InternetTest, shouldGenerateTravelEmoji)
     const auto generatedEmoji = Internet::emoji(EmojiType::Travel);
 
     ASSERT_TRUE(std::any_of(travelEmojis.begin(), travelEmojis.end(),
-                            [generatedEmoji](const std::string& emoji)
+                            [generatedEmoji](std::string_view emoji)
                             { return generatedEmoji == emoji; }));
 }
 
@@ -470,7 +488,7 @@ TEST_F(InternetTest, shouldGenerateActivityEmoji)
     const auto generatedEmoji = Internet::emoji(EmojiType::Activity);
 
     ASSERT_TRUE(std::any_of(activityEmojis.begin(), activityEmojis.end(),
-                            [generatedEmoji](const std::string& emoji)
+                            [generatedEmoji](std::string_view emoji)
                             { return generatedEmoji == emoji; }));
 }
 
@@ -479,7 +497,7 @@ TEST_F(InternetTest, shouldGenerateObjectEmoji)
     const auto generatedEmoji = Internet::emoji(EmojiType::Object);
 
     ASSERT_TRUE(std::any_of(objectEmojis.begin(), objectEmojis.end(),
-                            [generatedEmoji](const std::string& emoji)
+                            [generatedEmoji](std::string_view emoji)
                             { return generatedEmoji == emoji; }));
 }
 
@@ -488,7 +506,7 @@ TEST_F(InternetTest, shouldGenerateSymbolEmoji)
     const auto generatedEmoji = Internet::emoji(EmojiType::Symbol);
 
     ASSERT_TRUE(std::any_of(symbolEmojis.begin(), symbolEmojis.end(),
-                            [generatedEmoji](const std::string& emoji)
+                            [generatedEmoji](std::string_view emoji)
                             { return generatedEmoji == emoji; }));
 }
 
@@ -497,7 +515,7 @@ TEST_F(InternetTest, shouldGenerateFlagEmoji)
     const auto generatedEmoji = Internet::emoji(EmojiType::Flag);
 
     ASSERT_TRUE(std::any_of(flagEmojis.begin(), flagEmojis.end(),
-                            [generatedEmoji](const std::string& emoji)
+                            [generatedEmoji](std::string_view emoji)
                             { return generatedEmoji == emoji; }));
 }
 
@@ -506,7 +524,7 @@ TEST_F(InternetTest, shouldGenerateProtocol)
     const auto webProtocol = Internet::protocol();
 
     ASSERT_TRUE(std::any_of(webProtocols.begin(), webProtocols.end(),
-                            [webProtocol](const std::string& protocol) { return webProtocol == protocol; }));
+                            [webProtocol](std::string_view protocol) { return webProtocol == protocol; }));
 }
 
 TEST_F(InternetTest, shouldGenerateHttpMethod)
@@ -514,7 +532,7 @@ TEST_F(InternetTest, shouldGenerateHttpMethod)
     const auto generatedHttpMethod = Internet::httpMethod();
 
     ASSERT_TRUE(std::any_of(httpMethodNames.begin(), httpMethodNames.end(),
-                            [generatedHttpMethod](const std::string& httpMethod)
+                            [generatedHttpMethod](std::string_view httpMethod)
                             { return generatedHttpMethod == httpMethod; }));
 }
 
@@ -1,17 +1,17 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> emailHosts = {
+inline constexpr auto emailHosts = std::to_array<std::string_view>({
     "gmail.com",
     "yahoo.com",
     "hotmail.com",
     "outlook.com",
-};
+});
 
-const std::vector<std::string> emailExampleHosts = {"example.org", "example.com", "example.net"};
+inline constexpr auto emailExampleHosts = std::to_array<std::string_view>({"example.org", "example.com", "example.net"});
 
 }
@@ -1,7 +1,7 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 // Source: https://www.unicode.org/Public/emoji/13.1/emoji-test.txt
 // Others: https://www.unicode.org/Public/emoji/
@@ -9,164 +9,164 @@
 
 namespace faker
 {
-const std::vector<std::string> smileyEmojis = {"😀",
-                                               "😃",
-                                               "😄",
-                                               "😁",
-                                               "😆",
-                                               "😅",
-                                               "🤣",
-                                               "😂",
-                                               "🙂",
-                                               "🙃",
-                                               "😉",
-                                               "😊",
-                                               "😇",
-                                               "🥰",
-                                               "😍",
-                                               "🤩",
-                                               "😘",
-                                               "😗",
-                                               "☺️",
-                                               "😚",
-                                               "😙",
-                                               "🥲",
-                                               "😋",
-                                               "😛",
-                                               "😜",
-                                               "🤪",
-                                               "😝",
-                                               "🤑",
-                                               "🤗",
-                                               "🤭",
-                                               "🤫",
-                                               "🤔",
-                                               "🤐",
-                                               "🤨",
-                                               "😐",
-                                               "😑",
-                                               "😶",
-                                               "😶‍🌫️",
-                                               "😏",
-                                               "😒",
-                                               "🙄",
-                                               "😬",
-                                               "😮‍💨",
-                                               "🤥",
-                                               "😌",
-                                               "😔",
-                                               "😪",
-                                               "🤤",
-                                               "😴",
-                                               "😷",
-                                               "🤒",
-                                               "🤕",
-                                               "🤢",
-                                               "🤮",
-                                               "🤧",
-                                               "🥵",
-                                               "🥶",
-                                               "🥴",
-                                               "😵",
-                                               "😵‍💫",
-                                               "🤯",
-                                               "🤠",
-                                               "🥳",
-                                               "🥸",
-                                               "😎",
-                                               "🤓",
-                                               "🧐",
-                                               "😕",
-                                               "😟",
-                                               "🙁",
-                                               "☹️",
-                                               "😮",
-                                               "😯",
-                                               "😲",
-                                               "😳",
-                                               "🥺",
-                                               "😦",
-                                               "😧",
-                                               "😨",
-                                               "😰",
-                                               "😥",
-                                               "😢",
-                                               "😭",
-                                               "😱",
-                                               "😖",
-                                               "😣",
-                                               "😞",
-                                               "😓",
-                                               "😩",
-                                               "😫",
-                                               "🥱",
-                                               "😤",
-                                               "😡",
-                                               "😠",
-                                               "🤬",
-                                               "😈",
-                                               "👿",
-                                               "💀",
-                                               "☠️",
-                                               "💩",
-                                               "🤡",
-                                               "👹",
-                                               "👺",
-                                               "👻",
-                                               "👽",
-                                               "👾",
-                                               "🤖",
-                                               "😺",
-                                               "😸",
-                                               "😹",
-                                               "😻",
-                                               "😼",
-                                               "😽",
-                                               "🙀",
-                                               "😿",
-                                               "😾",
-                                               "🙈",
-                                               "🙉",
-                                               "🙊",
-                                               "💋",
-                                               "💌",
-                                               "💘",
-                                               "💝",
-                                               "💖",
-                                               "💗",
-                                               "💓",
-                                               "💞",
-                                               "💕",
-                                               "💟",
-                                               "❣️",
-                                               "💔",
-                                               "❤️‍🔥",
-                                               "❤️‍🩹",
-                                               "❤️",
-                                               "🧡",
-                                               "💛",
-                                               "💚",
-                                               "💙",
-                                               "💜",
-                                               "🤎",
-                                               "🖤",
-                                               "🤍",
-                                               "💯",
-                                               "💢",
-                                               "💥",
-                                               "💫",
-                                               "💦",
-                                               "💨",
-                                               "🕳️",
-                                               "💣",
-                                               "💬",
-                                               "👁️‍🗨️",
-                                               "🗨️",
-                                               "🗯️",
-                                               "💭",
-                                               "💤"};
+inline constexpr auto smileyEmojis = std::to_array<std::string_view>({"😀",
+                                                               "😃",
+                                                               "😄",
+                                                               "😁",
+                                                               "😆",
+                                                               "😅",
+                                                               "🤣",
+                                                               "😂",
+                                                               "🙂",
+                                                               "🙃",
+                                                               "😉",
+                                                               "😊",
+                                                               "😇",
+                                                               "🥰",
+                                                               "😍",
+                                                               "🤩",
+                                                               "😘",
+                                                               "😗",
+                                                               "☺️",
+                                                               "😚",
+                                                               "😙",
+                                                               "🥲",
+                                                               "😋",
+                                                               "😛",
+                                                               "😜",
+                                                               "🤪",
+                                                               "😝",
+                                                               "🤑",
+                                                               "🤗",
+                                                               "🤭",
+                                                               "🤫",
+                                                               "🤔",
+                                                               "🤐",
+                                                               "🤨",
+                                                               "😐",
+                                                               "😑",
+                                                               "😶",
+                                                               "😶‍🌫️",
+                                                               "😏",
+                                                               "😒",
+                                                               "🙄",
+                                                               "😬",
+                                                               "😮‍💨",
+                                                               "🤥",
+                                                               "😌",
+                                                               "😔",
+                                                               "😪",
+                                                               "🤤",
+                                                               "😴",
+                                                               "😷",
+                                                               "🤒",
+                                                               "🤕",
+                                                               "🤢",
+                                                               "🤮",
+                                                               "🤧",
+                                                               "🥵",
+                                                               "🥶",
+                                                               "🥴",
+                                                               "😵",
+                                                               "😵‍💫",
+                                                               "🤯",
+                                                               "🤠",
+                                                               "🥳",
+                                                               "🥸",
+                                                               "😎",
+                                                               "🤓",
+                                                               "🧐",
+                                                               "😕",
+                                                               "😟",
+                                                               "🙁",
+                                                               "☹️",
+                                                               "😮",
+                                                               "😯",
+                                                               "😲",
+                                                               "😳",
+                                                               "🥺",
+                                                               "😦",
+                                                               "😧",
+                                                               "😨",
+                                                               "😰",
+                                                               "😥",
+                                                               "😢",
+                                                               "😭",
+                                                               "😱",
+                                                               "😖",
+                                                               "😣",
+                                                               "😞",
+                                                               "😓",
+                                                               "😩",
+                                                               "😫",
+                                                               "🥱",
+                                                               "😤",
+                                                               "😡",
+                                                               "😠",
+                                                               "🤬",
+                                                               "😈",
+                                                               "👿",
+                                                               "💀",
+                                                               "☠️",
+                                                               "💩",
+                                                               "🤡",
+                                                               "👹",
+                                                               "👺",
+                                                               "👻",
+                                                               "👽",
+                                                               "👾",
+                                                               "🤖",
+                                                               "😺",
+                                                               "😸",
+                                                               "😹",
+                                                               "😻",
+                                                               "😼",
+                                                               "😽",
+                                                               "🙀",
+                                                               "😿",
+                                                               "😾",
+                                                               "🙈",
+                                                               "🙉",
+                                                               "🙊",
+                                                               "💋",
+                                                               "💌",
+                                                               "💘",
+                                                               "💝",
+                                                               "💖",
+                                                               "💗",
+                                                               "💓",
+                                                               "💞",
+                                                               "💕",
+                                                               "💟",
+                                                               "❣️",
+                                                               "💔",
+                                                               "❤️‍🔥",
+                                                               "❤️‍🩹",
+                                                               "❤️",
+                                                               "🧡",
+                                                               "💛",
+                                                               "💚",
+                                                               "💙",
+                                                               "💜",
+                                                               "🤎",
+                                                               "🖤",
+                                                               "🤍",
+                                                               "💯",
+                                                               "💢",
+                                                               "💥",
+                                                               "💫",
+                                                               "💦",
+                                                               "💨",
+                                                               "🕳️",
+                                                               "💣",
+                                                               "💬",
+                                                               "👁️‍🗨️",
+                                                               "🗨️",
+                                                               "🗯️",
+                                                               "💭",
+                                                               "💤"});
 
-const std::vector<std::string> bodyEmojis = {
+inline constexpr auto bodyEmojis = std::to_array<std::string_view>({
     "👋",        "👋🏻", "👋🏼", "👋🏽", "👋🏾", "👋🏿", "🤚",     "🤚🏻", "🤚🏼",
     "🤚🏽", "🤚🏾", "🤚🏿", "🖐️",  "🖐🏻", "🖐🏼", "🖐🏽", "🖐🏾", "🖐🏿",
     "✋",        "✋🏻",  "✋🏼",  "✋🏽",  "✋🏾",  "✋🏿",  "🖖",     "🖖🏻", "🖖🏼",
@@ -194,1813 +194,1813 @@ const std::vector<std::string> bodyEmojis = {
     "🦶🏽", "🦶🏾", "🦶🏿", "👂",        "👂🏻", "👂🏼", "👂🏽", "👂🏾", "👂🏿",
     "🦻",     "🦻🏻", "🦻🏼", "🦻🏽", "🦻🏾", "🦻🏿", "👃",        "👃🏻", "👃🏼",
     "👃🏽", "👃🏾", "👃🏿", "🧠",     "🫀",     "🫁",     "🦷",     "🦴",     "👀",
-    "👁️",  "👅",        "👄"};
+    "👁️",  "👅",        "👄"});
 
-const std::vector<std::string> personEmojis = {"👶",
-                                               "👶🏻",
-                                               "👶🏼",
-                                               "👶🏽",
-                                               "👶🏾",
-                                               "👶🏿",
-                                               "🧒",
-                                               "🧒🏻",
-                                               "🧒🏼",
-                                               "🧒🏽",
-                                               "🧒🏾",
-                                               "🧒🏿",
-                                               "👦",
-                                               "👦🏻",
-                                               "👦🏼",
-                                               "👦🏽",
-                                               "👦🏾",
-                                               "👦🏿",
-                                               "👧",
-                                               "👧🏻",
-                                               "👧🏼",
-                                               "👧🏽",
-                                               "👧🏾",
-                                               "👧🏿",
-                                               "🧑",
-                                               "🧑🏻",
-                                               "🧑🏼",
-                                               "🧑🏽",
-                                               "🧑🏾",
-                                               "🧑🏿",
-                                               "👱",
-                                               "👱🏻",
-                                               "👱🏼",
-                                               "👱🏽",
-                                               "👱🏾",
-                                               "👱🏿",
-                                               "👨",
-                                               "👨🏻",
-                                               "👨🏼",
-                                               "👨🏽",
-                                               "👨🏾",
-                                               "👨🏿",
-                                               "🧔",
-                                               "🧔🏻",
-                                               "🧔🏼",
-                                               "🧔🏽",
-                                               "🧔🏾",
-                                               "🧔🏿",
-                                               "🧔‍♂️",
-                                               "🧔🏻‍♂️",
-                                               "🧔🏼‍♂️",
-                                               "🧔🏽‍♂️",
-                                               "🧔🏾‍♂️",
-                                               "🧔🏿‍♂️",
-                                               "🧔‍♀️",
-                                               "🧔🏻‍♀️",
-                                               "🧔🏼‍♀️",
-                                               "🧔🏽‍♀️",
-                                               "🧔🏾‍♀️",
-                                               "🧔🏿‍♀️",
-                                               "👨‍🦰",
-                                               "👨🏻‍🦰",
-                                               "👨🏼‍🦰",
-                                               "👨🏽‍🦰",
-                                               "👨🏾‍🦰",
-                                               "👨🏿‍🦰",
-                                               "👨‍🦱",
-                                               "👨🏻‍🦱",
-                                               "👨🏼‍🦱",
-                                               "👨🏽‍🦱",
-                                               "👨🏾‍🦱",
-                                               "👨🏿‍🦱",
-                                               "👨‍🦳",
-                                               "👨🏻‍🦳",
-                                               "👨🏼‍🦳",
-                                               "👨🏽‍🦳",
-                                               "👨🏾‍🦳",
-                                               "👨🏿‍🦳",
-                                               "👨‍🦲",
-                                               "👨🏻‍🦲",
-                                               "👨🏼‍🦲",
-                                               "👨🏽‍🦲",
-                                               "👨🏾‍🦲",
-                                               "👨🏿‍🦲",
-                                               "👩",
-                                               "👩🏻",
-                                               "👩🏼",
-                                               "👩🏽",
-                                               "👩🏾",
-                                               "👩🏿",
-                                               "👩‍🦰",
-                                               "👩🏻‍🦰",
-                                               "👩🏼‍🦰",
-                                               "👩🏽‍🦰",
-                                               "👩🏾‍🦰",
-                                               "👩🏿‍🦰",
-                                               "🧑‍🦰",
-                                               "🧑🏻‍🦰",
-                                               "🧑🏼‍🦰",
-                                               "🧑🏽‍🦰",
-                                               "🧑🏾‍🦰",
-                                               "🧑🏿‍🦰",
-                                               "👩‍🦱",
-                                               "👩🏻‍🦱",
-                                               "👩🏼‍🦱",
-                                               "👩🏽‍🦱",
-                                               "👩🏾‍🦱",
-                                               "👩🏿‍🦱",
-                                               "🧑‍🦱",
-                                               "🧑🏻‍🦱",
-                                               "🧑🏼‍🦱",
-                                               "🧑🏽‍🦱",
-                                               "🧑🏾‍🦱",
-                                               "🧑🏿‍🦱",
-                                               "👩‍🦳",
-                                               "👩🏻‍🦳",
-                                               "👩🏼‍🦳",
-                                               "👩🏽‍🦳",
-                                               "👩🏾‍🦳",
-                                               "👩🏿‍🦳",
-                                               "🧑‍🦳",
-                                               "🧑🏻‍🦳",
-                                               "🧑🏼‍🦳",
-                                               "🧑🏽‍🦳",
-                                               "🧑🏾‍🦳",
-                                               "🧑🏿‍🦳",
-                                               "👩‍🦲",
-                                               "👩🏻‍🦲",
-                                               "👩🏼‍🦲",
-                                               "👩🏽‍🦲",
-                                               "👩🏾‍🦲",
-                                               "👩🏿‍🦲",
-                                               "🧑‍🦲",
-                                               "🧑🏻‍🦲",
-                                               "🧑🏼‍🦲",
-                                               "🧑🏽‍🦲",
-                                               "🧑🏾‍🦲",
-                                               "🧑🏿‍🦲",
-                                               "👱‍♀️",
-                                               "👱🏻‍♀️",
-                                               "👱🏼‍♀️",
-                                               "👱🏽‍♀️",
-                                               "👱🏾‍♀️",
-                                               "👱🏿‍♀️",
-                                               "👱‍♂️",
-                                               "👱🏻‍♂️",
-                                               "👱🏼‍♂️",
-                                               "👱🏽‍♂️",
-                                               "👱🏾‍♂️",
-                                               "👱🏿‍♂️",
-                                               "🧓",
-                                               "🧓🏻",
-                                               "🧓🏼",
-                                               "🧓🏽",
-                                               "🧓🏾",
-                                               "🧓🏿",
-                                               "👴",
-                                               "👴🏻",
-                                               "👴🏼",
-                                               "👴🏽",
-                                               "👴🏾",
-                                               "👴🏿",
-                                               "👵",
-                                               "👵🏻",
-                                               "👵🏼",
-                                               "👵🏽",
-                                               "👵🏾",
-                                               "👵🏿",
-                                               "🙍",
-                                               "🙍🏻",
-                                               "🙍🏼",
-                                               "🙍🏽",
-                                               "🙍🏾",
-                                               "🙍🏿",
-                                               "🙍‍♂️",
-                                               "🙍🏻‍♂️",
-                                               "🙍🏼‍♂️",
-                                               "🙍🏽‍♂️",
-                                               "🙍🏾‍♂️",
-                                               "🙍🏿‍♂️",
-                                               "🙍‍♀️",
-                                               "🙍🏻‍♀️",
-                                               "🙍🏼‍♀️",
-                                               "🙍🏽‍♀️",
-                                               "🙍🏾‍♀️",
-                                               "🙍🏿‍♀️",
-                                               "🙎",
-                                               "🙎🏻",
-                                               "🙎🏼",
-                                               "🙎🏽",
-                                               "🙎🏾",
-                                               "🙎🏿",
-                                               "🙎‍♂️",
-                                               "🙎🏻‍♂️",
-                                               "🙎🏼‍♂️",
-                                               "🙎🏽‍♂️",
-                                               "🙎🏾‍♂️",
-                                               "🙎🏿‍♂️",
-                                               "🙎‍♀️",
-                                               "🙎🏻‍♀️",
-                                               "🙎🏼‍♀️",
-                                               "🙎🏽‍♀️",
-                                               "🙎🏾‍♀️",
-                                               "🙎🏿‍♀️",
-                                               "🙅",
-                                               "🙅🏻",
-                                               "🙅🏼",
-                                               "🙅🏽",
-                                               "🙅🏾",
-                                               "🙅🏿",
-                                               "🙅‍♂️",
-                                               "🙅🏻‍♂️",
-                                               "🙅🏼‍♂️",
-                                               "🙅🏽‍♂️",
-                                               "🙅🏾‍♂️",
-                                               "🙅🏿‍♂️",
-                                               "🙅‍♀️",
-                                               "🙅🏻‍♀️",
-                                               "🙅🏼‍♀️",
-                                               "🙅🏽‍♀️",
-                                               "🙅🏾‍♀️",
-                                               "🙅🏿‍♀️",
-                                               "🙆",
-                                               "🙆🏻",
-                                               "🙆🏼",
-                                               "🙆🏽",
-                                               "🙆🏾",
-                                               "🙆🏿",
-                                               "🙆‍♂️",
-                                               "🙆🏻‍♂️",
-                                               "🙆🏼‍♂️",
-                                               "🙆🏽‍♂️",
-                                               "🙆🏾‍♂️",
-                                               "🙆🏿‍♂️",
-                                               "🙆‍♀️",
-                                               "🙆🏻‍♀️",
-                                               "🙆🏼‍♀️",
-                                               "🙆🏽‍♀️",
-                                               "🙆🏾‍♀️",
-                                               "🙆🏿‍♀️",
-                                               "💁",
-                                               "💁🏻",
-                                               "💁🏼",
-                                               "💁🏽",
-                                               "💁🏾",
-                                               "💁🏿",
-                                               "💁‍♂️",
-                                               "💁🏻‍♂️",
-                                               "💁🏼‍♂️",
-                                               "💁🏽‍♂️",
-                                               "💁🏾‍♂️",
-                                               "💁🏿‍♂️",
-                                               "💁‍♀️",
-                                               "💁🏻‍♀️",
-                                               "💁🏼‍♀️",
-                                               "💁🏽‍♀️",
-                                               "💁🏾‍♀️",
-                                               "💁🏿‍♀️",
-                                               "🙋",
-                                               "🙋🏻",
-                                               "🙋🏼",
-                                               "🙋🏽",
-                                               "🙋🏾",
-                                               "🙋🏿",
-                                               "🙋‍♂️",
-                                               "🙋🏻‍♂️",
-                                               "🙋🏼‍♂️",
-                                               "🙋🏽‍♂️",
-                                               "🙋🏾‍♂️",
-                                               "🙋🏿‍♂️",
-                                               "🙋‍♀️",
-                                               "🙋🏻‍♀️",
-                                               "🙋🏼‍♀️",
-                                               "🙋🏽‍♀️",
-                                               "🙋🏾‍♀️",
-                                               "🙋🏿‍♀️",
-                                               "🧏",
-                                               "🧏🏻",
-                                               "🧏🏼",
-                                               "🧏🏽",
-                                               "🧏🏾",
-                                               "🧏🏿",
-                                               "🧏‍♂️",
-                                               "🧏🏻‍♂️",
-                                               "🧏🏼‍♂️",
-                                               "🧏🏽‍♂️",
-                                               "🧏🏾‍♂️",
-                                               "🧏🏿‍♂️",
-                                               "🧏‍♀️",
-                                               "🧏🏻‍♀️",
-                                               "🧏🏼‍♀️",
-                                               "🧏🏽‍♀️",
-                                               "🧏🏾‍♀️",
-                                               "🧏🏿‍♀️",
-                                               "🙇",
-                                               "🙇🏻",
-                                               "🙇🏼",
-                                               "🙇🏽",
-                                               "🙇🏾",
-                                               "🙇🏿",
-                                               "🙇‍♂️",
-                                               "🙇🏻‍♂️",
-                                               "🙇🏼‍♂️",
-                                               "🙇🏽‍♂️",
-                                               "🙇🏾‍♂️",
-                                               "🙇🏿‍♂️",
-                                               "🙇‍♀️",
-                                               "🙇🏻‍♀️",
-                                               "🙇🏼‍♀️",
-                                               "🙇🏽‍♀️",
-                                               "🙇🏾‍♀️",
-                                               "🙇🏿‍♀️",
-                                               "🤦",
-                                               "🤦🏻",
-                                               "🤦🏼",
-                                               "🤦🏽",
-                                               "🤦🏾",
-                                               "🤦🏿",
-                                               "🤦‍♂️",
-                                               "🤦🏻‍♂️",
-                                               "🤦🏼‍♂️",
-                                               "🤦🏽‍♂️",
-                                               "🤦🏾‍♂️",
-                                               "🤦🏿‍♂️",
-                                               "🤦‍♀️",
-                                               "🤦🏻‍♀️",
-                                               "🤦🏼‍♀️",
-                                               "🤦🏽‍♀️",
-                                               "🤦🏾‍♀️",
-                                               "🤦🏿‍♀️",
-                                               "🤷",
-                                               "🤷🏻",
-                                               "🤷🏼",
-                                               "🤷🏽",
-                                               "🤷🏾",
-                                               "🤷🏿",
-                                               "🤷‍♂️",
-                                               "🤷🏻‍♂️",
-                                               "🤷🏼‍♂️",
-                                               "🤷🏽‍♂️",
-                                               "🤷🏾‍♂️",
-                                               "🤷🏿‍♂️",
-                                               "🤷‍♀️",
-                                               "🤷🏻‍♀️",
-                                               "🤷🏼‍♀️",
-                                               "🤷🏽‍♀️",
-                                               "🤷🏾‍♀️",
-                                               "🤷🏿‍♀️",
-                                               "🧑‍⚕️",
-                                               "🧑🏻‍⚕️",
-                                               "🧑🏼‍⚕️",
-                                               "🧑🏽‍⚕️",
-                                               "🧑🏾‍⚕️",
-                                               "🧑🏿‍⚕️",
-                                               "👨‍⚕️",
-                                               "👨🏻‍⚕️",
-                                               "👨🏼‍⚕️",
-                                               "👨🏽‍⚕️",
-                                               "👨🏾‍⚕️",
-                                               "👨🏿‍⚕️",
-                                               "👩‍⚕️",
-                                               "👩🏻‍⚕️",
-                                               "👩🏼‍⚕️",
-                                               "👩🏽‍⚕️",
-                                               "👩🏾‍⚕️",
-                                               "👩🏿‍⚕️",
-                                               "🧑‍🎓",
-                                               "🧑🏻‍🎓",
-                                               "🧑🏼‍🎓",
-                                               "🧑🏽‍🎓",
-                                               "🧑🏾‍🎓",
-                                               "🧑🏿‍🎓",
-                                               "👨‍🎓",
-                                               "👨🏻‍🎓",
-                                               "👨🏼‍🎓",
-                                               "👨🏽‍🎓",
-                                               "👨🏾‍🎓",
-                                               "👨🏿‍🎓",
-                                               "👩‍🎓",
-                                               "👩🏻‍🎓",
-                                               "👩🏼‍🎓",
-                                               "👩🏽‍🎓",
-                                               "👩🏾‍🎓",
-                                               "👩🏿‍🎓",
-                                               "🧑‍🏫",
-                                               "🧑🏻‍🏫",
-                                               "🧑🏼‍🏫",
-                                               "🧑🏽‍🏫",
-                                               "🧑🏾‍🏫",
-                                               "🧑🏿‍🏫",
-                                               "👨‍🏫",
-                                               "👨🏻‍🏫",
-                                               "👨🏼‍🏫",
-                                               "👨🏽‍🏫",
-                                               "👨🏾‍🏫",
-                                               "👨🏿‍🏫",
-                                               "👩‍🏫",
-                                               "👩🏻‍🏫",
-                                               "👩🏼‍🏫",
-                                               "👩🏽‍🏫",
-                                               "👩🏾‍🏫",
-                                               "👩🏿‍🏫",
-                                               "🧑‍⚖️",
-                                               "🧑🏻‍⚖️",
-                                               "🧑🏼‍⚖️",
-                                               "🧑🏽‍⚖️",
-                                               "🧑🏾‍⚖️",
-                                               "🧑🏿‍⚖️",
-                                               "👨‍⚖️",
-                                               "👨🏻‍⚖️",
-                                               "👨🏼‍⚖️",
-                                               "👨🏽‍⚖️",
-                                               "👨🏾‍⚖️",
-                                               "👨🏿‍⚖️",
-                                               "👩‍⚖️",
-                                               "👩🏻‍⚖️",
-                                               "👩🏼‍⚖️",
-                                               "👩🏽‍⚖️",
-                                               "👩🏾‍⚖️",
-                                               "👩🏿‍⚖️",
-                                               "🧑‍🌾",
-                                               "🧑🏻‍🌾",
-                                               "🧑🏼‍🌾",
-                                               "🧑🏽‍🌾",
-                                               "🧑🏾‍🌾",
-                                               "🧑🏿‍🌾",
-                                               "👨‍🌾",
-                                               "👨🏻‍🌾",
-                                               "👨🏼‍🌾",
-                                               "👨🏽‍🌾",
-                                               "👨🏾‍🌾",
-                                               "👨🏿‍🌾",
-                                               "👩‍🌾",
-                                               "👩🏻‍🌾",
-                                               "👩🏼‍🌾",
-                                               "👩🏽‍🌾",
-                                               "👩🏾‍🌾",
-                                               "👩🏿‍🌾",
-                                               "🧑‍🍳",
-                                               "🧑🏻‍🍳",
-                                               "🧑🏼‍🍳",
-                                               "🧑🏽‍🍳",
-                                               "🧑🏾‍🍳",
-                                               "🧑🏿‍🍳",
-                                               "👨‍🍳",
-                                               "👨🏻‍🍳",
-                                               "👨🏼‍🍳",
-                                               "👨🏽‍🍳",
-                                               "👨🏾‍🍳",
-                                               "👨🏿‍🍳",
-                                               "👩‍🍳",
-                                               "👩🏻‍🍳",
-                                               "👩🏼‍🍳",
-                                               "👩🏽‍🍳",
-                                               "👩🏾‍🍳",
-                                               "👩🏿‍🍳",
-                                               "🧑‍🔧",
-                                               "🧑🏻‍🔧",
-                                               "🧑🏼‍🔧",
-                                               "🧑🏽‍🔧",
-                                               "🧑🏾‍🔧",
-                                               "🧑🏿‍🔧",
-                                               "👨‍🔧",
-                                               "👨🏻‍🔧",
-                                               "👨🏼‍🔧",
-                                               "👨🏽‍🔧",
-                                               "👨🏾‍🔧",
-                                               "👨🏿‍🔧",
-                                               "👩‍🔧",
-                                               "👩🏻‍🔧",
-                                               "👩🏼‍🔧",
-                                               "👩🏽‍🔧",
-                                               "👩🏾‍🔧",
-                                               "👩🏿‍🔧",
-                                               "🧑‍🏭",
-                                               "🧑🏻‍🏭",
-                                               "🧑🏼‍🏭",
-                                               "🧑🏽‍🏭",
-                                               "🧑🏾‍🏭",
-                                               "🧑🏿‍🏭",
-                                               "👨‍🏭",
-                                               "👨🏻‍🏭",
-                                               "👨🏼‍🏭",
-                                               "👨🏽‍🏭",
-                                               "👨🏾‍🏭",
-                                               "👨🏿‍🏭",
-                                               "👩‍🏭",
-                                               "👩🏻‍🏭",
-                                               "👩🏼‍🏭",
-                                               "👩🏽‍🏭",
-                                               "👩🏾‍🏭",
-                                               "👩🏿‍🏭",
-                                               "🧑‍💼",
-                                               "🧑🏻‍💼",
-                                               "🧑🏼‍💼",
-                                               "🧑🏽‍💼",
-                                               "🧑🏾‍💼",
-                                               "🧑🏿‍💼",
-                                               "👨‍💼",
-                                               "👨🏻‍💼",
-                                               "👨🏼‍💼",
-                                               "👨🏽‍💼",
-                                               "👨🏾‍💼",
-                                               "👨🏿‍💼",
-                                               "👩‍💼",
-                                               "👩🏻‍💼",
-                                               "👩🏼‍💼",
-                                               "👩🏽‍💼",
-                                               "👩🏾‍💼",
-                                               "👩🏿‍💼",
-                                               "🧑‍🔬",
-                                               "🧑🏻‍🔬",
-                                               "🧑🏼‍🔬",
-                                               "🧑🏽‍🔬",
-                                               "🧑🏾‍🔬",
-                                               "🧑🏿‍🔬",
-                                               "👨‍🔬",
-                                               "👨🏻‍🔬",
-                                               "👨🏼‍🔬",
-                                               "👨🏽‍🔬",
-                                               "👨🏾‍🔬",
-                                               "👨🏿‍🔬",
-                                               "👩‍🔬",
-                                               "👩🏻‍🔬",
-                                               "👩🏼‍🔬",
-                                               "👩🏽‍🔬",
-                                               "👩🏾‍🔬",
-                                               "👩🏿‍🔬",
-                                               "🧑‍💻",
-                                               "🧑🏻‍💻",
-                                               "🧑🏼‍💻",
-                                               "🧑🏽‍💻",
-                                               "🧑🏾‍💻",
-                                               "🧑🏿‍💻",
-                                               "👨‍💻",
-                                               "👨🏻‍💻",
-                                               "👨🏼‍💻",
-                                               "👨🏽‍💻",
-                                               "👨🏾‍💻",
-                                               "👨🏿‍💻",
-                                               "👩‍💻",
-                                               "👩🏻‍💻",
-                                               "👩🏼‍💻",
-                                               "👩🏽‍💻",
-                                               "👩🏾‍💻",
-                                               "👩🏿‍💻",
-                                               "🧑‍🎤",
-                                               "🧑🏻‍🎤",
-                                               "🧑🏼‍🎤",
-                                               "🧑🏽‍🎤",
-                                               "🧑🏾‍🎤",
-                                               "🧑🏿‍🎤",
-                                               "👨‍🎤",
-                                               "👨🏻‍🎤",
-                                               "👨🏼‍🎤",
-                                               "👨🏽‍🎤",
-                                               "👨🏾‍🎤",
-                                               "👨🏿‍🎤",
-                                               "👩‍🎤",
-                                               "👩🏻‍🎤",
-                                               "👩🏼‍🎤",
-                                               "👩🏽‍🎤",
-                                               "👩🏾‍🎤",
-                                               "👩🏿‍🎤",
-                                               "🧑‍🎨",
-                                               "🧑🏻‍🎨",
-                                               "🧑🏼‍🎨",
-                                               "🧑🏽‍🎨",
-                                               "🧑🏾‍🎨",
-                                               "🧑🏿‍🎨",
-                                               "👨‍🎨",
-                                               "👨🏻‍🎨",
-                                               "👨🏼‍🎨",
-                                               "👨🏽‍🎨",
-                                               "👨🏾‍🎨",
-                                               "👨🏿‍🎨",
-                                               "👩‍🎨",
-                                               "👩🏻‍🎨",
-                                               "👩🏼‍🎨",
-                                               "👩🏽‍🎨",
-                                               "👩🏾‍🎨",
-                                               "👩🏿‍🎨",
-                                               "🧑‍✈️",
-                                               "🧑🏻‍✈️",
-                                               "🧑🏼‍✈️",
-                                               "🧑🏽‍✈️",
-                                               "🧑🏾‍✈️",
-                                               "🧑🏿‍✈️",
-                                               "👨‍✈️",
-                                               "👨🏻‍✈️",
-                                               "👨🏼‍✈️",
-                                               "👨🏽‍✈️",
-                                               "👨🏾‍✈️",
-                                               "👨🏿‍✈️",
-                                               "👩‍✈️",
-                                               "👩🏻‍✈️",
-                                               "👩🏼‍✈️",
-                                               "👩🏽‍✈️",
-                                               "👩🏾‍✈️",
-                                               "👩🏿‍✈️",
-                                               "🧑‍🚀",
-                                               "🧑🏻‍🚀",
-                                               "🧑🏼‍🚀",
-                                               "🧑🏽‍🚀",
-                                               "🧑🏾‍🚀",
-                                               "🧑🏿‍🚀",
-                                               "👨‍🚀",
-                                               "👨🏻‍🚀",
-                                               "👨🏼‍🚀",
-                                               "👨🏽‍🚀",
-                                               "👨🏾‍🚀",
-                                               "👨🏿‍🚀",
-                                               "👩‍🚀",
-                                               "👩🏻‍🚀",
-                                               "👩🏼‍🚀",
-                                               "👩🏽‍🚀",
-                                               "👩🏾‍🚀",
-                                               "👩🏿‍🚀",
-                                               "🧑‍🚒",
-                                               "🧑🏻‍🚒",
-                                               "🧑🏼‍🚒",
-                                               "🧑🏽‍🚒",
-                                               "🧑🏾‍🚒",
-                                               "🧑🏿‍🚒",
-                                               "👨‍🚒",
-                                               "👨🏻‍🚒",
-                                               "👨🏼‍🚒",
-                                               "👨🏽‍🚒",
-                                               "👨🏾‍🚒",
-                                               "👨🏿‍🚒",
-                                               "👩‍🚒",
-                                               "👩🏻‍🚒",
-                                               "👩🏼‍🚒",
-                                               "👩🏽‍🚒",
-                                               "👩🏾‍🚒",
-                                               "👩🏿‍🚒",
-                                               "👮",
-                                               "👮🏻",
-                                               "👮🏼",
-                                               "👮🏽",
-                                               "👮🏾",
-                                               "👮🏿",
-                                               "👮‍♂️",
-                                               "👮🏻‍♂️",
-                                               "👮🏼‍♂️",
-                                               "👮🏽‍♂️",
-                                               "👮🏾‍♂️",
-                                               "👮🏿‍♂️",
-                                               "👮‍♀️",
-                                               "👮🏻‍♀️",
-                                               "👮🏼‍♀️",
-                                               "👮🏽‍♀️",
-                                               "👮🏾‍♀️",
-                                               "👮🏿‍♀️",
-                                               "🕵️",
-                                               "🕵🏻",
-                                               "🕵🏼",
-                                               "🕵🏽",
-                                               "🕵🏾",
-                                               "🕵🏿",
-                                               "🕵️‍♂️",
-                                               "🕵🏻‍♂️",
-                                               "🕵🏼‍♂️",
-                                               "🕵🏽‍♂️",
-                                               "🕵🏾‍♂️",
-                                               "🕵🏿‍♂️",
-                                               "🕵️‍♀️",
-                                               "🕵🏻‍♀️",
-                                               "🕵🏼‍♀️",
-                                               "🕵🏽‍♀️",
-                                               "🕵🏾‍♀️",
-                                               "🕵🏿‍♀️",
-                                               "💂",
-                                               "💂🏻",
-                                               "💂🏼",
-                                               "💂🏽",
-                                               "💂🏾",
-                                               "💂🏿",
-                                               "💂‍♂️",
-                                               "💂🏻‍♂️",
-                                               "💂🏼‍♂️",
-                                               "💂🏽‍♂️",
-                                               "💂🏾‍♂️",
-                                               "💂🏿‍♂️",
-                                               "💂‍♀️",
-                                               "💂🏻‍♀️",
-                                               "💂🏼‍♀️",
-                                               "💂🏽‍♀️",
-                                               "💂🏾‍♀️",
-                                               "💂🏿‍♀️",
-                                               "🥷",
-                                               "🥷🏻",
-                                               "🥷🏼",
-                                               "🥷🏽",
-                                               "🥷🏾",
-                                               "🥷🏿",
-                                               "👷",
-                                               "👷🏻",
-                                               "👷🏼",
-                                               "👷🏽",
-                                               "👷🏾",
-                                               "👷🏿",
-                                               "👷‍♂️",
-                                               "👷🏻‍♂️",
-                                               "👷🏼‍♂️",
-                                               "👷🏽‍♂️",
-                                               "👷🏾‍♂️",
-                                               "👷🏿‍♂️",
-                                               "👷‍♀️",
-                                               "👷🏻‍♀️",
-                                               "👷🏼‍♀️",
-                                               "👷🏽‍♀️",
-                                               "👷🏾‍♀️",
-                                               "👷🏿‍♀️",
-                                               "🤴",
-                                               "🤴🏻",
-                                               "🤴🏼",
-                                               "🤴🏽",
-                                               "🤴🏾",
-                                               "🤴🏿",
-                                               "👸",
-                                               "👸🏻",
-                                               "👸🏼",
-                                               "👸🏽",
-                                               "👸🏾",
-                                               "👸🏿",
-                                               "👳",
-                                               "👳🏻",
-                                               "👳🏼",
-                                               "👳🏽",
-                                               "👳🏾",
-                                               "👳🏿",
-                                               "👳‍♂️",
-                                               "👳🏻‍♂️",
-                                               "👳🏼‍♂️",
-                                               "👳🏽‍♂️",
-                                               "👳🏾‍♂️",
-                                               "👳🏿‍♂️",
-                                               "👳‍♀️",
-                                               "👳🏻‍♀️",
-                                               "👳🏼‍♀️",
-                                               "👳🏽‍♀️",
-                                               "👳🏾‍♀️",
-                                               "👳🏿‍♀️",
-                                               "👲",
-                                               "👲🏻",
-                                               "👲🏼",
-                                               "👲🏽",
-                                               "👲🏾",
-                                               "👲🏿",
-                                               "🧕",
-                                               "🧕🏻",
-                                               "🧕🏼",
-                                               "🧕🏽",
-                                               "🧕🏾",
-                                               "🧕🏿",
-                                               "🤵",
-                                               "🤵🏻",
-                                               "🤵🏼",
-                                               "🤵🏽",
-                                               "🤵🏾",
-                                               "🤵🏿",
-                                               "🤵‍♂️",
-                                               "🤵🏻‍♂️",
-                                               "🤵🏼‍♂️",
-                                               "🤵🏽‍♂️",
-                                               "🤵🏾‍♂️",
-                                               "🤵🏿‍♂️",
-                                               "🤵‍♀️",
-                                               "🤵🏻‍♀️",
-                                               "🤵🏼‍♀️",
-                                               "🤵🏽‍♀️",
-                                               "🤵🏾‍♀️",
-                                               "🤵🏿‍♀️",
-                                               "👰",
-                                               "👰🏻",
-                                               "👰🏼",
-                                               "👰🏽",
-                                               "👰🏾",
-                                               "👰🏿",
-                                               "👰‍♂️",
-                                               "👰🏻‍♂️",
-                                               "👰🏼‍♂️",
-                                               "👰🏽‍♂️",
-                                               "👰🏾‍♂️",
-                                               "👰🏿‍♂️",
-                                               "👰‍♀️",
-                                               "👰🏻‍♀️",
-                                               "👰🏼‍♀️",
-                                               "👰🏽‍♀️",
-                                               "👰🏾‍♀️",
-                                               "👰🏿‍♀️",
-                                               "🤰",
-                                               "🤰🏻",
-                                               "🤰🏼",
-                                               "🤰🏽",
-                                               "🤰🏾",
-                                               "🤰🏿",
-                                               "🤱",
-                                               "🤱🏻",
-                                               "🤱🏼",
-                                               "🤱🏽",
-                                               "🤱🏾",
-                                               "🤱🏿",
-                                               "👩‍🍼",
-                                               "👩🏻‍🍼",
-                                               "👩🏼‍🍼",
-                                               "👩🏽‍🍼",
-                                               "👩🏾‍🍼",
-                                               "👩🏿‍🍼",
-                                               "👨‍🍼",
-                                               "👨🏻‍🍼",
-                                               "👨🏼‍🍼",
-                                               "👨🏽‍🍼",
-                                               "👨🏾‍🍼",
-                                               "👨🏿‍🍼",
-                                               "🧑‍🍼",
-                                               "🧑🏻‍🍼",
-                                               "🧑🏼‍🍼",
-                                               "🧑🏽‍🍼",
-                                               "🧑🏾‍🍼",
-                                               "🧑🏿‍🍼",
-                                               "👼",
-                                               "👼🏻",
-                                               "👼🏼",
-                                               "👼🏽",
-                                               "👼🏾",
-                                               "👼🏿",
-                                               "🎅",
-                                               "🎅🏻",
-                                               "🎅🏼",
-                                               "🎅🏽",
-                                               "🎅🏾",
-                                               "🎅🏿",
-                                               "🤶",
-                                               "🤶🏻",
-                                               "🤶🏼",
-                                               "🤶🏽",
-                                               "🤶🏾",
-                                               "🤶🏿",
-                                               "🧑‍🎄",
-                                               "🧑🏻‍🎄",
-                                               "🧑🏼‍🎄",
-                                               "🧑🏽‍🎄",
-                                               "🧑🏾‍🎄",
-                                               "🧑🏿‍🎄",
-                                               "🦸",
-                                               "🦸🏻",
-                                               "🦸🏼",
-                                               "🦸🏽",
-                                               "🦸🏾",
-                                               "🦸🏿",
-                                               "🦸‍♂️",
-                                               "🦸🏻‍♂️",
-                                               "🦸🏼‍♂️",
-                                               "🦸🏽‍♂️",
-                                               "🦸🏾‍♂️",
-                                               "🦸🏿‍♂️",
-                                               "🦸‍♀️",
-                                               "🦸🏻‍♀️",
-                                               "🦸🏼‍♀️",
-                                               "🦸🏽‍♀️",
-                                               "🦸🏾‍♀️",
-                                               "🦸🏿‍♀️",
-                                               "🦹",
-                                               "🦹🏻",
-                                               "🦹🏼",
-                                               "🦹🏽",
-                                               "🦹🏾",
-                                               "🦹🏿",
-                                               "🦹‍♂️",
-                                               "🦹🏻‍♂️",
-                                               "🦹🏼‍♂️",
-                                               "🦹🏽‍♂️",
-                                               "🦹🏾‍♂️",
-                                               "🦹🏿‍♂️",
-                                               "🦹‍♀️",
-                                               "🦹🏻‍♀️",
-                                               "🦹🏼‍♀️",
-                                               "🦹🏽‍♀️",
-                                               "🦹🏾‍♀️",
-                                               "🦹🏿‍♀️",
-                                               "🧙",
-                                               "🧙🏻",
-                                               "🧙🏼",
-                                               "🧙🏽",
-                                               "🧙🏾",
-                                               "🧙🏿",
-                                               "🧙‍♂️",
-                                               "🧙🏻‍♂️",
-                                               "🧙🏼‍♂️",
-                                               "🧙🏽‍♂️",
-                                               "🧙🏾‍♂️",
-                                               "🧙🏿‍♂️",
-                                               "🧙‍♀️",
-                                               "🧙🏻‍♀️",
-                                               "🧙🏼‍♀️",
-                                               "🧙🏽‍♀️",
-                                               "🧙🏾‍♀️",
-                                               "🧙🏿‍♀️",
-                                               "🧚",
-                                               "🧚🏻",
-                                               "🧚🏼",
-                                               "🧚🏽",
-                                               "🧚🏾",
-                                               "🧚🏿",
-                                               "🧚‍♂️",
-                                               "🧚🏻‍♂️",
-                                               "🧚🏼‍♂️",
-                                               "🧚🏽‍♂️",
-                                               "🧚🏾‍♂️",
-                                               "🧚🏿‍♂️",
-                                               "🧚‍♀️",
-                                               "🧚🏻‍♀️",
-                                               "🧚🏼‍♀️",
-                                               "🧚🏽‍♀️",
-                                               "🧚🏾‍♀️",
-                                               "🧚🏿‍♀️",
-                                               "🧛",
-                                               "🧛🏻",
-                                               "🧛🏼",
-                                               "🧛🏽",
-                                               "🧛🏾",
-                                               "🧛🏿",
-                                               "🧛‍♂️",
-                                               "🧛🏻‍♂️",
-                                               "🧛🏼‍♂️",
-                                               "🧛🏽‍♂️",
-                                               "🧛🏾‍♂️",
-                                               "🧛🏿‍♂️",
-                                               "🧛‍♀️",
-                                               "🧛🏻‍♀️",
-                                               "🧛🏼‍♀️",
-                                               "🧛🏽‍♀️",
-                                               "🧛🏾‍♀️",
-                                               "🧛🏿‍♀️",
-                                               "🧜",
-                                               "🧜🏻",
-                                               "🧜🏼",
-                                               "🧜🏽",
-                                               "🧜🏾",
-                                               "🧜🏿",
-                                               "🧜‍♂️",
-                                               "🧜🏻‍♂️",
-                                               "🧜🏼‍♂️",
-                                               "🧜🏽‍♂️",
-                                               "🧜🏾‍♂️",
-                                               "🧜🏿‍♂️",
-                                               "🧜‍♀️",
-                                               "🧜🏻‍♀️",
-                                               "🧜🏼‍♀️",
-                                               "🧜🏽‍♀️",
-                                               "🧜🏾‍♀️",
-                                               "🧜🏿‍♀️",
-                                               "🧝",
-                                               "🧝🏻",
-                                               "🧝🏼",
-                                               "🧝🏽",
-                                               "🧝🏾",
-                                               "🧝🏿",
-                                               "🧝‍♂️",
-                                               "🧝🏻‍♂️",
-                                               "🧝🏼‍♂️",
-                                               "🧝🏽‍♂️",
-                                               "🧝🏾‍♂️",
-                                               "🧝🏿‍♂️",
-                                               "🧝‍♀️",
-                                               "🧝🏻‍♀️",
-                                               "🧝🏼‍♀️",
-                                               "🧝🏽‍♀️",
-                                               "🧝🏾‍♀️",
-                                               "🧝🏿‍♀️",
-                                               "🧞",
-                                               "🧞‍♂️",
-                                               "🧞‍♀️",
-                                               "🧟",
-                                               "🧟‍♂️",
-                                               "🧟‍♀️",
-                                               "💆",
-                                               "💆🏻",
-                                               "💆🏼",
-                                               "💆🏽",
-                                               "💆🏾",
-                                               "💆🏿",
-                                               "💆‍♂️",
-                                               "💆🏻‍♂️",
-                                               "💆🏼‍♂️",
-                                               "💆🏽‍♂️",
-                                               "💆🏾‍♂️",
-                                               "💆🏿‍♂️",
-                                               "💆‍♀️",
-                                               "💆🏻‍♀️",
-                                               "💆🏼‍♀️",
-                                               "💆🏽‍♀️",
-                                               "💆🏾‍♀️",
-                                               "💆🏿‍♀️",
-                                               "💇",
-                                               "💇🏻",
-                                               "💇🏼",
-                                               "💇🏽",
-                                               "💇🏾",
-                                               "💇🏿",
-                                               "💇‍♂️",
-                                               "💇🏻‍♂️",
-                                               "💇🏼‍♂️",
-                                               "💇🏽‍♂️",
-                                               "💇🏾‍♂️",
-                                               "💇🏿‍♂️",
-                                               "💇‍♀️",
-                                               "💇🏻‍♀️",
-                                               "💇🏼‍♀️",
-                                               "💇🏽‍♀️",
-                                               "💇🏾‍♀️",
-                                               "💇🏿‍♀️",
-                                               "🚶",
-                                               "🚶🏻",
-                                               "🚶🏼",
-                                               "🚶🏽",
-                                               "🚶🏾",
-                                               "🚶🏿",
-                                               "🚶‍♂️",
-                                               "🚶🏻‍♂️",
-                                               "🚶🏼‍♂️",
-                                               "🚶🏽‍♂️",
-                                               "🚶🏾‍♂️",
-                                               "🚶🏿‍♂️",
-                                               "🚶‍♀️",
-                                               "🚶🏻‍♀️",
-                                               "🚶🏼‍♀️",
-                                               "🚶🏽‍♀️",
-                                               "🚶🏾‍♀️",
-                                               "🚶🏿‍♀️",
-                                               "🧍",
-                                               "🧍🏻",
-                                               "🧍🏼",
-                                               "🧍🏽",
-                                               "🧍🏾",
-                                               "🧍🏿",
-                                               "🧍‍♂️",
-                                               "🧍🏻‍♂️",
-                                               "🧍🏼‍♂️",
-                                               "🧍🏽‍♂️",
-                                               "🧍🏾‍♂️",
-                                               "🧍🏿‍♂️",
-                                               "🧍‍♀️",
-                                               "🧍🏻‍♀️",
-                                               "🧍🏼‍♀️",
-                                               "🧍🏽‍♀️",
-                                               "🧍🏾‍♀️",
-                                               "🧍🏿‍♀️",
-                                               "🧎",
-                                               "🧎🏻",
-                                               "🧎🏼",
-                                               "🧎🏽",
-                                               "🧎🏾",
-                                               "🧎🏿",
-                                               "🧎‍♂️",
-                                               "🧎🏻‍♂️",
-                                               "🧎🏼‍♂️",
-                                               "🧎🏽‍♂️",
-                                               "🧎🏾‍♂️",
-                                               "🧎🏿‍♂️",
-                                               "🧎‍♀️",
-                                               "🧎🏻‍♀️",
-                                               "🧎🏼‍♀️",
-                                               "🧎🏽‍♀️",
-                                               "🧎🏾‍♀️",
-                                               "🧎🏿‍♀️",
-                                               "🧑‍🦯",
-                                               "🧑🏻‍🦯",
-                                               "🧑🏼‍🦯",
-                                               "🧑🏽‍🦯",
-                                               "🧑🏾‍🦯",
-                                               "🧑🏿‍🦯",
-                                               "👨‍🦯",
-                                               "👨🏻‍🦯",
-                                               "👨🏼‍🦯",
-                                               "👨🏽‍🦯",
-                                               "👨🏾‍🦯",
-                                               "👨🏿‍🦯",
-                                               "👩‍🦯",
-                                               "👩🏻‍🦯",
-                                               "👩🏼‍🦯",
-                                               "👩🏽‍🦯",
-                                               "👩🏾‍🦯",
-                                               "👩🏿‍🦯",
-                                               "🧑‍🦼",
-                                               "🧑🏻‍🦼",
-                                               "🧑🏼‍🦼",
-                                               "🧑🏽‍🦼",
-                                               "🧑🏾‍🦼",
-                                               "🧑🏿‍🦼",
-                                               "👨‍🦼",
-                                               "👨🏻‍🦼",
-                                               "👨🏼‍🦼",
-                                               "👨🏽‍🦼",
-                                               "👨🏾‍🦼",
-                                               "👨🏿‍🦼",
-                                               "👩‍🦼",
-                                               "👩🏻‍🦼",
-                                               "👩🏼‍🦼",
-                                               "👩🏽‍🦼",
-                                               "👩🏾‍🦼",
-                                               "👩🏿‍🦼",
-                                               "🧑‍🦽",
-                                               "🧑🏻‍🦽",
-                                               "🧑🏼‍🦽",
-                                               "🧑🏽‍🦽",
-                                               "🧑🏾‍🦽",
-                                               "🧑🏿‍🦽",
-                                               "👨‍🦽",
-                                               "👨🏻‍🦽",
-                                               "👨🏼‍🦽",
-                                               "👨🏽‍🦽",
-                                               "👨🏾‍🦽",
-                                               "👨🏿‍🦽",
-                                               "👩‍🦽",
-                                               "👩🏻‍🦽",
-                                               "👩🏼‍🦽",
-                                               "👩🏽‍🦽",
-                                               "👩🏾‍🦽",
-                                               "👩🏿‍🦽",
-                                               "🏃",
-                                               "🏃🏻",
-                                               "🏃🏼",
-                                               "🏃🏽",
-                                               "🏃🏾",
-                                               "🏃🏿",
-                                               "🏃‍♂️",
-                                               "🏃🏻‍♂️",
-                                               "🏃🏼‍♂️",
-                                               "🏃🏽‍♂️",
-                                               "🏃🏾‍♂️",
-                                               "🏃🏿‍♂️",
-                                               "🏃‍♀️",
-                                               "🏃🏻‍♀️",
-                                               "🏃🏼‍♀️",
-                                               "🏃🏽‍♀️",
-                                               "🏃🏾‍♀️",
-                                               "🏃🏿‍♀️",
-                                               "💃",
-                                               "💃🏻",
-                                               "💃🏼",
-                                               "💃🏽",
-                                               "💃🏾",
-                                               "💃🏿",
-                                               "🕺",
-                                               "🕺🏻",
-                                               "🕺🏼",
-                                               "🕺🏽",
-                                               "🕺🏾",
-                                               "🕺🏿",
-                                               "🕴️",
-                                               "🕴🏻",
-                                               "🕴🏼",
-                                               "🕴🏽",
-                                               "🕴🏾",
-                                               "🕴🏿",
-                                               "👯",
-                                               "👯‍♂️",
-                                               "👯‍♀️",
-                                               "🧖",
-                                               "🧖🏻",
-                                               "🧖🏼",
-                                               "🧖🏽",
-                                               "🧖🏾",
-                                               "🧖🏿",
-                                               "🧖‍♂️",
-                                               "🧖🏻‍♂️",
-                                               "🧖🏼‍♂️",
-                                               "🧖🏽‍♂️",
-                                               "🧖🏾‍♂️",
-                                               "🧖🏿‍♂️",
-                                               "🧖‍♀️",
-                                               "🧖🏻‍♀️",
-                                               "🧖🏼‍♀️",
-                                               "🧖🏽‍♀️",
-                                               "🧖🏾‍♀️",
-                                               "🧖🏿‍♀️",
-                                               "🧗",
-                                               "🧗🏻",
-                                               "🧗🏼",
-                                               "🧗🏽",
-                                               "🧗🏾",
-                                               "🧗🏿",
-                                               "🧗‍♂️",
-                                               "🧗🏻‍♂️",
-                                               "🧗🏼‍♂️",
-                                               "🧗🏽‍♂️",
-                                               "🧗🏾‍♂️",
-                                               "🧗🏿‍♂️",
-                                               "🧗‍♀️",
-                                               "🧗🏻‍♀️",
-                                               "🧗🏼‍♀️",
-                                               "🧗🏽‍♀️",
-                                               "🧗🏾‍♀️",
-                                               "🧗🏿‍♀️",
-                                               "🤺",
-                                               "🏇",
-                                               "🏇🏻",
-                                               "🏇🏼",
-                                               "🏇🏽",
-                                               "🏇🏾",
-                                               "🏇🏿",
-                                               "⛷️",
-                                               "🏂",
-                                               "🏂🏻",
-                                               "🏂🏼",
-                                               "🏂🏽",
-                                               "🏂🏾",
-                                               "🏂🏿",
-                                               "🏌️",
-                                               "🏌🏻",
-                                               "🏌🏼",
-                                               "🏌🏽",
-                                               "🏌🏾",
-                                               "🏌🏿",
-                                               "🏌️‍♂️",
-                                               "🏌🏻‍♂️",
-                                               "🏌🏼‍♂️",
-                                               "🏌🏽‍♂️",
-                                               "🏌🏾‍♂️",
-                                               "🏌🏿‍♂️",
-                                               "🏌️‍♀️",
-                                               "🏌🏻‍♀️",
-                                               "🏌🏼‍♀️",
-                                               "🏌🏽‍♀️",
-                                               "🏌🏾‍♀️",
-                                               "🏌🏿‍♀️",
-                                               "🏄",
-                                               "🏄🏻",
-                                               "🏄🏼",
-                                               "🏄🏽",
-                                               "🏄🏾",
-                                               "🏄🏿",
-                                               "🏄‍♂️",
-                                               "🏄🏻‍♂️",
-                                               "🏄🏼‍♂️",
-                                               "🏄🏽‍♂️",
-                                               "🏄🏾‍♂️",
-                                               "🏄🏿‍♂️",
-                                               "🏄‍♀️",
-                                               "🏄🏻‍♀️",
-                                               "🏄🏼‍♀️",
-                                               "🏄🏽‍♀️",
-                                               "🏄🏾‍♀️",
-                                               "🏄🏿‍♀️",
-                                               "🚣",
-                                               "🚣🏻",
-                                               "🚣🏼",
-                                               "🚣🏽",
-                                               "🚣🏾",
-                                               "🚣🏿",
-                                               "🚣‍♂️",
-                                               "🚣🏻‍♂️",
-                                               "🚣🏼‍♂️",
-                                               "🚣🏽‍♂️",
-                                               "🚣🏾‍♂️",
-                                               "🚣🏿‍♂️",
-                                               "🚣‍♀️",
-                                               "🚣🏻‍♀️",
-                                               "🚣🏼‍♀️",
-                                               "🚣🏽‍♀️",
-                                               "🚣🏾‍♀️",
-                                               "🚣🏿‍♀️",
-                                               "🏊",
-                                               "🏊🏻",
-                                               "🏊🏼",
-                                               "🏊🏽",
-                                               "🏊🏾",
-                                               "🏊🏿",
-                                               "🏊‍♂️",
-                                               "🏊🏻‍♂️",
-                                               "🏊🏼‍♂️",
-                                               "🏊🏽‍♂️",
-                                               "🏊🏾‍♂️",
-                                               "🏊🏿‍♂️",
-                                               "🏊‍♀️",
-                                               "🏊🏻‍♀️",
-                                               "🏊🏼‍♀️",
-                                               "🏊🏽‍♀️",
-                                               "🏊🏾‍♀️",
-                                               "🏊🏿‍♀️",
-                                               "⛹️",
-                                               "⛹🏻",
-                                               "⛹🏼",
-                                               "⛹🏽",
-                                               "⛹🏾",
-                                               "⛹🏿",
-                                               "⛹️‍♂️",
-                                               "⛹🏻‍♂️",
-                                               "⛹🏼‍♂️",
-                                               "⛹🏽‍♂️",
-                                               "⛹🏾‍♂️",
-                                               "⛹🏿‍♂️",
-                                               "⛹️‍♀️",
-                                               "⛹🏻‍♀️",
-                                               "⛹🏼‍♀️",
-                                               "⛹🏽‍♀️",
-                                               "⛹🏾‍♀️",
-                                               "⛹🏿‍♀️",
-                                               "🏋️",
-                                               "🏋🏻",
-                                               "🏋🏼",
-                                               "🏋🏽",
-                                               "🏋🏾",
-                                               "🏋🏿",
-                                               "🏋️‍♂️",
-                                               "🏋🏻‍♂️",
-                                               "🏋🏼‍♂️",
-                                               "🏋🏽‍♂️",
-                                               "🏋🏾‍♂️",
-                                               "🏋🏿‍♂️",
-                                               "🏋️‍♀️",
-                                               "🏋🏻‍♀️",
-                                               "🏋🏼‍♀️",
-                                               "🏋🏽‍♀️",
-                                               "🏋🏾‍♀️",
-                                               "🏋🏿‍♀️",
-                                               "🚴",
-                                               "🚴🏻",
-                                               "🚴🏼",
-                                               "🚴🏽",
-                                               "🚴🏾",
-                                               "🚴🏿",
-                                               "🚴‍♂️",
-                                               "🚴🏻‍♂️",
-                                               "🚴🏼‍♂️",
-                                               "🚴🏽‍♂️",
-                                               "🚴🏾‍♂️",
-                                               "🚴🏿‍♂️",
-                                               "🚴‍♀️",
-                                               "🚴🏻‍♀️",
-                                               "🚴🏼‍♀️",
-                                               "🚴🏽‍♀️",
-                                               "🚴🏾‍♀️",
-                                               "🚴🏿‍♀️",
-                                               "🚵",
-                                               "🚵🏻",
-                                               "🚵🏼",
-                                               "🚵🏽",
-                                               "🚵🏾",
-                                               "🚵🏿",
-                                               "🚵‍♂️",
-                                               "🚵🏻‍♂️",
-                                               "🚵🏼‍♂️",
-                                               "🚵🏽‍♂️",
-                                               "🚵🏾‍♂️",
-                                               "🚵🏿‍♂️",
-                                               "🚵‍♀️",
-                                               "🚵🏻‍♀️",
-                                               "🚵🏼‍♀️",
-                                               "🚵🏽‍♀️",
-                                               "🚵🏾‍♀️",
-                                               "🚵🏿‍♀️",
-                                               "🤸",
-                                               "🤸🏻",
-                                               "🤸🏼",
-                                               "🤸🏽",
-                                               "🤸🏾",
-                                               "🤸🏿",
-                                               "🤸‍♂️",
-                                               "🤸🏻‍♂️",
-                                               "🤸🏼‍♂️",
-                                               "🤸🏽‍♂️",
-                                               "🤸🏾‍♂️",
-                                               "🤸🏿‍♂️",
-                                               "🤸‍♀️",
-                                               "🤸🏻‍♀️",
-                                               "🤸🏼‍♀️",
-                                               "🤸🏽‍♀️",
-                                               "🤸🏾‍♀️",
-                                               "🤸🏿‍♀️",
-                                               "🤼",
-                                               "🤼‍♂️",
-                                               "🤼‍♀️",
-                                               "🤽",
-                                               "🤽🏻",
-                                               "🤽🏼",
-                                               "🤽🏽",
-                                               "🤽🏾",
-                                               "🤽🏿",
-                                               "🤽‍♂️",
-                                               "🤽🏻‍♂️",
-                                               "🤽🏼‍♂️",
-                                               "🤽🏽‍♂️",
-                                               "🤽🏾‍♂️",
-                                               "🤽🏿‍♂️",
-                                               "🤽‍♀️",
-                                               "🤽🏻‍♀️",
-                                               "🤽🏼‍♀️",
-                                               "🤽🏽‍♀️",
-                                               "🤽🏾‍♀️",
-                                               "🤽🏿‍♀️",
-                                               "🤾",
-                                               "🤾🏻",
-                                               "🤾🏼",
-                                               "🤾🏽",
-                                               "🤾🏾",
-                                               "🤾🏿",
-                                               "🤾‍♂️",
-                                               "🤾🏻‍♂️",
-                                               "🤾🏼‍♂️",
-                                               "🤾🏽‍♂️",
-                                               "🤾🏾‍♂️",
-                                               "🤾🏿‍♂️",
-                                               "🤾‍♀️",
-                                               "🤾🏻‍♀️",
-                                               "🤾🏼‍♀️",
-                                               "🤾🏽‍♀️",
-                                               "🤾🏾‍♀️",
-                                               "🤾🏿‍♀️",
-                                               "🤹",
-                                               "🤹🏻",
-                                               "🤹🏼",
-                                               "🤹🏽",
-                                               "🤹🏾",
-                                               "🤹🏿",
-                                               "🤹‍♂️",
-                                               "🤹🏻‍♂️",
-                                               "🤹🏼‍♂️",
-                                               "🤹🏽‍♂️",
-                                               "🤹🏾‍♂️",
-                                               "🤹🏿‍♂️",
-                                               "🤹‍♀️",
-                                               "🤹🏻‍♀️",
-                                               "🤹🏼‍♀️",
-                                               "🤹🏽‍♀️",
-                                               "🤹🏾‍♀️",
-                                               "🤹🏿‍♀️",
-                                               "🧘",
-                                               "🧘🏻",
-                                               "🧘🏼",
-                                               "🧘🏽",
-                                               "🧘🏾",
-                                               "🧘🏿",
-                                               "🧘‍♂️",
-                                               "🧘🏻‍♂️",
-                                               "🧘🏼‍♂️",
-                                               "🧘🏽‍♂️",
-                                               "🧘🏾‍♂️",
-                                               "🧘🏿‍♂️",
-                                               "🧘‍♀️",
-                                               "🧘🏻‍♀️",
-                                               "🧘🏼‍♀️",
-                                               "🧘🏽‍♀️",
-                                               "🧘🏾‍♀️",
-                                               "🧘🏿‍♀️",
-                                               "🛀",
-                                               "🛀🏻",
-                                               "🛀🏼",
-                                               "🛀🏽",
-                                               "🛀🏾",
-                                               "🛀🏿",
-                                               "🛌",
-                                               "🛌🏻",
-                                               "🛌🏼",
-                                               "🛌🏽",
-                                               "🛌🏾",
-                                               "🛌🏿",
-                                               "🧑‍🤝‍🧑",
-                                               "🧑🏻‍🤝‍🧑🏻",
-                                               "🧑🏻‍🤝‍🧑🏼",
-                                               "🧑🏻‍🤝‍🧑🏽",
-                                               "🧑🏻‍🤝‍🧑🏾",
-                                               "🧑🏻‍🤝‍🧑🏿",
-                                               "🧑🏼‍🤝‍🧑🏻",
-                                               "🧑🏼‍🤝‍🧑🏼",
-                                               "🧑🏼‍🤝‍🧑🏽",
-                                               "🧑🏼‍🤝‍🧑🏾",
-                                               "🧑🏼‍🤝‍🧑🏿",
-                                               "🧑🏽‍🤝‍🧑🏻",
-                                               "🧑🏽‍🤝‍🧑🏼",
-                                               "🧑🏽‍🤝‍🧑🏽",
-                                               "🧑🏽‍🤝‍🧑🏾",
-                                               "🧑🏽‍🤝‍🧑🏿",
-                                               "🧑🏾‍🤝‍🧑🏻",
-                                               "🧑🏾‍🤝‍🧑🏼",
-                                               "🧑🏾‍🤝‍🧑🏽",
-                                               "🧑🏾‍🤝‍🧑🏾",
-                                               "🧑🏾‍🤝‍🧑🏿",
-                                               "🧑🏿‍🤝‍🧑🏻",
-                                               "🧑🏿‍🤝‍🧑🏼",
-                                               "🧑🏿‍🤝‍🧑🏽",
-                                               "🧑🏿‍🤝‍🧑🏾",
-                                               "🧑🏿‍🤝‍🧑🏿",
-                                               "👭",
-                                               "👭🏻",
-                                               "👩🏻‍🤝‍👩🏼",
-                                               "👩🏻‍🤝‍👩🏽",
-                                               "👩🏻‍🤝‍👩🏾",
-                                               "👩🏻‍🤝‍👩🏿",
-                                               "👩🏼‍🤝‍👩🏻",
-                                               "👭🏼",
-                                               "👩🏼‍🤝‍👩🏽",
-                                               "👩🏼‍🤝‍👩🏾",
-                                               "👩🏼‍🤝‍👩🏿",
-                                               "👩🏽‍🤝‍👩🏻",
-                                               "👩🏽‍🤝‍👩🏼",
-                                               "👭🏽",
-                                               "👩🏽‍🤝‍👩🏾",
-                                               "👩🏽‍🤝‍👩🏿",
-                                               "👩🏾‍🤝‍👩🏻",
-                                               "👩🏾‍🤝‍👩🏼",
-                                               "👩🏾‍🤝‍👩🏽",
-                                               "👭🏾",
-                                               "👩🏾‍🤝‍👩🏿",
-                                               "👩🏿‍🤝‍👩🏻",
-                                               "👩🏿‍🤝‍👩🏼",
-                                               "👩🏿‍🤝‍👩🏽",
-                                               "👩🏿‍🤝‍👩🏾",
-                                               "👭🏿",
-                                               "👫",
-                                               "👫🏻",
-                                               "👩🏻‍🤝‍👨🏼",
-                                               "👩🏻‍🤝‍👨🏽",
-                                               "👩🏻‍🤝‍👨🏾",
-                                               "👩🏻‍🤝‍👨🏿",
-                                               "👩🏼‍🤝‍👨🏻",
-                                               "👫🏼",
-                                               "👩🏼‍🤝‍👨🏽",
-                                               "👩🏼‍🤝‍👨🏾",
-                                               "👩🏼‍🤝‍👨🏿",
-                                               "👩🏽‍🤝‍👨🏻",
-                                               "👩🏽‍🤝‍👨🏼",
-                                               "👫🏽",
-                                               "👩🏽‍🤝‍👨🏾",
-                                               "👩🏽‍🤝‍👨🏿",
-                                               "👩🏾‍🤝‍👨🏻",
-                                               "👩🏾‍🤝‍👨🏼",
-                                               "👩🏾‍🤝‍👨🏽",
-                                               "👫🏾",
-                                               "👩🏾‍🤝‍👨🏿",
-                                               "👩🏿‍🤝‍👨🏻",
-                                               "👩🏿‍🤝‍👨🏼",
-                                               "👩🏿‍🤝‍👨🏽",
-                                               "👩🏿‍🤝‍👨🏾",
-                                               "👫🏿",
-                                               "👬",
-                                               "👬🏻",
-                                               "👨🏻‍🤝‍👨🏼",
-                                               "👨🏻‍🤝‍👨🏽",
-                                               "👨🏻‍🤝‍👨🏾",
-                                               "👨🏻‍🤝‍👨🏿",
-                                               "👨🏼‍🤝‍👨🏻",
-                                               "👬🏼",
-                                               "👨🏼‍🤝‍👨🏽",
-                                               "👨🏼‍🤝‍👨🏾",
-                                               "👨🏼‍🤝‍👨🏿",
-                                               "👨🏽‍🤝‍👨🏻",
-                                               "👨🏽‍🤝‍👨🏼",
-                                               "👬🏽",
-                                               "👨🏽‍🤝‍👨🏾",
-                                               "👨🏽‍🤝‍👨🏿",
-                                               "👨🏾‍🤝‍👨🏻",
-                                               "👨🏾‍🤝‍👨🏼",
-                                               "👨🏾‍🤝‍👨🏽",
-                                               "👬🏾",
-                                               "👨🏾‍🤝‍👨🏿",
-                                               "👨🏿‍🤝‍👨🏻",
-                                               "👨🏿‍🤝‍👨🏼",
-                                               "👨🏿‍🤝‍👨🏽",
-                                               "👨🏿‍🤝‍👨🏾",
-                                               "👬🏿",
-                                               "💏",
-                                               "💏🏻",
-                                               "💏🏼",
-                                               "💏🏽",
-                                               "💏🏾",
-                                               "💏🏿",
-                                               "🧑🏻‍❤️‍💋‍🧑🏼",
-                                               "🧑🏻‍❤️‍💋‍🧑🏽",
-                                               "🧑🏻‍❤️‍💋‍🧑🏾",
-                                               "🧑🏻‍❤️‍💋‍🧑🏿",
-                                               "🧑🏼‍❤️‍💋‍🧑🏻",
-                                               "🧑🏼‍❤️‍💋‍🧑🏽",
-                                               "🧑🏼‍❤️‍💋‍🧑🏾",
-                                               "🧑🏼‍❤️‍💋‍🧑🏿",
-                                               "🧑🏽‍❤️‍💋‍🧑🏻",
-                                               "🧑🏽‍❤️‍💋‍🧑🏼",
-                                               "🧑🏽‍❤️‍💋‍🧑🏾",
-                                               "🧑🏽‍❤️‍💋‍🧑🏿",
-                                               "🧑🏾‍❤️‍💋‍🧑🏻",
-                                               "🧑🏾‍❤️‍💋‍🧑🏼",
-                                               "🧑🏾‍❤️‍💋‍🧑🏽",
-                                               "🧑🏾‍❤️‍💋‍🧑🏿",
-                                               "🧑🏿‍❤️‍💋‍🧑🏻",
-                                               "🧑🏿‍❤️‍💋‍🧑🏼",
-                                               "🧑🏿‍❤️‍💋‍🧑🏽",
-                                               "🧑🏿‍❤️‍💋‍🧑🏾",
-                                               "👩‍❤️‍💋‍👨",
-                                               "👩🏻‍❤️‍💋‍👨🏻",
-                                               "👩🏻‍❤️‍💋‍👨🏼",
-                                               "👩🏻‍❤️‍💋‍👨🏽",
-                                               "👩🏻‍❤️‍💋‍👨🏾",
-                                               "👩🏻‍❤️‍💋‍👨🏿",
-                                               "👩🏼‍❤️‍💋‍👨🏻",
-                                               "👩🏼‍❤️‍💋‍👨🏼",
-                                               "👩🏼‍❤️‍💋‍👨🏽",
-                                               "👩🏼‍❤️‍💋‍👨🏾",
-                                               "👩🏼‍❤️‍💋‍👨🏿",
-                                               "👩🏽‍❤️‍💋‍👨🏻",
-                                               "👩🏽‍❤️‍💋‍👨🏼",
-                                               "👩🏽‍❤️‍💋‍👨🏽",
-                                               "👩🏽‍❤️‍💋‍👨🏾",
-                                               "👩🏽‍❤️‍💋‍👨🏿",
-                                               "👩🏾‍❤️‍💋‍👨🏻",
-                                               "👩🏾‍❤️‍💋‍👨🏼",
-                                               "👩🏾‍❤️‍💋‍👨🏽",
-                                               "👩🏾‍❤️‍💋‍👨🏾",
-                                               "👩🏾‍❤️‍💋‍👨🏿",
-                                               "👩🏿‍❤️‍💋‍👨🏻",
-                                               "👩🏿‍❤️‍💋‍👨🏼",
-                                               "👩🏿‍❤️‍💋‍👨🏽",
-                                               "👩🏿‍❤️‍💋‍👨🏾",
-                                               "👩🏿‍❤️‍💋‍👨🏿",
-                                               "👨‍❤️‍💋‍👨",
-                                               "👨🏻‍❤️‍💋‍👨🏻",
-                                               "👨🏻‍❤️‍💋‍👨🏼",
-                                               "👨🏻‍❤️‍💋‍👨🏽",
-                                               "👨🏻‍❤️‍💋‍👨🏾",
-                                               "👨🏻‍❤️‍💋‍👨🏿",
-                                               "👨🏼‍❤️‍💋‍👨🏻",
-                                               "👨🏼‍❤️‍💋‍👨🏼",
-                                               "👨🏼‍❤️‍💋‍👨🏽",
-                                               "👨🏼‍❤️‍💋‍👨🏾",
-                                               "👨🏼‍❤️‍💋‍👨🏿",
-                                               "👨🏽‍❤️‍💋‍👨🏻",
-                                               "👨🏽‍❤️‍💋‍👨🏼",
-                                               "👨🏽‍❤️‍💋‍👨🏽",
-                                               "👨🏽‍❤️‍💋‍👨🏾",
-                                               "👨🏽‍❤️‍💋‍👨🏿",
-                                               "👨🏾‍❤️‍💋‍👨🏻",
-                                               "👨🏾‍❤️‍💋‍👨🏼",
-                                               "👨🏾‍❤️‍💋‍👨🏽",
-                                               "👨🏾‍❤️‍💋‍👨🏾",
-                                               "👨🏾‍❤️‍💋‍👨🏿",
-                                               "👨🏿‍❤️‍💋‍👨🏻",
-                                               "👨🏿‍❤️‍💋‍👨🏼",
-                                               "👨🏿‍❤️‍💋‍👨🏽",
-                                               "👨🏿‍❤️‍💋‍👨🏾",
-                                               "👨🏿‍❤️‍💋‍👨🏿",
-                                               "👩‍❤️‍💋‍👩",
-                                               "👩🏻‍❤️‍💋‍👩🏻",
-                                               "👩🏻‍❤️‍💋‍👩🏼",
-                                               "👩🏻‍❤️‍💋‍👩🏽",
-                                               "👩🏻‍❤️‍💋‍👩🏾",
-                                               "👩🏻‍❤️‍💋‍👩🏿",
-                                               "👩🏼‍❤️‍💋‍👩🏻",
-                                               "👩🏼‍❤️‍💋‍👩🏼",
-                                               "👩🏼‍❤️‍💋‍👩🏽",
-                                               "👩🏼‍❤️‍💋‍👩🏾",
-                                               "👩🏼‍❤️‍💋‍👩🏿",
-                                               "👩🏽‍❤️‍💋‍👩🏻",
-                                               "👩🏽‍❤️‍💋‍👩🏼",
-                                               "👩🏽‍❤️‍💋‍👩🏽",
-                                               "👩🏽‍❤️‍💋‍👩🏾",
-                                               "👩🏽‍❤️‍💋‍👩🏿",
-                                               "👩🏾‍❤️‍💋‍👩🏻",
-                                               "👩🏾‍❤️‍💋‍👩🏼",
-                                               "👩🏾‍❤️‍💋‍👩🏽",
-                                               "👩🏾‍❤️‍💋‍👩🏾",
-                                               "👩🏾‍❤️‍💋‍👩🏿",
-                                               "👩🏿‍❤️‍💋‍👩🏻",
-                                               "👩🏿‍❤️‍💋‍👩🏼",
-                                               "👩🏿‍❤️‍💋‍👩🏽",
-                                               "👩🏿‍❤️‍💋‍👩🏾",
-                                               "👩🏿‍❤️‍💋‍👩🏿",
-                                               "💑",
-                                               "💑🏻",
-                                               "💑🏼",
-                                               "💑🏽",
-                                               "💑🏾",
-                                               "💑🏿",
-                                               "🧑🏻‍❤️‍🧑🏼",
-                                               "🧑🏻‍❤️‍🧑🏽",
-                                               "🧑🏻‍❤️‍🧑🏾",
-                                               "🧑🏻‍❤️‍🧑🏿",
-                                               "🧑🏼‍❤️‍🧑🏻",
-                                               "🧑🏼‍❤️‍🧑🏽",
-                                               "🧑🏼‍❤️‍🧑🏾",
-                                               "🧑🏼‍❤️‍🧑🏿",
-                                               "🧑🏽‍❤️‍🧑🏻",
-                                               "🧑🏽‍❤️‍🧑🏼",
-                                               "🧑🏽‍❤️‍🧑🏾",
-                                               "🧑🏽‍❤️‍🧑🏿",
-                                               "🧑🏾‍❤️‍🧑🏻",
-                                               "🧑🏾‍❤️‍🧑🏼",
-                                               "🧑🏾‍❤️‍🧑🏽",
-                                               "🧑🏾‍❤️‍🧑🏿",
-                                               "🧑🏿‍❤️‍🧑🏻",
-                                               "🧑🏿‍❤️‍🧑🏼",
-                                               "🧑🏿‍❤️‍🧑🏽",
-                                               "🧑🏿‍❤️‍🧑🏾",
-                                               "👩‍❤️‍👨",
-                                               "👩🏻‍❤️‍👨🏻",
-                                               "👩🏻‍❤️‍👨🏼",
-                                               "👩🏻‍❤️‍👨🏽",
-                                               "👩🏻‍❤️‍👨🏾",
-                                               "👩🏻‍❤️‍👨🏿",
-                                               "👩🏼‍❤️‍👨🏻",
-                                               "👩🏼‍❤️‍👨🏼",
-                                               "👩🏼‍❤️‍👨🏽",
-                                               "👩🏼‍❤️‍👨🏾",
-                                               "👩🏼‍❤️‍👨🏿",
-                                               "👩🏽‍❤️‍👨🏻",
-                                               "👩🏽‍❤️‍👨🏼",
-                                               "👩🏽‍❤️‍👨🏽",
-                                               "👩🏽‍❤️‍👨🏾",
-                                               "👩🏽‍❤️‍👨🏿",
-                                               "👩🏾‍❤️‍👨🏻",
-                                               "👩🏾‍❤️‍👨🏼",
-                                               "👩🏾‍❤️‍👨🏽",
-                                               "👩🏾‍❤️‍👨🏾",
-                                               "👩🏾‍❤️‍👨🏿",
-                                               "👩🏿‍❤️‍👨🏻",
-                                               "👩🏿‍❤️‍👨🏼",
-                                               "👩🏿‍❤️‍👨🏽",
-                                               "👩🏿‍❤️‍👨🏾",
-                                               "👩🏿‍❤️‍👨🏿",
-                                               "👨‍❤️‍👨",
-                                               "👨🏻‍❤️‍👨🏻",
-                                               "👨🏻‍❤️‍👨🏼",
-                                               "👨🏻‍❤️‍👨🏽",
-                                               "👨🏻‍❤️‍👨🏾",
-                                               "👨🏻‍❤️‍👨🏿",
-                                               "👨🏼‍❤️‍👨🏻",
-                                               "👨🏼‍❤️‍👨🏼",
-                                               "👨🏼‍❤️‍👨🏽",
-                                               "👨🏼‍❤️‍👨🏾",
-                                               "👨🏼‍❤️‍👨🏿",
-                                               "👨🏽‍❤️‍👨🏻",
-                                               "👨🏽‍❤️‍👨🏼",
-                                               "👨🏽‍❤️‍👨🏽",
-                                               "👨🏽‍❤️‍👨🏾",
-                                               "👨🏽‍❤️‍👨🏿",
-                                               "👨🏾‍❤️‍👨🏻",
-                                               "👨🏾‍❤️‍👨🏼",
-                                               "👨🏾‍❤️‍👨🏽",
-                                               "👨🏾‍❤️‍👨🏾",
-                                               "👨🏾‍❤️‍👨🏿",
-                                               "👨🏿‍❤️‍👨🏻",
-                                               "👨🏿‍❤️‍👨🏼",
-                                               "👨🏿‍❤️‍👨🏽",
-                                               "👨🏿‍❤️‍👨🏾",
-                                               "👨🏿‍❤️‍👨🏿",
-                                               "👩‍❤️‍👩",
-                                               "👩🏻‍❤️‍👩🏻",
-                                               "👩🏻‍❤️‍👩🏼",
-                                               "👩🏻‍❤️‍👩🏽",
-                                               "👩🏻‍❤️‍👩🏾",
-                                               "👩🏻‍❤️‍👩🏿",
-                                               "👩🏼‍❤️‍👩🏻",
-                                               "👩🏼‍❤️‍👩🏼",
-                                               "👩🏼‍❤️‍👩🏽",
-                                               "👩🏼‍❤️‍👩🏾",
-                                               "👩🏼‍❤️‍👩🏿",
-                                               "👩🏽‍❤️‍👩🏻",
-                                               "👩🏽‍❤️‍👩🏼",
-                                               "👩🏽‍❤️‍👩🏽",
-                                               "👩🏽‍❤️‍👩🏾",
-                                               "👩🏽‍❤️‍👩🏿",
-                                               "👩🏾‍❤️‍👩🏻",
-                                               "👩🏾‍❤️‍👩🏼",
-                                               "👩🏾‍❤️‍👩🏽",
-                                               "👩🏾‍❤️‍👩🏾",
-                                               "👩🏾‍❤️‍👩🏿",
-                                               "👩🏿‍❤️‍👩🏻",
-                                               "👩🏿‍❤️‍👩🏼",
-                                               "👩🏿‍❤️‍👩🏽",
-                                               "👩🏿‍❤️‍👩🏾",
-                                               "👩🏿‍❤️‍👩🏿",
-                                               "👪",
-                                               "👨‍👩‍👦",
-                                               "👨‍👩‍👧",
-                                               "👨‍👩‍👧‍👦",
-                                               "👨‍👩‍👦‍👦",
-                                               "👨‍👩‍👧‍👧",
-                                               "👨‍👨‍👦",
-                                               "👨‍👨‍👧",
-                                               "👨‍👨‍👧‍👦",
-                                               "👨‍👨‍👦‍👦",
-                                               "👨‍👨‍👧‍👧",
-                                               "👩‍👩‍👦",
-                                               "👩‍👩‍👧",
-                                               "👩‍👩‍👧‍👦",
-                                               "👩‍👩‍👦‍👦",
-                                               "👩‍👩‍👧‍👧",
-                                               "👨‍👦",
-                                               "👨‍👦‍👦",
-                                               "👨‍👧",
-                                               "👨‍👧‍👦",
-                                               "👨‍👧‍👧",
-                                               "👩‍👦",
-                                               "👩‍👦‍👦",
-                                               "👩‍👧",
-                                               "👩‍👧‍👦",
-                                               "👩‍👧‍👧",
-                                               "🗣️",
-                                               "👤",
-                                               "👥",
-                                               "🫂",
-                                               "👣"};
+inline constexpr auto personEmojis = std::to_array<std::string_view>({"👶",
+                                                               "👶🏻",
+                                                               "👶🏼",
+                                                               "👶🏽",
+                                                               "👶🏾",
+                                                               "👶🏿",
+                                                               "🧒",
+                                                               "🧒🏻",
+                                                               "🧒🏼",
+                                                               "🧒🏽",
+                                                               "🧒🏾",
+                                                               "🧒🏿",
+                                                               "👦",
+                                                               "👦🏻",
+                                                               "👦🏼",
+                                                               "👦🏽",
+                                                               "👦🏾",
+                                                               "👦🏿",
+                                                               "👧",
+                                                               "👧🏻",
+                                                               "👧🏼",
+                                                               "👧🏽",
+                                                               "👧🏾",
+                                                               "👧🏿",
+                                                               "🧑",
+                                                               "🧑🏻",
+                                                               "🧑🏼",
+                                                               "🧑🏽",
+                                                               "🧑🏾",
+                                                               "🧑🏿",
+                                                               "👱",
+                                                               "👱🏻",
+                                                               "👱🏼",
+                                                               "👱🏽",
+                                                               "👱🏾",
+                                                               "👱🏿",
+                                                               "👨",
+                                                               "👨🏻",
+                                                               "👨🏼",
+                                                               "👨🏽",
+                                                               "👨🏾",
+                                                               "👨🏿",
+                                                               "🧔",
+                                                               "🧔🏻",
+                                                               "🧔🏼",
+                                                               "🧔🏽",
+                                                               "🧔🏾",
+                                                               "🧔🏿",
+                                                               "🧔‍♂️",
+                                                               "🧔🏻‍♂️",
+                                                               "🧔🏼‍♂️",
+                                                               "🧔🏽‍♂️",
+                                                               "🧔🏾‍♂️",
+                                                               "🧔🏿‍♂️",
+                                                               "🧔‍♀️",
+                                                               "🧔🏻‍♀️",
+                                                               "🧔🏼‍♀️",
+                                                               "🧔🏽‍♀️",
+                                                               "🧔🏾‍♀️",
+                                                               "🧔🏿‍♀️",
+                                                               "👨‍🦰",
+                                                               "👨🏻‍🦰",
+                                                               "👨🏼‍🦰",
+                                                               "👨🏽‍🦰",
+                                                               "👨🏾‍🦰",
+                                                               "👨🏿‍🦰",
+                                                               "👨‍🦱",
+                                                               "👨🏻‍🦱",
+                                                               "👨🏼‍🦱",
+                                                               "👨🏽‍🦱",
+                                                               "👨🏾‍🦱",
+                                                               "👨🏿‍🦱",
+                                                               "👨‍🦳",
+                                                               "👨🏻‍🦳",
+                                                               "👨🏼‍🦳",
+                                                               "👨🏽‍🦳",
+                                                               "👨🏾‍🦳",
+                                                               "👨🏿‍🦳",
+                                                               "👨‍🦲",
+                                                               "👨🏻‍🦲",
+                                                               "👨🏼‍🦲",
+                                                               "👨🏽‍🦲",
+                                                               "👨🏾‍🦲",
+                                                               "👨🏿‍🦲",
+                                                               "👩",
+                                                               "👩🏻",
+                                                               "👩🏼",
+                                                               "👩🏽",
+                                                               "👩🏾",
+                                                               "👩🏿",
+                                                               "👩‍🦰",
+                                                               "👩🏻‍🦰",
+                                                               "👩🏼‍🦰",
+                                                               "👩🏽‍🦰",
+                                                               "👩🏾‍🦰",
+                                                               "👩🏿‍🦰",
+                                                               "🧑‍🦰",
+                                                               "🧑🏻‍🦰",
+                                                               "🧑🏼‍🦰",
+                                                               "🧑🏽‍🦰",
+                                                               "🧑🏾‍🦰",
+                                                               "🧑🏿‍🦰",
+                                                               "👩‍🦱",
+                                                               "👩🏻‍🦱",
+                                                               "👩🏼‍🦱",
+                                                               "👩🏽‍🦱",
+                                                               "👩🏾‍🦱",
+                                                               "👩🏿‍🦱",
+                                                               "🧑‍🦱",
+                                                               "🧑🏻‍🦱",
+                                                               "🧑🏼‍🦱",
+                                                               "🧑🏽‍🦱",
+                                                               "🧑🏾‍🦱",
+                                                               "🧑🏿‍🦱",
+                                                               "👩‍🦳",
+                                                               "👩🏻‍🦳",
+                                                               "👩🏼‍🦳",
+                                                               "👩🏽‍🦳",
+                                                               "👩🏾‍🦳",
+                                                               "👩🏿‍🦳",
+                                                               "🧑‍🦳",
+                                                               "🧑🏻‍🦳",
+                                                               "🧑🏼‍🦳",
+                                                               "🧑🏽‍🦳",
+                                                               "🧑🏾‍🦳",
+                                                               "🧑🏿‍🦳",
+                                                               "👩‍🦲",
+                                                               "👩🏻‍🦲",
+                                                               "👩🏼‍🦲",
+                                                               "👩🏽‍🦲",
+                                                               "👩🏾‍🦲",
+                                                               "👩🏿‍🦲",
+                                                               "🧑‍🦲",
+                                                               "🧑🏻‍🦲",
+                                                               "🧑🏼‍🦲",
+                                                               "🧑🏽‍🦲",
+                                                               "🧑🏾‍🦲",
+                                                               "🧑🏿‍🦲",
+                                                               "👱‍♀️",
+                                                               "👱🏻‍♀️",
+                                                               "👱🏼‍♀️",
+                                                               "👱🏽‍♀️",
+                                                               "👱🏾‍♀️",
+                                                               "👱🏿‍♀️",
+                                                               "👱‍♂️",
+                                                               "👱🏻‍♂️",
+                                                               "👱🏼‍♂️",
+                                                               "👱🏽‍♂️",
+                                                               "👱🏾‍♂️",
+                                                               "👱🏿‍♂️",
+                                                               "🧓",
+                                                               "🧓🏻",
+                                                               "🧓🏼",
+                                                               "🧓🏽",
+                                                               "🧓🏾",
+                                                               "🧓🏿",
+                                                               "👴",
+                                                               "👴🏻",
+                                                               "👴🏼",
+                                                               "👴🏽",
+                                                               "👴🏾",
+                                                               "👴🏿",
+                                                               "👵",
+                                                               "👵🏻",
+                                                               "👵🏼",
+                                                               "👵🏽",
+                                                               "👵🏾",
+                                                               "👵🏿",
+                                                               "🙍",
+                                                               "🙍🏻",
+                                                               "🙍🏼",
+                                                               "🙍🏽",
+                                                               "🙍🏾",
+                                                               "🙍🏿",
+                                                               "🙍‍♂️",
+                                                               "🙍🏻‍♂️",
+                                                               "🙍🏼‍♂️",
+                                                               "🙍🏽‍♂️",
+                                                               "🙍🏾‍♂️",
+                                                               "🙍🏿‍♂️",
+                                                               "🙍‍♀️",
+                                                               "🙍🏻‍♀️",
+                                                               "🙍🏼‍♀️",
+                                                               "🙍🏽‍♀️",
+                                                               "🙍🏾‍♀️",
+                                                               "🙍🏿‍♀️",
+                                                               "🙎",
+                                                               "🙎🏻",
+                                                               "🙎🏼",
+                                                               "🙎🏽",
+                                                               "🙎🏾",
+                                                               "🙎🏿",
+                                                               "🙎‍♂️",
+                                                               "🙎🏻‍♂️",
+                                                               "🙎🏼‍♂️",
+                                                               "🙎🏽‍♂️",
+                                                               "🙎🏾‍♂️",
+                                                               "🙎🏿‍♂️",
+                                                               "🙎‍♀️",
+                                                               "🙎🏻‍♀️",
+                                                               "🙎🏼‍♀️",
+                                                               "🙎🏽‍♀️",
+                                                               "🙎🏾‍♀️",
+                                                               "🙎🏿‍♀️",
+                                                               "🙅",
+                                                               "🙅🏻",
+                                                               "🙅🏼",
+                                                               "🙅🏽",
+                                                               "🙅🏾",
+                                                               "🙅🏿",
+                                                               "🙅‍♂️",
+                                                               "🙅🏻‍♂️",
+                                                               "🙅🏼‍♂️",
+                                                               "🙅🏽‍♂️",
+                                                               "🙅🏾‍♂️",
+                                                               "🙅🏿‍♂️",
+                                                               "🙅‍♀️",
+                                                               "🙅🏻‍♀️",
+                                                               "🙅🏼‍♀️",
+                                                               "🙅🏽‍♀️",
+                                                               "🙅🏾‍♀️",
+                                                               "🙅🏿‍♀️",
+                                                               "🙆",
+                                                               "🙆🏻",
+                                                               "🙆🏼",
+                                                               "🙆🏽",
+                                                               "🙆🏾",
+                                                               "🙆🏿",
+                                                               "🙆‍♂️",
+                                                               "🙆🏻‍♂️",
+                                                               "🙆🏼‍♂️",
+                                                               "🙆🏽‍♂️",
+                                                               "🙆🏾‍♂️",
+                                                               "🙆🏿‍♂️",
+                                                               "🙆‍♀️",
+                                                               "🙆🏻‍♀️",
+                                                               "🙆🏼‍♀️",
+                                                               "🙆🏽‍♀️",
+                                                               "🙆🏾‍♀️",
+                                                               "🙆🏿‍♀️",
+                                                               "💁",
+                                                               "💁🏻",
+                                                               "💁🏼",
+                                                               "💁🏽",
+                                                               "💁🏾",
+                                                               "💁🏿",
+                                                               "💁‍♂️",
+                                                               "💁🏻‍♂️",
+                                                               "💁🏼‍♂️",
+                                                               "💁🏽‍♂️",
+                                                               "💁🏾‍♂️",
+                                                               "💁🏿‍♂️",
+                                                               "💁‍♀️",
+                                                               "💁🏻‍♀️",
+                                                               "💁🏼‍♀️",
+                                                               "💁🏽‍♀️",
+                                                               "💁🏾‍♀️",
+                                                               "💁🏿‍♀️",
+                                                               "🙋",
+                                                               "🙋🏻",
+                                                               "🙋🏼",
+                                                               "🙋🏽",
+                                                               "🙋🏾",
+                                                               "🙋🏿",
+                                                               "🙋‍♂️",
+                                                               "🙋🏻‍♂️",
+                                                               "🙋🏼‍♂️",
+                                                               "🙋🏽‍♂️",
+                                                               "🙋🏾‍♂️",
+                                                               "🙋🏿‍♂️",
+                                                               "🙋‍♀️",
+                                                               "🙋🏻‍♀️",
+                                                               "🙋🏼‍♀️",
+                                                               "🙋🏽‍♀️",
+                                                               "🙋🏾‍♀️",
+                                                               "🙋🏿‍♀️",
+                                                               "🧏",
+                                                               "🧏🏻",
+                                                               "🧏🏼",
+                                                               "🧏🏽",
+                                                               "🧏🏾",
+                                                               "🧏🏿",
+                                                               "🧏‍♂️",
+                                                               "🧏🏻‍♂️",
+                                                               "🧏🏼‍♂️",
+                                                               "🧏🏽‍♂️",
+                                                               "🧏🏾‍♂️",
+                                                               "🧏🏿‍♂️",
+                                                               "🧏‍♀️",
+                                                               "🧏🏻‍♀️",
+                                                               "🧏🏼‍♀️",
+                                                               "🧏🏽‍♀️",
+                                                               "🧏🏾‍♀️",
+                                                               "🧏🏿‍♀️",
+                                                               "🙇",
+                                                               "🙇🏻",
+                                                               "🙇🏼",
+                                                               "🙇🏽",
+                                                               "🙇🏾",
+                                                               "🙇🏿",
+                                                               "🙇‍♂️",
+                                                               "🙇🏻‍♂️",
+                                                               "🙇🏼‍♂️",
+                                                               "🙇🏽‍♂️",
+                                                               "🙇🏾‍♂️",
+                                                               "🙇🏿‍♂️",
+                                                               "🙇‍♀️",
+                                                               "🙇🏻‍♀️",
+                                                               "🙇🏼‍♀️",
+                                                               "🙇🏽‍♀️",
+                                                               "🙇🏾‍♀️",
+                                                               "🙇🏿‍♀️",
+                                                               "🤦",
+                                                               "🤦🏻",
+                                                               "🤦🏼",
+                                                               "🤦🏽",
+                                                               "🤦🏾",
+                                                               "🤦🏿",
+                                                               "🤦‍♂️",
+                                                               "🤦🏻‍♂️",
+                                                               "🤦🏼‍♂️",
+                                                               "🤦🏽‍♂️",
+                                                               "🤦🏾‍♂️",
+                                                               "🤦🏿‍♂️",
+                                                               "🤦‍♀️",
+                                                               "🤦🏻‍♀️",
+                                                               "🤦🏼‍♀️",
+                                                               "🤦🏽‍♀️",
+                                                               "🤦🏾‍♀️",
+                                                               "🤦🏿‍♀️",
+                                                               "🤷",
+                                                               "🤷🏻",
+                                                               "🤷🏼",
+                                                               "🤷🏽",
+                                                               "🤷🏾",
+                                                               "🤷🏿",
+                                                               "🤷‍♂️",
+                                                               "🤷🏻‍♂️",
+                                                               "🤷🏼‍♂️",
+                                                               "🤷🏽‍♂️",
+                                                               "🤷🏾‍♂️",
+                                                               "🤷🏿‍♂️",
+                                                               "🤷‍♀️",
+                                                               "🤷🏻‍♀️",
+                                                               "🤷🏼‍♀️",
+                                                               "🤷🏽‍♀️",
+                                                               "🤷🏾‍♀️",
+                                                               "🤷🏿‍♀️",
+                                                               "🧑‍⚕️",
+                                                               "🧑🏻‍⚕️",
+                                                               "🧑🏼‍⚕️",
+                                                               "🧑🏽‍⚕️",
+                                                               "🧑🏾‍⚕️",
+                                                               "🧑🏿‍⚕️",
+                                                               "👨‍⚕️",
+                                                               "👨🏻‍⚕️",
+                                                               "👨🏼‍⚕️",
+                                                               "👨🏽‍⚕️",
+                                                               "👨🏾‍⚕️",
+                                                               "👨🏿‍⚕️",
+                                                               "👩‍⚕️",
+                                                               "👩🏻‍⚕️",
+                                                               "👩🏼‍⚕️",
+                                                               "👩🏽‍⚕️",
+                                                               "👩🏾‍⚕️",
+                                                               "👩🏿‍⚕️",
+                                                               "🧑‍🎓",
+                                                               "🧑🏻‍🎓",
+                                                               "🧑🏼‍🎓",
+                                                               "🧑🏽‍🎓",
+                                                               "🧑🏾‍🎓",
+                                                               "🧑🏿‍🎓",
+                                                               "👨‍🎓",
+                                                               "👨🏻‍🎓",
+                                                               "👨🏼‍🎓",
+                                                               "👨🏽‍🎓",
+                                                               "👨🏾‍🎓",
+                                                               "👨🏿‍🎓",
+                                                               "👩‍🎓",
+                                                               "👩🏻‍🎓",
+                                                               "👩🏼‍🎓",
+                                                               "👩🏽‍🎓",
+                                                               "👩🏾‍🎓",
+                                                               "👩🏿‍🎓",
+                                                               "🧑‍🏫",
+                                                               "🧑🏻‍🏫",
+                                                               "🧑🏼‍🏫",
+                                                               "🧑🏽‍🏫",
+                                                               "🧑🏾‍🏫",
+                                                               "🧑🏿‍🏫",
+                                                               "👨‍🏫",
+                                                               "👨🏻‍🏫",
+                                                               "👨🏼‍🏫",
+                                                               "👨🏽‍🏫",
+                                                               "👨🏾‍🏫",
+                                                               "👨🏿‍🏫",
+                                                               "👩‍🏫",
+                                                               "👩🏻‍🏫",
+                                                               "👩🏼‍🏫",
+                                                               "👩🏽‍🏫",
+                                                               "👩🏾‍🏫",
+                                                               "👩🏿‍🏫",
+                                                               "🧑‍⚖️",
+                                                               "🧑🏻‍⚖️",
+                                                               "🧑🏼‍⚖️",
+                                                               "🧑🏽‍⚖️",
+                                                               "🧑🏾‍⚖️",
+                                                               "🧑🏿‍⚖️",
+                                                               "👨‍⚖️",
+                                                               "👨🏻‍⚖️",
+                                                               "👨🏼‍⚖️",
+                                                               "👨🏽‍⚖️",
+                                                               "👨🏾‍⚖️",
+                                                               "👨🏿‍⚖️",
+                                                               "👩‍⚖️",
+                                                               "👩🏻‍⚖️",
+                                                               "👩🏼‍⚖️",
+                                                               "👩🏽‍⚖️",
+                                                               "👩🏾‍⚖️",
+                                                               "👩🏿‍⚖️",
+                                                               "🧑‍🌾",
+                                                               "🧑🏻‍🌾",
+                                                               "🧑🏼‍🌾",
+                                                               "🧑🏽‍🌾",
+                                                               "🧑🏾‍🌾",
+                                                               "🧑🏿‍🌾",
+                                                               "👨‍🌾",
+                                                               "👨🏻‍🌾",
+                                                               "👨🏼‍🌾",
+                                                               "👨🏽‍🌾",
+                                                               "👨🏾‍🌾",
+                                                               "👨🏿‍🌾",
+                                                               "👩‍🌾",
+                                                               "👩🏻‍🌾",
+                                                               "👩🏼‍🌾",
+                                                               "👩🏽‍🌾",
+                                                               "👩🏾‍🌾",
+                                                               "👩🏿‍🌾",
+                                                               "🧑‍🍳",
+                                                               "🧑🏻‍🍳",
+                                                               "🧑🏼‍🍳",
+                                                               "🧑🏽‍🍳",
+                                                               "🧑🏾‍🍳",
+                                                               "🧑🏿‍🍳",
+                                                               "👨‍🍳",
+                                                               "👨🏻‍🍳",
+                                                               "👨🏼‍🍳",
+                                                               "👨🏽‍🍳",
+                                                               "👨🏾‍🍳",
+                                                               "👨🏿‍🍳",
+                                                               "👩‍🍳",
+                                                               "👩🏻‍🍳",
+                                                               "👩🏼‍🍳",
+                                                               "👩🏽‍🍳",
+                                                               "👩🏾‍🍳",
+                                                               "👩🏿‍🍳",
+                                                               "🧑‍🔧",
+                                                               "🧑🏻‍🔧",
+                                                               "🧑🏼‍🔧",
+                                                               "🧑🏽‍🔧",
+                                                               "🧑🏾‍🔧",
+                                                               "🧑🏿‍🔧",
+                                                               "👨‍🔧",
+                                                               "👨🏻‍🔧",
+                                                               "👨🏼‍🔧",
+                                                               "👨🏽‍🔧",
+                                                               "👨🏾‍🔧",
+                                                               "👨🏿‍🔧",
+                                                               "👩‍🔧",
+                                                               "👩🏻‍🔧",
+                                                               "👩🏼‍🔧",
+                                                               "👩🏽‍🔧",
+                                                               "👩🏾‍🔧",
+                                                               "👩🏿‍🔧",
+                                                               "🧑‍🏭",
+                                                               "🧑🏻‍🏭",
+                                                               "🧑🏼‍🏭",
+                                                               "🧑🏽‍🏭",
+                                                               "🧑🏾‍🏭",
+                                                               "🧑🏿‍🏭",
+                                                               "👨‍🏭",
+                                                               "👨🏻‍🏭",
+                                                               "👨🏼‍🏭",
+                                                               "👨🏽‍🏭",
+                                                               "👨🏾‍🏭",
+                                                               "👨🏿‍🏭",
+                                                               "👩‍🏭",
+                                                               "👩🏻‍🏭",
+                                                               "👩🏼‍🏭",
+                                                               "👩🏽‍🏭",
+                                                               "👩🏾‍🏭",
+                                                               "👩🏿‍🏭",
+                                                               "🧑‍💼",
+                                                               "🧑🏻‍💼",
+                                                               "🧑🏼‍💼",
+                                                               "🧑🏽‍💼",
+                                                               "🧑🏾‍💼",
+                                                               "🧑🏿‍💼",
+                                                               "👨‍💼",
+                                                               "👨🏻‍💼",
+                                                               "👨🏼‍💼",
+                                                               "👨🏽‍💼",
+                                                               "👨🏾‍💼",
+                                                               "👨🏿‍💼",
+                                                               "👩‍💼",
+                                                               "👩🏻‍💼",
+                                                               "👩🏼‍💼",
+                                                               "👩🏽‍💼",
+                                                               "👩🏾‍💼",
+                                                               "👩🏿‍💼",
+                                                               "🧑‍🔬",
+                                                               "🧑🏻‍🔬",
+                                                               "🧑🏼‍🔬",
+                                                               "🧑🏽‍🔬",
+                                                               "🧑🏾‍🔬",
+                                                               "🧑🏿‍🔬",
+                                                               "👨‍🔬",
+                                                               "👨🏻‍🔬",
+                                                               "👨🏼‍🔬",
+                                                               "👨🏽‍🔬",
+                                                               "👨🏾‍🔬",
+                                                               "👨🏿‍🔬",
+                                                               "👩‍🔬",
+                                                               "👩🏻‍🔬",
+                                                               "👩🏼‍🔬",
+                                                               "👩🏽‍🔬",
+                                                               "👩🏾‍🔬",
+                                                               "👩🏿‍🔬",
+                                                               "🧑‍💻",
+                                                               "🧑🏻‍💻",
+                                                               "🧑🏼‍💻",
+                                                               "🧑🏽‍💻",
+                                                               "🧑🏾‍💻",
+                                                               "🧑🏿‍💻",
+                                                               "👨‍💻",
+                                                               "👨🏻‍💻",
+                                                               "👨🏼‍💻",
+                                                               "👨🏽‍💻",
+                                                               "👨🏾‍💻",
+                                                               "👨🏿‍💻",
+                                                               "👩‍💻",
+                                                               "👩🏻‍💻",
+                                                               "👩🏼‍💻",
+                                                               "👩🏽‍💻",
+                                                               "👩🏾‍💻",
+                                                               "👩🏿‍💻",
+                                                               "🧑‍🎤",
+                                                               "🧑🏻‍🎤",
+                                                               "🧑🏼‍🎤",
+                                                               "🧑🏽‍🎤",
+                                                               "🧑🏾‍🎤",
+                                                               "🧑🏿‍🎤",
+                                                               "👨‍🎤",
+                                                               "👨🏻‍🎤",
+                                                               "👨🏼‍🎤",
+                                                               "👨🏽‍🎤",
+                                                               "👨🏾‍🎤",
+                                                               "👨🏿‍🎤",
+                                                               "👩‍🎤",
+                                                               "👩🏻‍🎤",
+                                                               "👩🏼‍🎤",
+                                                               "👩🏽‍🎤",
+                                                               "👩🏾‍🎤",
+                                                               "👩🏿‍🎤",
+                                                               "🧑‍🎨",
+                                                               "🧑🏻‍🎨",
+                                                               "🧑🏼‍🎨",
+                                                               "🧑🏽‍🎨",
+                                                               "🧑🏾‍🎨",
+                                                               "🧑🏿‍🎨",
+                                                               "👨‍🎨",
+                                                               "👨🏻‍🎨",
+                                                               "👨🏼‍🎨",
+                                                               "👨🏽‍🎨",
+                                                               "👨🏾‍🎨",
+                                                               "👨🏿‍🎨",
+                                                               "👩‍🎨",
+                                                               "👩🏻‍🎨",
+                                                               "👩🏼‍🎨",
+                                                               "👩🏽‍🎨",
+                                                               "👩🏾‍🎨",
+                                                               "👩🏿‍🎨",
+                                                               "🧑‍✈️",
+                                                               "🧑🏻‍✈️",
+                                                               "🧑🏼‍✈️",
+                                                               "🧑🏽‍✈️",
+                                                               "🧑🏾‍✈️",
+                                                               "🧑🏿‍✈️",
+                                                               "👨‍✈️",
+                                                               "👨🏻‍✈️",
+                                                               "👨🏼‍✈️",
+                                                               "👨🏽‍✈️",
+                                                               "👨🏾‍✈️",
+                                                               "👨🏿‍✈️",
+                                                               "👩‍✈️",
+                                                               "👩🏻‍✈️",
+                                                               "👩🏼‍✈️",
+                                                               "👩🏽‍✈️",
+                                                               "👩🏾‍✈️",
+                                                               "👩🏿‍✈️",
+                                                               "🧑‍🚀",
+                                                               "🧑🏻‍🚀",
+                                                               "🧑🏼‍🚀",
+                                                               "🧑🏽‍🚀",
+                                                               "🧑🏾‍🚀",
+                                                               "🧑🏿‍🚀",
+                                                               "👨‍🚀",
+                                                               "👨🏻‍🚀",
+                                                               "👨🏼‍🚀",
+                                                               "👨🏽‍🚀",
+                                                               "👨🏾‍🚀",
+                                                               "👨🏿‍🚀",
+                                                               "👩‍🚀",
+                                                               "👩🏻‍🚀",
+                                                               "👩🏼‍🚀",
+                                                               "👩🏽‍🚀",
+                                                               "👩🏾‍🚀",
+                                                               "👩🏿‍🚀",
+                                                               "🧑‍🚒",
+                                                               "🧑🏻‍🚒",
+                                                               "🧑🏼‍🚒",
+                                                               "🧑🏽‍🚒",
+                                                               "🧑🏾‍🚒",
+                                                               "🧑🏿‍🚒",
+                                                               "👨‍🚒",
+                                                               "👨🏻‍🚒",
+                                                               "👨🏼‍🚒",
+                                                               "👨🏽‍🚒",
+                                                               "👨🏾‍🚒",
+                                                               "👨🏿‍🚒",
+                                                               "👩‍🚒",
+                                                               "👩🏻‍🚒",
+                                                               "👩🏼‍🚒",
+                                                               "👩🏽‍🚒",
+                                                               "👩🏾‍🚒",
+                                                               "👩🏿‍🚒",
+                                                               "👮",
+                                                               "👮🏻",
+                                                               "👮🏼",
+                                                               "👮🏽",
+                                                               "👮🏾",
+                                                               "👮🏿",
+                                                               "👮‍♂️",
+                                                               "👮🏻‍♂️",
+                                                               "👮🏼‍♂️",
+                                                               "👮🏽‍♂️",
+                                                               "👮🏾‍♂️",
+                                                               "👮🏿‍♂️",
+                                                               "👮‍♀️",
+                                                               "👮🏻‍♀️",
+                                                               "👮🏼‍♀️",
+                                                               "👮🏽‍♀️",
+                                                               "👮🏾‍♀️",
+                                                               "👮🏿‍♀️",
+                                                               "🕵️",
+                                                               "🕵🏻",
+                                                               "🕵🏼",
+                                                               "🕵🏽",
+                                                               "🕵🏾",
+                                                               "🕵🏿",
+                                                               "🕵️‍♂️",
+                                                               "🕵🏻‍♂️",
+                                                               "🕵🏼‍♂️",
+                                                               "🕵🏽‍♂️",
+                                                               "🕵🏾‍♂️",
+                                                               "🕵🏿‍♂️",
+                                                               "🕵️‍♀️",
+                                                               "🕵🏻‍♀️",
+                                                               "🕵🏼‍♀️",
+                                                               "🕵🏽‍♀️",
+                                                               "🕵🏾‍♀️",
+                                                               "🕵🏿‍♀️",
+                                                               "💂",
+                                                               "💂🏻",
+                                                               "💂🏼",
+                                                               "💂🏽",
+                                                               "💂🏾",
+                                                               "💂🏿",
+                                                               "💂‍♂️",
+                                                               "💂🏻‍♂️",
+                                                               "💂🏼‍♂️",
+                                                               "💂🏽‍♂️",
+                                                               "💂🏾‍♂️",
+                                                               "💂🏿‍♂️",
+                                                               "💂‍♀️",
+                                                               "💂🏻‍♀️",
+                                                               "💂🏼‍♀️",
+                                                               "💂🏽‍♀️",
+                                                               "💂🏾‍♀️",
+                                                               "💂🏿‍♀️",
+                                                               "🥷",
+                                                               "🥷🏻",
+                                                               "🥷🏼",
+                                                               "🥷🏽",
+                                                               "🥷🏾",
+                                                               "🥷🏿",
+                                                               "👷",
+                                                               "👷🏻",
+                                                               "👷🏼",
+                                                               "👷🏽",
+                                                               "👷🏾",
+                                                               "👷🏿",
+                                                               "👷‍♂️",
+                                                               "👷🏻‍♂️",
+                                                               "👷🏼‍♂️",
+                                                               "👷🏽‍♂️",
+                                                               "👷🏾‍♂️",
+                                                               "👷🏿‍♂️",
+                                                               "👷‍♀️",
+                                                               "👷🏻‍♀️",
+                                                               "👷🏼‍♀️",
+                                                               "👷🏽‍♀️",
+                                                               "👷🏾‍♀️",
+                                                               "👷🏿‍♀️",
+                                                               "🤴",
+                                                               "🤴🏻",
+                                                               "🤴🏼",
+                                                               "🤴🏽",
+                                                               "🤴🏾",
+                                                               "🤴🏿",
+                                                               "👸",
+                                                               "👸🏻",
+                                                               "👸🏼",
+                                                               "👸🏽",
+                                                               "👸🏾",
+                                                               "👸🏿",
+                                                               "👳",
+                                                               "👳🏻",
+                                                               "👳🏼",
+                                                               "👳🏽",
+                                                               "👳🏾",
+                                                               "👳🏿",
+                                                               "👳‍♂️",
+                                                               "👳🏻‍♂️",
+                                                               "👳🏼‍♂️",
+                                                               "👳🏽‍♂️",
+                                                               "👳🏾‍♂️",
+                                                               "👳🏿‍♂️",
+                                                               "👳‍♀️",
+                                                               "👳🏻‍♀️",
+                                                               "👳🏼‍♀️",
+                                                               "👳🏽‍♀️",
+                                                               "👳🏾‍♀️",
+                                                               "👳🏿‍♀️",
+                                                               "👲",
+                                                               "👲🏻",
+                                                               "👲🏼",
+                                                               "👲🏽",
+                                                               "👲🏾",
+                                                               "👲🏿",
+                                                               "🧕",
+                                                               "🧕🏻",
+                                                               "🧕🏼",
+                                                               "🧕🏽",
+                                                               "🧕🏾",
+                                                               "🧕🏿",
+                                                               "🤵",
+                                                               "🤵🏻",
+                                                               "🤵🏼",
+                                                               "🤵🏽",
+                                                               "🤵🏾",
+                                                               "🤵🏿",
+                                                               "🤵‍♂️",
+                                                               "🤵🏻‍♂️",
+                                                               "🤵🏼‍♂️",
+                                                               "🤵🏽‍♂️",
+                                                               "🤵🏾‍♂️",
+                                                               "🤵🏿‍♂️",
+                                                               "🤵‍♀️",
+                                                               "🤵🏻‍♀️",
+                                                               "🤵🏼‍♀️",
+                                                               "🤵🏽‍♀️",
+                                                               "🤵🏾‍♀️",
+                                                               "🤵🏿‍♀️",
+                                                               "👰",
+                                                               "👰🏻",
+                                                               "👰🏼",
+                                                               "👰🏽",
+                                                               "👰🏾",
+                                                               "👰🏿",
+                                                               "👰‍♂️",
+                                                               "👰🏻‍♂️",
+                                                               "👰🏼‍♂️",
+                                                               "👰🏽‍♂️",
+                                                               "👰🏾‍♂️",
+                                                               "👰🏿‍♂️",
+                                                               "👰‍♀️",
+                                                               "👰🏻‍♀️",
+                                                               "👰🏼‍♀️",
+                                                               "👰🏽‍♀️",
+                                                               "👰🏾‍♀️",
+                                                               "👰🏿‍♀️",
+                                                               "🤰",
+                                                               "🤰🏻",
+                                                               "🤰🏼",
+                                                               "🤰🏽",
+                                                               "🤰🏾",
+                                                               "🤰🏿",
+                                                               "🤱",
+                                                               "🤱🏻",
+                                                               "🤱🏼",
+                                                               "🤱🏽",
+                                                               "🤱🏾",
+                                                               "🤱🏿",
+                                                               "👩‍🍼",
+                                                               "👩🏻‍🍼",
+                                                               "👩🏼‍🍼",
+                                                               "👩🏽‍🍼",
+                                                               "👩🏾‍🍼",
+                                                               "👩🏿‍🍼",
+                                                               "👨‍🍼",
+                                                               "👨🏻‍🍼",
+                                                               "👨🏼‍🍼",
+                                                               "👨🏽‍🍼",
+                                                               "👨🏾‍🍼",
+                                                               "👨🏿‍🍼",
+                                                               "🧑‍🍼",
+                                                               "🧑🏻‍🍼",
+                                                               "🧑🏼‍🍼",
+                                                               "🧑🏽‍🍼",
+                                                               "🧑🏾‍🍼",
+                                                               "🧑🏿‍🍼",
+                                                               "👼",
+                                                               "👼🏻",
+                                                               "👼🏼",
+                                                               "👼🏽",
+                                                               "👼🏾",
+                                                               "👼🏿",
+                                                               "🎅",
+                                                               "🎅🏻",
+                                                               "🎅🏼",
+                                                               "🎅🏽",
+                                                               "🎅🏾",
+                                                               "🎅🏿",
+                                                               "🤶",
+                                                               "🤶🏻",
+                                                               "🤶🏼",
+                                                               "🤶🏽",
+                                                               "🤶🏾",
+                                                               "🤶🏿",
+                                                               "🧑‍🎄",
+                                                               "🧑🏻‍🎄",
+                                                               "🧑🏼‍🎄",
+                                                               "🧑🏽‍🎄",
+                                                               "🧑🏾‍🎄",
+                                                               "🧑🏿‍🎄",
+                                                               "🦸",
+                                                               "🦸🏻",
+                                                               "🦸🏼",
+                                                               "🦸🏽",
+                                                               "🦸🏾",
+                                                               "🦸🏿",
+                                                               "🦸‍♂️",
+                                                               "🦸🏻‍♂️",
+                                                               "🦸🏼‍♂️",
+                                                               "🦸🏽‍♂️",
+                                                               "🦸🏾‍♂️",
+                                                               "🦸🏿‍♂️",
+                                                               "🦸‍♀️",
+                                                               "🦸🏻‍♀️",
+                                                               "🦸🏼‍♀️",
+                                                               "🦸🏽‍♀️",
+                                                               "🦸🏾‍♀️",
+                                                               "🦸🏿‍♀️",
+                                                               "🦹",
+                                                               "🦹🏻",
+                                                               "🦹🏼",
+                                                               "🦹🏽",
+                                                               "🦹🏾",
+                                                               "🦹🏿",
+                                                               "🦹‍♂️",
+                                                               "🦹🏻‍♂️",
+                                                               "🦹🏼‍♂️",
+                                                               "🦹🏽‍♂️",
+                                                               "🦹🏾‍♂️",
+                                                               "🦹🏿‍♂️",
+                                                               "🦹‍♀️",
+                                                               "🦹🏻‍♀️",
+                                                               "🦹🏼‍♀️",
+                                                               "🦹🏽‍♀️",
+                                                               "🦹🏾‍♀️",
+                                                               "🦹🏿‍♀️",
+                                                               "🧙",
+                                                               "🧙🏻",
+                                                               "🧙🏼",
+                                                               "🧙🏽",
+                                                               "🧙🏾",
+                                                               "🧙🏿",
+                                                               "🧙‍♂️",
+                                                               "🧙🏻‍♂️",
+                                                               "🧙🏼‍♂️",
+                                                               "🧙🏽‍♂️",
+                                                               "🧙🏾‍♂️",
+                                                               "🧙🏿‍♂️",
+                                                               "🧙‍♀️",
+                                                               "🧙🏻‍♀️",
+                                                               "🧙🏼‍♀️",
+                                                               "🧙🏽‍♀️",
+                                                               "🧙🏾‍♀️",
+                                                               "🧙🏿‍♀️",
+                                                               "🧚",
+                                                               "🧚🏻",
+                                                               "🧚🏼",
+                                                               "🧚🏽",
+                                                               "🧚🏾",
+                                                               "🧚🏿",
+                                                               "🧚‍♂️",
+                                                               "🧚🏻‍♂️",
+                                                               "🧚🏼‍♂️",
+                                                               "🧚🏽‍♂️",
+                                                               "🧚🏾‍♂️",
+                                                               "🧚🏿‍♂️",
+                                                               "🧚‍♀️",
+                                                               "🧚🏻‍♀️",
+                                                               "🧚🏼‍♀️",
+                                                               "🧚🏽‍♀️",
+                                                               "🧚🏾‍♀️",
+                                                               "🧚🏿‍♀️",
+                                                               "🧛",
+                                                               "🧛🏻",
+                                                               "🧛🏼",
+                                                               "🧛🏽",
+                                                               "🧛🏾",
+                                                               "🧛🏿",
+                                                               "🧛‍♂️",
+                                                               "🧛🏻‍♂️",
+                                                               "🧛🏼‍♂️",
+                                                               "🧛🏽‍♂️",
+                                                               "🧛🏾‍♂️",
+                                                               "🧛🏿‍♂️",
+                                                               "🧛‍♀️",
+                                                               "🧛🏻‍♀️",
+                                                               "🧛🏼‍♀️",
+                                                               "🧛🏽‍♀️",
+                                                               "🧛🏾‍♀️",
+                                                               "🧛🏿‍♀️",
+                                                               "🧜",
+                                                               "🧜🏻",
+                                                               "🧜🏼",
+                                                               "🧜🏽",
+                                                               "🧜🏾",
+                                                               "🧜🏿",
+                                                               "🧜‍♂️",
+                                                               "🧜🏻‍♂️",
+                                                               "🧜🏼‍♂️",
+                                                               "🧜🏽‍♂️",
+                                                               "🧜🏾‍♂️",
+                                                               "🧜🏿‍♂️",
+                                                               "🧜‍♀️",
+                                                               "🧜🏻‍♀️",
+                                                               "🧜🏼‍♀️",
+                                                               "🧜🏽‍♀️",
+                                                               "🧜🏾‍♀️",
+                                                               "🧜🏿‍♀️",
+                                                               "🧝",
+                                                               "🧝🏻",
+                                                               "🧝🏼",
+                                                               "🧝🏽",
+                                                               "🧝🏾",
+                                                               "🧝🏿",
+                                                               "🧝‍♂️",
+                                                               "🧝🏻‍♂️",
+                                                               "🧝🏼‍♂️",
+                                                               "🧝🏽‍♂️",
+                                                               "🧝🏾‍♂️",
+                                                               "🧝🏿‍♂️",
+                                                               "🧝‍♀️",
+                                                               "🧝🏻‍♀️",
+                                                               "🧝🏼‍♀️",
+                                                               "🧝🏽‍♀️",
+                                                               "🧝🏾‍♀️",
+                                                               "🧝🏿‍♀️",
+                                                               "🧞",
+                                                               "🧞‍♂️",
+                                                               "🧞‍♀️",
+                                                               "🧟",
+                                                               "🧟‍♂️",
+                                                               "🧟‍♀️",
+                                                               "💆",
+                                                               "💆🏻",
+                                                               "💆🏼",
+                                                               "💆🏽",
+                                                               "💆🏾",
+                                                               "💆🏿",
+                                                               "💆‍♂️",
+                                                               "💆🏻‍♂️",
+                                                               "💆🏼‍♂️",
+                                                               "💆🏽‍♂️",
+                                                               "💆🏾‍♂️",
+                                                               "💆🏿‍♂️",
+                                                               "💆‍♀️",
+                                                               "💆🏻‍♀️",
+                                                               "💆🏼‍♀️",
+                                                               "💆🏽‍♀️",
+                                                               "💆🏾‍♀️",
+                                                               "💆🏿‍♀️",
+                                                               "💇",
+                                                               "💇🏻",
+                                                               "💇🏼",
+                                                               "💇🏽",
+                                                               "💇🏾",
+                                                               "💇🏿",
+                                                               "💇‍♂️",
+                                                               "💇🏻‍♂️",
+                                                               "💇🏼‍♂️",
+                                                               "💇🏽‍♂️",
+                                                               "💇🏾‍♂️",
+                                                               "💇🏿‍♂️",
+                                                               "💇‍♀️",
+                                                               "💇🏻‍♀️",
+                                                               "💇🏼‍♀️",
+                                                               "💇🏽‍♀️",
+                                                               "💇🏾‍♀️",
+                                                               "💇🏿‍♀️",
+                                                               "🚶",
+                                                               "🚶🏻",
+                                                               "🚶🏼",
+                                                               "🚶🏽",
+                                                               "🚶🏾",
+                                                               "🚶🏿",
+                                                               "🚶‍♂️",
+                                                               "🚶🏻‍♂️",
+                                                               "🚶🏼‍♂️",
+                                                               "🚶🏽‍♂️",
+                                                               "🚶🏾‍♂️",
+                                                               "🚶🏿‍♂️",
+                                                               "🚶‍♀️",
+                                                               "🚶🏻‍♀️",
+                                                               "🚶🏼‍♀️",
+                                                               "🚶🏽‍♀️",
+                                                               "🚶🏾‍♀️",
+                                                               "🚶🏿‍♀️",
+                                                               "🧍",
+                                                               "🧍🏻",
+                                                               "🧍🏼",
+                                                               "🧍🏽",
+                                                               "🧍🏾",
+                                                               "🧍🏿",
+                                                               "🧍‍♂️",
+                                                               "🧍🏻‍♂️",
+                                                               "🧍🏼‍♂️",
+                                                               "🧍🏽‍♂️",
+                                                               "🧍🏾‍♂️",
+                                                               "🧍🏿‍♂️",
+                                                               "🧍‍♀️",
+                                                               "🧍🏻‍♀️",
+                                                               "🧍🏼‍♀️",
+                                                               "🧍🏽‍♀️",
+                                                               "🧍🏾‍♀️",
+                                                               "🧍🏿‍♀️",
+                                                               "🧎",
+                                                               "🧎🏻",
+                                                               "🧎🏼",
+                                                               "🧎🏽",
+                                                               "🧎🏾",
+                                                               "🧎🏿",
+                                                               "🧎‍♂️",
+                                                               "🧎🏻‍♂️",
+                                                               "🧎🏼‍♂️",
+                                                               "🧎🏽‍♂️",
+                                                               "🧎🏾‍♂️",
+                                                               "🧎🏿‍♂️",
+                                                               "🧎‍♀️",
+                                                               "🧎🏻‍♀️",
+                                                               "🧎🏼‍♀️",
+                                                               "🧎🏽‍♀️",
+                                                               "🧎🏾‍♀️",
+                                                               "🧎🏿‍♀️",
+                                                               "🧑‍🦯",
+                                                               "🧑🏻‍🦯",
+                                                               "🧑🏼‍🦯",
+                                                               "🧑🏽‍🦯",
+                                                               "🧑🏾‍🦯",
+                                                               "🧑🏿‍🦯",
+                                                               "👨‍🦯",
+                                                               "👨🏻‍🦯",
+                                                               "👨🏼‍🦯",
+                                                               "👨🏽‍🦯",
+                                                               "👨🏾‍🦯",
+                                                               "👨🏿‍🦯",
+                                                               "👩‍🦯",
+                                                               "👩🏻‍🦯",
+                                                               "👩🏼‍🦯",
+                                                               "👩🏽‍🦯",
+                                                               "👩🏾‍🦯",
+                                                               "👩🏿‍🦯",
+                                                               "🧑‍🦼",
+                                                               "🧑🏻‍🦼",
+                                                               "🧑🏼‍🦼",
+                                                               "🧑🏽‍🦼",
+                                                               "🧑🏾‍🦼",
+                                                               "🧑🏿‍🦼",
+                                                               "👨‍🦼",
+                                                               "👨🏻‍🦼",
+                                                               "👨🏼‍🦼",
+                                                               "👨🏽‍🦼",
+                                                               "👨🏾‍🦼",
+                                                               "👨🏿‍🦼",
+                                                               "👩‍🦼",
+                                                               "👩🏻‍🦼",
+                                                               "👩🏼‍🦼",
+                                                               "👩🏽‍🦼",
+                                                               "👩🏾‍🦼",
+                                                               "👩🏿‍🦼",
+                                                               "🧑‍🦽",
+                                                               "🧑🏻‍🦽",
+                                                               "🧑🏼‍🦽",
+                                                               "🧑🏽‍🦽",
+                                                               "🧑🏾‍🦽",
+                                                               "🧑🏿‍🦽",
+                                                               "👨‍🦽",
+                                                               "👨🏻‍🦽",
+                                                               "👨🏼‍🦽",
+                                                               "👨🏽‍🦽",
+                                                               "👨🏾‍🦽",
+                                                               "👨🏿‍🦽",
+                                                               "👩‍🦽",
+                                                               "👩🏻‍🦽",
+                                                               "👩🏼‍🦽",
+                                                               "👩🏽‍🦽",
+                                                               "👩🏾‍🦽",
+                                                               "👩🏿‍🦽",
+                                                               "🏃",
+                                                               "🏃🏻",
+                                                               "🏃🏼",
+                                                               "🏃🏽",
+                                                               "🏃🏾",
+                                                               "🏃🏿",
+                                                               "🏃‍♂️",
+                                                               "🏃🏻‍♂️",
+                                                               "🏃🏼‍♂️",
+                                                               "🏃🏽‍♂️",
+                                                               "🏃🏾‍♂️",
+                                                               "🏃🏿‍♂️",
+                                                               "🏃‍♀️",
+                                                               "🏃🏻‍♀️",
+                                                               "🏃🏼‍♀️",
+                                                               "🏃🏽‍♀️",
+                                                               "🏃🏾‍♀️",
+                                                               "🏃🏿‍♀️",
+                                                               "💃",
+                                                               "💃🏻",
+                                                               "💃🏼",
+                                                               "💃🏽",
+                                                               "💃🏾",
+                                                               "💃🏿",
+                                                               "🕺",
+                                                               "🕺🏻",
+                                                               "🕺🏼",
+                                                               "🕺🏽",
+                                                               "🕺🏾",
+                                                               "🕺🏿",
+                                                               "🕴️",
+                                                               "🕴🏻",
+                                                               "🕴🏼",
+                                                               "🕴🏽",
+                                                               "🕴🏾",
+                                                               "🕴🏿",
+                                                               "👯",
+                                                               "👯‍♂️",
+                                                               "👯‍♀️",
+                                                               "🧖",
+                                                               "🧖🏻",
+                                                               "🧖🏼",
+                                                               "🧖🏽",
+                                                               "🧖🏾",
+                                                               "🧖🏿",
+                                                               "🧖‍♂️",
+                                                               "🧖🏻‍♂️",
+                                                               "🧖🏼‍♂️",
+                                                               "🧖🏽‍♂️",
+                                                               "🧖🏾‍♂️",
+                                                               "🧖🏿‍♂️",
+                                                               "🧖‍♀️",
+                                                               "🧖🏻‍♀️",
+                                                               "🧖🏼‍♀️",
+                                                               "🧖🏽‍♀️",
+                                                               "🧖🏾‍♀️",
+                                                               "🧖🏿‍♀️",
+                                                               "🧗",
+                                                               "🧗🏻",
+                                                               "🧗🏼",
+                                                               "🧗🏽",
+                                                               "🧗🏾",
+                                                               "🧗🏿",
+                                                               "🧗‍♂️",
+                                                               "🧗🏻‍♂️",
+                                                               "🧗🏼‍♂️",
+                                                               "🧗🏽‍♂️",
+                                                               "🧗🏾‍♂️",
+                                                               "🧗🏿‍♂️",
+                                                               "🧗‍♀️",
+                                                               "🧗🏻‍♀️",
+                                                               "🧗🏼‍♀️",
+                                                               "🧗🏽‍♀️",
+                                                               "🧗🏾‍♀️",
+                                                               "🧗🏿‍♀️",
+                                                               "🤺",
+                                                               "🏇",
+                                                               "🏇🏻",
+                                                               "🏇🏼",
+                                                               "🏇🏽",
+                                                               "🏇🏾",
+                                                               "🏇🏿",
+                                                               "⛷️",
+                                                               "🏂",
+                                                               "🏂🏻",
+                                                               "🏂🏼",
+                                                               "🏂🏽",
+                                                               "🏂🏾",
+                                                               "🏂🏿",
+                                                               "🏌️",
+                                                               "🏌🏻",
+                                                               "🏌🏼",
+                                                               "🏌🏽",
+                                                               "🏌🏾",
+                                                               "🏌🏿",
+                                                               "🏌️‍♂️",
+                                                               "🏌🏻‍♂️",
+                                                               "🏌🏼‍♂️",
+                                                               "🏌🏽‍♂️",
+                                                               "🏌🏾‍♂️",
+                                                               "🏌🏿‍♂️",
+                                                               "🏌️‍♀️",
+                                                               "🏌🏻‍♀️",
+                                                               "🏌🏼‍♀️",
+                                                               "🏌🏽‍♀️",
+                                                               "🏌🏾‍♀️",
+                                                               "🏌🏿‍♀️",
+                                                               "🏄",
+                                                               "🏄🏻",
+                                                               "🏄🏼",
+                                                               "🏄🏽",
+                                                               "🏄🏾",
+                                                               "🏄🏿",
+                                                               "🏄‍♂️",
+                                                               "🏄🏻‍♂️",
+                                                               "🏄🏼‍♂️",
+                                                               "🏄🏽‍♂️",
+                                                               "🏄🏾‍♂️",
+                                                               "🏄🏿‍♂️",
+                                                               "🏄‍♀️",
+                                                               "🏄🏻‍♀️",
+                                                               "🏄🏼‍♀️",
+                                                               "🏄🏽‍♀️",
+                                                               "🏄🏾‍♀️",
+                                                               "🏄🏿‍♀️",
+                                                               "🚣",
+                                                               "🚣🏻",
+                                                               "🚣🏼",
+                                                               "🚣🏽",
+                                                               "🚣🏾",
+                                                               "🚣🏿",
+                                                               "🚣‍♂️",
+                                                               "🚣🏻‍♂️",
+                                                               "🚣🏼‍♂️",
+                                                               "🚣🏽‍♂️",
+                                                               "🚣🏾‍♂️",
+                                                               "🚣🏿‍♂️",
+                                                               "🚣‍♀️",
+                                                               "🚣🏻‍♀️",
+                                                               "🚣🏼‍♀️",
+                                                               "🚣🏽‍♀️",
+                                                               "🚣🏾‍♀️",
+                                                               "🚣🏿‍♀️",
+                                                               "🏊",
+                                                               "🏊🏻",
+                                                               "🏊🏼",
+                                                               "🏊🏽",
+                                                               "🏊🏾",
+                                                               "🏊🏿",
+                                                               "🏊‍♂️",
+                                                               "🏊🏻‍♂️",
+                                                               "🏊🏼‍♂️",
+                                                               "🏊🏽‍♂️",
+                                                               "🏊🏾‍♂️",
+                                                               "🏊🏿‍♂️",
+                                                               "🏊‍♀️",
+                                                               "🏊🏻‍♀️",
+                                                               "🏊🏼‍♀️",
+                                                               "🏊🏽‍♀️",
+                                                               "🏊🏾‍♀️",
+                                                               "🏊🏿‍♀️",
+                                                               "⛹️",
+                                                               "⛹🏻",
+                                                               "⛹🏼",
+                                                               "⛹🏽",
+                                                               "⛹🏾",
+                                                               "⛹🏿",
+                                                               "⛹️‍♂️",
+                                                               "⛹🏻‍♂️",
+                                                               "⛹🏼‍♂️",
+                                                               "⛹🏽‍♂️",
+                                                               "⛹🏾‍♂️",
+                                                               "⛹🏿‍♂️",
+                                                               "⛹️‍♀️",
+                                                               "⛹🏻‍♀️",
+                                                               "⛹🏼‍♀️",
+                                                               "⛹🏽‍♀️",
+                                                               "⛹🏾‍♀️",
+                                                               "⛹🏿‍♀️",
+                                                               "🏋️",
+                                                               "🏋🏻",
+                                                               "🏋🏼",
+                                                               "🏋🏽",
+                                                               "🏋🏾",
+                                                               "🏋🏿",
+                                                               "🏋️‍♂️",
+                                                               "🏋🏻‍♂️",
+                                                               "🏋🏼‍♂️",
+                                                               "🏋🏽‍♂️",
+                                                               "🏋🏾‍♂️",
+                                                               "🏋🏿‍♂️",
+                                                               "🏋️‍♀️",
+                                                               "🏋🏻‍♀️",
+                                                               "🏋🏼‍♀️",
+                                                               "🏋🏽‍♀️",
+                                                               "🏋🏾‍♀️",
+                                                               "🏋🏿‍♀️",
+                                                               "🚴",
+                                                               "🚴🏻",
+                                                               "🚴🏼",
+                                                               "🚴🏽",
+                                                               "🚴🏾",
+                                                               "🚴🏿",
+                                                               "🚴‍♂️",
+                                                               "🚴🏻‍♂️",
+                                                               "🚴🏼‍♂️",
+                                                               "🚴🏽‍♂️",
+                                                               "🚴🏾‍♂️",
+                                                               "🚴🏿‍♂️",
+                                                               "🚴‍♀️",
+                                                               "🚴🏻‍♀️",
+                                                               "🚴🏼‍♀️",
+                                                               "🚴🏽‍♀️",
+                                                               "🚴🏾‍♀️",
+                                                               "🚴🏿‍♀️",
+                                                               "🚵",
+                                                               "🚵🏻",
+                                                               "🚵🏼",
+                                                               "🚵🏽",
+                                                               "🚵🏾",
+                                                               "🚵🏿",
+                                                               "🚵‍♂️",
+                                                               "🚵🏻‍♂️",
+                                                               "🚵🏼‍♂️",
+                                                               "🚵🏽‍♂️",
+                                                               "🚵🏾‍♂️",
+                                                               "🚵🏿‍♂️",
+                                                               "🚵‍♀️",
+                                                               "🚵🏻‍♀️",
+                                                               "🚵🏼‍♀️",
+                                                               "🚵🏽‍♀️",
+                                                               "🚵🏾‍♀️",
+                                                               "🚵🏿‍♀️",
+                                                               "🤸",
+                                                               "🤸🏻",
+                                                               "🤸🏼",
+                                                               "🤸🏽",
+                                                               "🤸🏾",
+                                                               "🤸🏿",
+                                                               "🤸‍♂️",
+                                                               "🤸🏻‍♂️",
+                                                               "🤸🏼‍♂️",
+                                                               "🤸🏽‍♂️",
+                                                               "🤸🏾‍♂️",
+                                                               "🤸🏿‍♂️",
+                                                               "🤸‍♀️",
+                                                               "🤸🏻‍♀️",
+                                                               "🤸🏼‍♀️",
+                                                               "🤸🏽‍♀️",
+                                                               "🤸🏾‍♀️",
+                                                               "🤸🏿‍♀️",
+                                                               "🤼",
+                                                               "🤼‍♂️",
+                                                               "🤼‍♀️",
+                                                               "🤽",
+                                                               "🤽🏻",
+                                                               "🤽🏼",
+                                                               "🤽🏽",
+                                                               "🤽🏾",
+                                                               "🤽🏿",
+                                                               "🤽‍♂️",
+                                                               "🤽🏻‍♂️",
+                                                               "🤽🏼‍♂️",
+                                                               "🤽🏽‍♂️",
+                                                               "🤽🏾‍♂️",
+                                                               "🤽🏿‍♂️",
+                                                               "🤽‍♀️",
+                                                               "🤽🏻‍♀️",
+                                                               "🤽🏼‍♀️",
+                                                               "🤽🏽‍♀️",
+                                                               "🤽🏾‍♀️",
+                                                               "🤽🏿‍♀️",
+                                                               "🤾",
+                                                               "🤾🏻",
+                                                               "🤾🏼",
+                                                               "🤾🏽",
+                                                               "🤾🏾",
+                                                               "🤾🏿",
+                                                               "🤾‍♂️",
+                                                               "🤾🏻‍♂️",
+                                                               "🤾🏼‍♂️",
+                                                               "🤾🏽‍♂️",
+                                                               "🤾🏾‍♂️",
+                                                               "🤾🏿‍♂️",
+                                                               "🤾‍♀️",
+                                                               "🤾🏻‍♀️",
+                                                               "🤾🏼‍♀️",
+                                                               "🤾🏽‍♀️",
+                                                               "🤾🏾‍♀️",
+                                                               "🤾🏿‍♀️",
+                                                               "🤹",
+                                                               "🤹🏻",
+                                                               "🤹🏼",
+                                                               "🤹🏽",
+                                                               "🤹🏾",
+                                                               "🤹🏿",
+                                                               "🤹‍♂️",
+                                                               "🤹🏻‍♂️",
+                                                               "🤹🏼‍♂️",
+                                                               "🤹🏽‍♂️",
+                                                               "🤹🏾‍♂️",
+                                                               "🤹🏿‍♂️",
+                                                               "🤹‍♀️",
+                                                               "🤹🏻‍♀️",
+                                                               "🤹🏼‍♀️",
+                                                               "🤹🏽‍♀️",
+                                                               "🤹🏾‍♀️",
+                                                               "🤹🏿‍♀️",
+                                                               "🧘",
+                                                               "🧘🏻",
+                                                               "🧘🏼",
+                                                               "🧘🏽",
+                                                               "🧘🏾",
+                                                               "🧘🏿",
+                                                               "🧘‍♂️",
+                                                               "🧘🏻‍♂️",
+                                                               "🧘🏼‍♂️",
+                                                               "🧘🏽‍♂️",
+                                                               "🧘🏾‍♂️",
+                                                               "🧘🏿‍♂️",
+                                                               "🧘‍♀️",
+                                                               "🧘🏻‍♀️",
+                                                               "🧘🏼‍♀️",
+                                                               "🧘🏽‍♀️",
+                                                               "🧘🏾‍♀️",
+                                                               "🧘🏿‍♀️",
+                                                               "🛀",
+                                                               "🛀🏻",
+                                                               "🛀🏼",
+                                                               "🛀🏽",
+                                                               "🛀🏾",
+                                                               "🛀🏿",
+                                                               "🛌",
+                                                               "🛌🏻",
+                                                               "🛌🏼",
+                                                               "🛌🏽",
+                                                               "🛌🏾",
+                                                               "🛌🏿",
+                                                               "🧑‍🤝‍🧑",
+                                                               "🧑🏻‍🤝‍🧑🏻",
+                                                               "🧑🏻‍🤝‍🧑🏼",
+                                                               "🧑🏻‍🤝‍🧑🏽",
+                                                               "🧑🏻‍🤝‍🧑🏾",
+                                                               "🧑🏻‍🤝‍🧑🏿",
+                                                               "🧑🏼‍🤝‍🧑🏻",
+                                                               "🧑🏼‍🤝‍🧑🏼",
+                                                               "🧑🏼‍🤝‍🧑🏽",
+                                                               "🧑🏼‍🤝‍🧑🏾",
+                                                               "🧑🏼‍🤝‍🧑🏿",
+                                                               "🧑🏽‍🤝‍🧑🏻",
+                                                               "🧑🏽‍🤝‍🧑🏼",
+                                                               "🧑🏽‍🤝‍🧑🏽",
+                                                               "🧑🏽‍🤝‍🧑🏾",
+                                                               "🧑🏽‍🤝‍🧑🏿",
+                                                               "🧑🏾‍🤝‍🧑🏻",
+                                                               "🧑🏾‍🤝‍🧑🏼",
+                                                               "🧑🏾‍🤝‍🧑🏽",
+                                                               "🧑🏾‍🤝‍🧑🏾",
+                                                               "🧑🏾‍🤝‍🧑🏿",
+                                                               "🧑🏿‍🤝‍🧑🏻",
+                                                               "🧑🏿‍🤝‍🧑🏼",
+                                                               "🧑🏿‍🤝‍🧑🏽",
+                                                               "🧑🏿‍🤝‍🧑🏾",
+                                                               "🧑🏿‍🤝‍🧑🏿",
+                                                               "👭",
+                                                               "👭🏻",
+                                                               "👩🏻‍🤝‍👩🏼",
+                                                               "👩🏻‍🤝‍👩🏽",
+                                                               "👩🏻‍🤝‍👩🏾",
+                                                               "👩🏻‍🤝‍👩🏿",
+                                                               "👩🏼‍🤝‍👩🏻",
+                                                               "👭🏼",
+                                                               "👩🏼‍🤝‍👩🏽",
+                                                               "👩🏼‍🤝‍👩🏾",
+                                                               "👩🏼‍🤝‍👩🏿",
+                                                               "👩🏽‍🤝‍👩🏻",
+                                                               "👩🏽‍🤝‍👩🏼",
+                                                               "👭🏽",
+                                                               "👩🏽‍🤝‍👩🏾",
+                                                               "👩🏽‍🤝‍👩🏿",
+                                                               "👩🏾‍🤝‍👩🏻",
+                                                               "👩🏾‍🤝‍👩🏼",
+                                                               "👩🏾‍🤝‍👩🏽",
+                                                               "👭🏾",
+                                                               "👩🏾‍🤝‍👩🏿",
+                                                               "👩🏿‍🤝‍👩🏻",
+                                                               "👩🏿‍🤝‍👩🏼",
+                                                               "👩🏿‍🤝‍👩🏽",
+                                                               "👩🏿‍🤝‍👩🏾",
+                                                               "👭🏿",
+                                                               "👫",
+                                                               "👫🏻",
+                                                               "👩🏻‍🤝‍👨🏼",
+                                                               "👩🏻‍🤝‍👨🏽",
+                                                               "👩🏻‍🤝‍👨🏾",
+                                                               "👩🏻‍🤝‍👨🏿",
+                                                               "👩🏼‍🤝‍👨🏻",
+                                                               "👫🏼",
+                                                               "👩🏼‍🤝‍👨🏽",
+                                                               "👩🏼‍🤝‍👨🏾",
+                                                               "👩🏼‍🤝‍👨🏿",
+                                                               "👩🏽‍🤝‍👨🏻",
+                                                               "👩🏽‍🤝‍👨🏼",
+                                                               "👫🏽",
+                                                               "👩🏽‍🤝‍👨🏾",
+                                                               "👩🏽‍🤝‍👨🏿",
+                                                               "👩🏾‍🤝‍👨🏻",
+                                                               "👩🏾‍🤝‍👨🏼",
+                                                               "👩🏾‍🤝‍👨🏽",
+                                                               "👫🏾",
+                                                               "👩🏾‍🤝‍👨🏿",
+                                                               "👩🏿‍🤝‍👨🏻",
+                                                               "👩🏿‍🤝‍👨🏼",
+                                                               "👩🏿‍🤝‍👨🏽",
+                                                               "👩🏿‍🤝‍👨🏾",
+                                                               "👫🏿",
+                                                               "👬",
+                                                               "👬🏻",
+                                                               "👨🏻‍🤝‍👨🏼",
+                                                               "👨🏻‍🤝‍👨🏽",
+                                                               "👨🏻‍🤝‍👨🏾",
+                                                               "👨🏻‍🤝‍👨🏿",
+                                                               "👨🏼‍🤝‍👨🏻",
+                                                               "👬🏼",
+                                                               "👨🏼‍🤝‍👨🏽",
+                                                               "👨🏼‍🤝‍👨🏾",
+                                                               "👨🏼‍🤝‍👨🏿",
+                                                               "👨🏽‍🤝‍👨🏻",
+                                                               "👨🏽‍🤝‍👨🏼",
+                                                               "👬🏽",
+                                                               "👨🏽‍🤝‍👨🏾",
+                                                               "👨🏽‍🤝‍👨🏿",
+                                                               "👨🏾‍🤝‍👨🏻",
+                                                               "👨🏾‍🤝‍👨🏼",
+                                                               "👨🏾‍🤝‍👨🏽",
+                                                               "👬🏾",
+                                                               "👨🏾‍🤝‍👨🏿",
+                                                               "👨🏿‍🤝‍👨🏻",
+                                                               "👨🏿‍🤝‍👨🏼",
+                                                               "👨🏿‍🤝‍👨🏽",
+                                                               "👨🏿‍🤝‍👨🏾",
+                                                               "👬🏿",
+                                                               "💏",
+                                                               "💏🏻",
+                                                               "💏🏼",
+                                                               "💏🏽",
+                                                               "💏🏾",
+                                                               "💏🏿",
+                                                               "🧑🏻‍❤️‍💋‍🧑🏼",
+                                                               "🧑🏻‍❤️‍💋‍🧑🏽",
+                                                               "🧑🏻‍❤️‍💋‍🧑🏾",
+                                                               "🧑🏻‍❤️‍💋‍🧑🏿",
+                                                               "🧑🏼‍❤️‍💋‍🧑🏻",
+                                                               "🧑🏼‍❤️‍💋‍🧑🏽",
+                                                               "🧑🏼‍❤️‍💋‍🧑🏾",
+                                                               "🧑🏼‍❤️‍💋‍🧑🏿",
+                                                               "🧑🏽‍❤️‍💋‍🧑🏻",
+                                                               "🧑🏽‍❤️‍💋‍🧑🏼",
+                                                               "🧑🏽‍❤️‍💋‍🧑🏾",
+                                                               "🧑🏽‍❤️‍💋‍🧑🏿",
+                                                               "🧑🏾‍❤️‍💋‍🧑🏻",
+                                                               "🧑🏾‍❤️‍💋‍🧑🏼",
+                                                               "🧑🏾‍❤️‍💋‍🧑🏽",
+                                                               "🧑🏾‍❤️‍💋‍🧑🏿",
+                                                               "🧑🏿‍❤️‍💋‍🧑🏻",
+                                                               "🧑🏿‍❤️‍💋‍🧑🏼",
+                                                               "🧑🏿‍❤️‍💋‍🧑🏽",
+                                                               "🧑🏿‍❤️‍💋‍🧑🏾",
+                                                               "👩‍❤️‍💋‍👨",
+                                                               "👩🏻‍❤️‍💋‍👨🏻",
+                                                               "👩🏻‍❤️‍💋‍👨🏼",
+                                                               "👩🏻‍❤️‍💋‍👨🏽",
+                                                               "👩🏻‍❤️‍💋‍👨🏾",
+                                                               "👩🏻‍❤️‍💋‍👨🏿",
+                                                               "👩🏼‍❤️‍💋‍👨🏻",
+                                                               "👩🏼‍❤️‍💋‍👨🏼",
+                                                               "👩🏼‍❤️‍💋‍👨🏽",
+                                                               "👩🏼‍❤️‍💋‍👨🏾",
+                                                               "👩🏼‍❤️‍💋‍👨🏿",
+                                                               "👩🏽‍❤️‍💋‍👨🏻",
+                                                               "👩🏽‍❤️‍💋‍👨🏼",
+                                                               "👩🏽‍❤️‍💋‍👨🏽",
+                                                               "👩🏽‍❤️‍💋‍👨🏾",
+                                                               "👩🏽‍❤️‍💋‍👨🏿",
+                                                               "👩🏾‍❤️‍💋‍👨🏻",
+                                                               "👩🏾‍❤️‍💋‍👨🏼",
+                                                               "👩🏾‍❤️‍💋‍👨🏽",
+                                                               "👩🏾‍❤️‍💋‍👨🏾",
+                                                               "👩🏾‍❤️‍💋‍👨🏿",
+                                                               "👩🏿‍❤️‍💋‍👨🏻",
+                                                               "👩🏿‍❤️‍💋‍👨🏼",
+                                                               "👩🏿‍❤️‍💋‍👨🏽",
+                                                               "👩🏿‍❤️‍💋‍👨🏾",
+                                                               "👩🏿‍❤️‍💋‍👨🏿",
+                                                               "👨‍❤️‍💋‍👨",
+                                                               "👨🏻‍❤️‍💋‍👨🏻",
+                                                               "👨🏻‍❤️‍💋‍👨🏼",
+                                                               "👨🏻‍❤️‍💋‍👨🏽",
+                                                               "👨🏻‍❤️‍💋‍👨🏾",
+                                                               "👨🏻‍❤️‍💋‍👨🏿",
+                                                               "👨🏼‍❤️‍💋‍👨🏻",
+                                                               "👨🏼‍❤️‍💋‍👨🏼",
+                                                               "👨🏼‍❤️‍💋‍👨🏽",
+                                                               "👨🏼‍❤️‍💋‍👨🏾",
+                                                               "👨🏼‍❤️‍💋‍👨🏿",
+                                                               "👨🏽‍❤️‍💋‍👨🏻",
+                                                               "👨🏽‍❤️‍💋‍👨🏼",
+                                                               "👨🏽‍❤️‍💋‍👨🏽",
+                                                               "👨🏽‍❤️‍💋‍👨🏾",
+                                                               "👨🏽‍❤️‍💋‍👨🏿",
+                                                               "👨🏾‍❤️‍💋‍👨🏻",
+                                                               "👨🏾‍❤️‍💋‍👨🏼",
+                                                               "👨🏾‍❤️‍💋‍👨🏽",
+                                                               "👨🏾‍❤️‍💋‍👨🏾",
+                                                               "👨🏾‍❤️‍💋‍👨🏿",
+                                                               "👨🏿‍❤️‍💋‍👨🏻",
+                                                               "👨🏿‍❤️‍💋‍👨🏼",
+                                                               "👨🏿‍❤️‍💋‍👨🏽",
+                                                               "👨🏿‍❤️‍💋‍👨🏾",
+                                                               "👨🏿‍❤️‍💋‍👨🏿",
+                                                               "👩‍❤️‍💋‍👩",
+                                                               "👩🏻‍❤️‍💋‍👩🏻",
+                                                               "👩🏻‍❤️‍💋‍👩🏼",
+                                                               "👩🏻‍❤️‍💋‍👩🏽",
+                                                               "👩🏻‍❤️‍💋‍👩🏾",
+                                                               "👩🏻‍❤️‍💋‍👩🏿",
+                                                               "👩🏼‍❤️‍💋‍👩🏻",
+                                                               "👩🏼‍❤️‍💋‍👩🏼",
+                                                               "👩🏼‍❤️‍💋‍👩🏽",
+                                                               "👩🏼‍❤️‍💋‍👩🏾",
+                                                               "👩🏼‍❤️‍💋‍👩🏿",
+                                                               "👩🏽‍❤️‍💋‍👩🏻",
+                                                               "👩🏽‍❤️‍💋‍👩🏼",
+                                                               "👩🏽‍❤️‍💋‍👩🏽",
+                                                               "👩🏽‍❤️‍💋‍👩🏾",
+                                                               "👩🏽‍❤️‍💋‍👩🏿",
+                                                               "👩🏾‍❤️‍💋‍👩🏻",
+                                                               "👩🏾‍❤️‍💋‍👩🏼",
+                                                               "👩🏾‍❤️‍💋‍👩🏽",
+                                                               "👩🏾‍❤️‍💋‍👩🏾",
+                                                               "👩🏾‍❤️‍💋‍👩🏿",
+                                                               "👩🏿‍❤️‍💋‍👩🏻",
+                                                               "👩🏿‍❤️‍💋‍👩🏼",
+                                                               "👩🏿‍❤️‍💋‍👩🏽",
+                                                               "👩🏿‍❤️‍💋‍👩🏾",
+                                                               "👩🏿‍❤️‍💋‍👩🏿",
+                                                               "💑",
+                                                               "💑🏻",
+                                                               "💑🏼",
+                                                               "💑🏽",
+                                                               "💑🏾",
+                                                               "💑🏿",
+                                                               "🧑🏻‍❤️‍🧑🏼",
+                                                               "🧑🏻‍❤️‍🧑🏽",
+                                                               "🧑🏻‍❤️‍🧑🏾",
+                                                               "🧑🏻‍❤️‍🧑🏿",
+                                                               "🧑🏼‍❤️‍🧑🏻",
+                                                               "🧑🏼‍❤️‍🧑🏽",
+                                                               "🧑🏼‍❤️‍🧑🏾",
+                                                               "🧑🏼‍❤️‍🧑🏿",
+                                                               "🧑🏽‍❤️‍🧑🏻",
+                                                               "🧑🏽‍❤️‍🧑🏼",
+                                                               "🧑🏽‍❤️‍🧑🏾",
+                                                               "🧑🏽‍❤️‍🧑🏿",
+                                                               "🧑🏾‍❤️‍🧑🏻",
+                                                               "🧑🏾‍❤️‍🧑🏼",
+                                                               "🧑🏾‍❤️‍🧑🏽",
+                                                               "🧑🏾‍❤️‍🧑🏿",
+                                                               "🧑🏿‍❤️‍🧑🏻",
+                                                               "🧑🏿‍❤️‍🧑🏼",
+                                                               "🧑🏿‍❤️‍🧑🏽",
+                                                               "🧑🏿‍❤️‍🧑🏾",
+                                                               "👩‍❤️‍👨",
+                                                               "👩🏻‍❤️‍👨🏻",
+                                                               "👩🏻‍❤️‍👨🏼",
+                                                               "👩🏻‍❤️‍👨🏽",
+                                                               "👩🏻‍❤️‍👨🏾",
+                                                               "👩🏻‍❤️‍👨🏿",
+                                                               "👩🏼‍❤️‍👨🏻",
+                                                               "👩🏼‍❤️‍👨🏼",
+                                                               "👩🏼‍❤️‍👨🏽",
+                                                               "👩🏼‍❤️‍👨🏾",
+                                                               "👩🏼‍❤️‍👨🏿",
+                                                               "👩🏽‍❤️‍👨🏻",
+                                                               "👩🏽‍❤️‍👨🏼",
+                                                               "👩🏽‍❤️‍👨🏽",
+                                                               "👩🏽‍❤️‍👨🏾",
+                                                               "👩🏽‍❤️‍👨🏿",
+                                                               "👩🏾‍❤️‍👨🏻",
+                                                               "👩🏾‍❤️‍👨🏼",
+                                                               "👩🏾‍❤️‍👨🏽",
+                                                               "👩🏾‍❤️‍👨🏾",
+                                                               "👩🏾‍❤️‍👨🏿",
+                                                               "👩🏿‍❤️‍👨🏻",
+                                                               "👩🏿‍❤️‍👨🏼",
+                                                               "👩🏿‍❤️‍👨🏽",
+                                                               "👩🏿‍❤️‍👨🏾",
+                                                               "👩🏿‍❤️‍👨🏿",
+                                                               "👨‍❤️‍👨",
+                                                               "👨🏻‍❤️‍👨🏻",
+                                                               "👨🏻‍❤️‍👨🏼",
+                                                               "👨🏻‍❤️‍👨🏽",
+                                                               "👨🏻‍❤️‍👨🏾",
+                                                               "👨🏻‍❤️‍👨🏿",
+                                                               "👨🏼‍❤️‍👨🏻",
+                                                               "👨🏼‍❤️‍👨🏼",
+                                                               "👨🏼‍❤️‍👨🏽",
+                                                               "👨🏼‍❤️‍👨🏾",
+                                                               "👨🏼‍❤️‍👨🏿",
+                                                               "👨🏽‍❤️‍👨🏻",
+                                                               "👨🏽‍❤️‍👨🏼",
+                                                               "👨🏽‍❤️‍👨🏽",
+                                                               "👨🏽‍❤️‍👨🏾",
+                                                               "👨🏽‍❤️‍👨🏿",
+                                                               "👨🏾‍❤️‍👨🏻",
+                                                               "👨🏾‍❤️‍👨🏼",
+                                                               "👨🏾‍❤️‍👨🏽",
+                                                               "👨🏾‍❤️‍👨🏾",
+                                                               "👨🏾‍❤️‍👨🏿",
+                                                               "👨🏿‍❤️‍👨🏻",
+                                                               "👨🏿‍❤️‍👨🏼",
+                                                               "👨🏿‍❤️‍👨🏽",
+                                                               "👨🏿‍❤️‍👨🏾",
+                                                               "👨🏿‍❤️‍👨🏿",
+                                                               "👩‍❤️‍👩",
+                                                               "👩🏻‍❤️‍👩🏻",
+                                                               "👩🏻‍❤️‍👩🏼",
+                                                               "👩🏻‍❤️‍👩🏽",
+                                                               "👩🏻‍❤️‍👩🏾",
+                                                               "👩🏻‍❤️‍👩🏿",
+                                                               "👩🏼‍❤️‍👩🏻",
+                                                               "👩🏼‍❤️‍👩🏼",
+                                                               "👩🏼‍❤️‍👩🏽",
+                                                               "👩🏼‍❤️‍👩🏾",
+                                                               "👩🏼‍❤️‍👩🏿",
+                                                               "👩🏽‍❤️‍👩🏻",
+                                                               "👩🏽‍❤️‍👩🏼",
+                                                               "👩🏽‍❤️‍👩🏽",
+                                                               "👩🏽‍❤️‍👩🏾",
+                                                               "👩🏽‍❤️‍👩🏿",
+                                                               "👩🏾‍❤️‍👩🏻",
+                                                               "👩🏾‍❤️‍👩🏼",
+                                                               "👩🏾‍❤️‍👩🏽",
+                                                               "👩🏾‍❤️‍👩🏾",
+                                                               "👩🏾‍❤️‍👩🏿",
+                                                               "👩🏿‍❤️‍👩🏻",
+                                                               "👩🏿‍❤️‍👩🏼",
+                                                               "👩🏿‍❤️‍👩🏽",
+                                                               "👩🏿‍❤️‍👩🏾",
+                                                               "👩🏿‍❤️‍👩🏿",
+                                                               "👪",
+                                                               "👨‍👩‍👦",
+                                                               "👨‍👩‍👧",
+                                                               "👨‍👩‍👧‍👦",
+                                                               "👨‍👩‍👦‍👦",
+                                                               "👨‍👩‍👧‍👧",
+                                                               "👨‍👨‍👦",
+                                                               "👨‍👨‍👧",
+                                                               "👨‍👨‍👧‍👦",
+                                                               "👨‍👨‍👦‍👦",
+                                                               "👨‍👨‍👧‍👧",
+                                                               "👩‍👩‍👦",
+                                                               "👩‍👩‍👧",
+                                                               "👩‍👩‍👧‍👦",
+                                                               "👩‍👩‍👦‍👦",
+                                                               "👩‍👩‍👧‍👧",
+                                                               "👨‍👦",
+                                                               "👨‍👦‍👦",
+                                                               "👨‍👧",
+                                                               "👨‍👧‍👦",
+                                                               "👨‍👧‍👧",
+                                                               "👩‍👦",
+                                                               "👩‍👦‍👦",
+                                                               "👩‍👧",
+                                                               "👩‍👧‍👦",
+                                                               "👩‍👧‍👧",
+                                                               "🗣️",
+                                                               "👤",
+                                                               "👥",
+                                                               "🫂",
+                                                               "👣"});
 
-const std::vector<std::string> natureEmojis = {
+inline constexpr auto natureEmojis = std::to_array<std::string_view>({
     "🐵",       "🐒",    "🦍",    "🦧", "🐶",    "🐕",    "🦮",       "🐕‍🦺",
     "🐩",       "🐺",    "🦊",    "🦝", "🐱",    "🐈",    "🐈‍⬛", "🦁",
     "🐯",       "🐅",    "🐆",       "🐴",    "🐎",    "🦄", "🦓",       "🦌",
@@ -2018,9 +2018,9 @@ const std::vector<std::string> natureEmojis = {
     "🦂",    "🦟", "🪰",    "🪱", "🦠", "💐",    "🌸",          "💮",
     "🏵️", "🌹",    "🥀",    "🌺",    "🌻",    "🌼",    "🌷",          "🌱",
     "🪴",    "🌲",    "🌳",       "🌴",    "🌵",    "🌾",    "🌿",          "☘️",
-    "🍀",       "🍁",    "🍂",       "🍃"};
+    "🍀",       "🍁",    "🍂",       "🍃"});
 
-const std::vector<std::string> foodEmojis = {
+inline constexpr auto foodEmojis = std::to_array<std::string_view>({
     "🍇",    "🍈",    "🍉",    "🍊",    "🍋",    "🍌",    "🍍",    "🥭",    "🍎",    "🍏",    "🍐",    "🍑",       "🍒",
     "🍓",    "🫐", "🥝", "🍅",    "🫒", "🥥", "🥑", "🍆",       "🥔", "🥕", "🌽",    "🌶️", "🫑",
     "🥒", "🥬", "🥦", "🧄", "🧅", "🍄",    "🥜", "🌰",       "🍞",    "🥐", "🥖", "🫓",    "🥨",
@@ -2030,9 +2030,9 @@ const std::vector<std::string> foodEmojis = {
     "🍤",    "🍥",    "🥮", "🍡",    "🥟", "🥠", "🥡", "🦀",    "🦞", "🦐", "🦑", "🦪",    "🍦",
     "🍧",    "🍨",    "🍩",    "🍪",    "🎂",    "🍰",    "🧁", "🥧",    "🍫",    "🍬",    "🍭",    "🍮",       "🍯",
     "🍼",    "🥛", "☕",    "🫖", "🍵",    "🍶",    "🍾", "🍷",       "🍸",    "🍹",    "🍺",    "🍻",       "🥂",
-    "🥃", "🥤", "🧋", "🧃", "🧉", "🧊", "🥢", "🍽️", "🍴",    "🥄", "🔪",    "🏺"};
+    "🥃", "🥤", "🧋", "🧃", "🧉", "🧊", "🥢", "🍽️", "🍴",    "🥄", "🔪",    "🏺"});
 
-const std::vector<std::string> travelEmojis = {
+inline constexpr auto travelEmojis = std::to_array<std::string_view>({
     "🌍",       "🌎",       "🌏",       "🌐",       "🗺️", "🗾",       "🧭",    "🏔️", "⛰️",  "🌋",
     "🗻",       "🏕️", "🏖️", "🏜️", "🏝️", "🏞️", "🏟️", "🏛️", "🏗️", "🧱",
     "🪨",    "🪵",    "🛖",    "🏘️", "🏚️", "🏠",       "🏡",       "🏢",       "🏣",       "🏤",
@@ -2054,18 +2054,18 @@ const std::vector<std::string> travelEmojis = {
     "🌡️", "☀️",  "🌝",       "🌞",       "🪐",    "⭐",       "🌟",       "🌠",       "🌌",       "☁️",
     "⛅",       "⛈️",  "🌤️", "🌥️", "🌦️", "🌧️", "🌨️", "🌩️", "🌪️", "🌫️",
     "🌬️", "🌀",       "🌈",       "🌂",       "☂️",  "☔",       "⛱️",  "⚡",       "❄️",  "☃️",
-    "⛄",       "☄️",  "🔥",       "💧",       "🌊"};
+    "⛄",       "☄️",  "🔥",       "💧",       "🌊"});
 
-const std::vector<std::string> activityEmojis = {
+inline constexpr auto activityEmojis = std::to_array<std::string_view>({
     "🎃",      "🎄",      "🎆",       "🎇",    "🧨", "✨",    "🎈",       "🎉",       "🎊",    "🎋",       "🎍",      "🎎",
     "🎏",      "🎐",      "🎑",       "🧧", "🎀",    "🎁",    "🎗️", "🎟️", "🎫",    "🎖️", "🏆",      "🏅",
     "🥇",   "🥈",   "🥉",    "⚽",    "⚾",    "🥎", "🏀",       "🏐",    "🏈",    "🏉",       "🎾",      "🥏",
     "🎳",      "🏏",   "🏑",    "🏒", "🥍", "🏓", "🏸",    "🥊",    "🥋", "🥅",    "⛳",      "⛸️",
     "🎣",      "🤿",   "🎽",       "🎿",    "🛷", "🥌", "🎯",       "🪀",    "🪁", "🎱",       "🔮",      "🪄",
     "🧿",   "🎮",      "🕹️", "🎰",    "🎲",    "🧩", "🧸",    "🪅",    "🪆", "♠️",  "♥️", "♦️",
-    "♣️", "♟️", "🃏",       "🀄",    "🎴",    "🎭",    "🖼️", "🎨",       "🧵", "🪡",    "🧶",   "🪢"};
+    "♣️", "♟️", "🃏",       "🀄",    "🎴",    "🎭",    "🖼️", "🎨",       "🧵", "🪡",    "🧶",   "🪢"});
 
-const std::vector<std::string> objectEmojis = {
+inline constexpr auto objectEmojis = std::to_array<std::string_view>({
     "👓",       "🕶️", "🥽",    "🥼",    "🦺",    "👔",       "👕",       "👖",       "🧣",    "🧤",
     "🧥",    "🧦",    "👗",       "👘",       "🥻",    "🩱",    "🩲",    "🩳",    "👙",       "👚",
     "👛",       "👜",       "👝",       "🛍️", "🎒",       "🩴",    "👞",       "👟",       "🥾",    "🥿",
@@ -2090,9 +2090,9 @@ const std::vector<std::string> objectEmojis = {
     "🧫",    "🧬",    "🔬",       "🔭",       "📡",       "💉",       "🩸",    "💊",       "🩹",    "🩺",
     "🚪",       "🛗",    "🪞",    "🪟",    "🛏️", "🛋️", "🪑",    "🚽",       "🪠",    "🚿",
     "🛁",       "🪤",    "🪒",    "🧴",    "🧷",    "🧹",    "🧺",    "🧻",    "🪣",    "🧼",
-    "🪥",    "🧽",    "🧯",    "🛒",    "🚬",       "⚰️",  "🪦",    "⚱️",  "🗿",       "🪧"};
+    "🪥",    "🧽",    "🧯",    "🛒",    "🚬",       "⚰️",  "🪦",    "⚱️",  "🗿",       "🪧"});
 
-const std::vector<std::string> symbolEmojis = {
+inline constexpr auto symbolEmojis = std::to_array<std::string_view>({
     "🏧",       "🚮",       "🚰",       "♿",       "🚹",       "🚺",       "🚻",       "🚼",       "🚾",       "🛂",
     "🛃",       "🛄",       "🛅",       "⚠️",  "🚸",       "⛔",       "🚫",       "🚳",       "🚭",       "🚯",
     "🚱",       "🚷",       "📵",       "🔞",       "☢️",  "☣️",  "⬆️",  "↗️",  "➡️",  "↘️",
@@ -2114,272 +2114,272 @@ const std::vector<std::string> symbolEmojis = {
     "🈴",       "🈳",       "㊗️",  "㊙️",  "🈺",       "🈵",       "🔴",       "🟠",    "🟡",    "🟢",
     "🔵",       "🟣",    "🟤",    "⚫",       "⚪",       "🟥",    "🟧",    "🟨",    "🟩",    "🟦",
     "🟪",    "🟫",    "⬛",       "⬜",       "◼️",  "◻️",  "◾",       "◽",       "▪️",  "▫️",
-    "🔶",       "🔷",       "🔸",       "🔹",       "🔺",       "🔻",       "💠",       "🔘",       "🔳",       "🔲"};
+    "🔶",       "🔷",       "🔸",       "🔹",       "🔺",       "🔻",       "💠",       "🔘",       "🔳",       "🔲"});
 
-const std::vector<std::string> flagEmojis = {"🏁",
-                                             "🚩",
-                                             "🎌",
-                                             "🏴",
-                                             "🏳️",
-                                             "🏳️‍🌈",
-                                             "🏳️‍⚧️",
-                                             "🏴‍☠️",
-                                             "🇦🇨",
-                                             "🇦🇩",
-                                             "🇦🇪",
-                                             "🇦🇫",
-                                             "🇦🇬",
-                                             "🇦🇮",
-                                             "🇦🇱",
-                                             "🇦🇲",
-                                             "🇦🇴",
-                                             "🇦🇶",
-                                             "🇦🇷",
-                                             "🇦🇸",
-                                             "🇦🇹",
-                                             "🇦🇺",
-                                             "🇦🇼",
-                                             "🇦🇽",
-                                             "🇦🇿",
-                                             "🇧🇦",
-                                             "🇧🇧",
-                                             "🇧🇩",
-                                             "🇧🇪",
-                                             "🇧🇫",
-                                             "🇧🇬",
-                                             "🇧🇭",
-                                             "🇧🇮",
-                                             "🇧🇯",
-                                             "🇧🇱",
-                                             "🇧🇲",
-                                             "🇧🇳",
-                                             "🇧🇴",
-                                             "🇧🇶",
-                                             "🇧🇷",
-                                             "🇧🇸",
-                                             "🇧🇹",
-                                             "🇧🇻",
-                                             "🇧🇼",
-                                             "🇧🇾",
-                                             "🇧🇿",
-                                             "🇨🇦",
-                                             "🇨🇨",
-                                             "🇨🇩",
-                                             "🇨🇫",
-                                             "🇨🇬",
-                                             "🇨🇭",
-                                             "🇨🇮",
-                                             "🇨🇰",
-                                             "🇨🇱",
-                                             "🇨🇲",
-                                             "🇨🇳",
-                                             "🇨🇴",
-                                             "🇨🇵",
-                                             "🇨🇷",
-                                             "🇨🇺",
-                                             "🇨🇻",
-                                             "🇨🇼",
-                                             "🇨🇽",
-                                             "🇨🇾",
-                                             "🇨🇿",
-                                             "🇩🇪",
-                                             "🇩🇬",
-                                             "🇩🇯",
-                                             "🇩🇰",
-                                             "🇩🇲",
-                                             "🇩🇴",
-                                             "🇩🇿",
-                                             "🇪🇦",
-                                             "🇪🇨",
-                                             "🇪🇪",
-                                             "🇪🇬",
-                                             "🇪🇭",
-                                             "🇪🇷",
-                                             "🇪🇸",
-                                             "🇪🇹",
-                                             "🇪🇺",
-                                             "🇫🇮",
-                                             "🇫🇯",
-                                             "🇫🇰",
-                                             "🇫🇲",
-                                             "🇫🇴",
-                                             "🇫🇷",
-                                             "🇬🇦",
-                                             "🇬🇧",
-                                             "🇬🇩",
-                                             "🇬🇪",
-                                             "🇬🇫",
-                                             "🇬🇬",
-                                             "🇬🇭",
-                                             "🇬🇮",
-                                             "🇬🇱",
-                                             "🇬🇲",
-                                             "🇬🇳",
-                                             "🇬🇵",
-                                             "🇬🇶",
-                                             "🇬🇷",
-                                             "🇬🇸",
-                                             "🇬🇹",
-                                             "🇬🇺",
-                                             "🇬🇼",
-                                             "🇬🇾",
-                                             "🇭🇰",
-                                             "🇭🇲",
-                                             "🇭🇳",
-                                             "🇭🇷",
-                                             "🇭🇹",
-                                             "🇭🇺",
-                                             "🇮🇨",
-                                             "🇮🇩",
-                                             "🇮🇪",
-                                             "🇮🇱",
-                                             "🇮🇲",
-                                             "🇮🇳",
-                                             "🇮🇴",
-                                             "🇮🇶",
-                                             "🇮🇷",
-                                             "🇮🇸",
-                                             "🇮🇹",
-                                             "🇯🇪",
-                                             "🇯🇲",
-                                             "🇯🇴",
-                                             "🇯🇵",
-                                             "🇰🇪",
-                                             "🇰🇬",
-                                             "🇰🇭",
-                                             "🇰🇮",
-                                             "🇰🇲",
-                                             "🇰🇳",
-                                             "🇰🇵",
-                                             "🇰🇷",
-                                             "🇰🇼",
-                                             "🇰🇾",
-                                             "🇰🇿",
-                                             "🇱🇦",
-                                             "🇱🇧",
-                                             "🇱🇨",
-                                             "🇱🇮",
-                                             "🇱🇰",
-                                             "🇱🇷",
-                                             "🇱🇸",
-                                             "🇱🇹",
-                                             "🇱🇺",
-                                             "🇱🇻",
-                                             "🇱🇾",
-                                             "🇲🇦",
-                                             "🇲🇨",
-                                             "🇲🇩",
-                                             "🇲🇪",
-                                             "🇲🇫",
-                                             "🇲🇬",
-                                             "🇲🇭",
-                                             "🇲🇰",
-                                             "🇲🇱",
-                                             "🇲🇲",
-                                             "🇲🇳",
-                                             "🇲🇴",
-                                             "🇲🇵",
-                                             "🇲🇶",
-                                             "🇲🇷",
-                                             "🇲🇸",
-                                             "🇲🇹",
-                                             "🇲🇺",
-                                             "🇲🇻",
-                                             "🇲🇼",
-                                             "🇲🇽",
-                                             "🇲🇾",
-                                             "🇲🇿",
-                                             "🇳🇦",
-                                             "🇳🇨",
-                                             "🇳🇪",
-                                             "🇳🇫",
-                                             "🇳🇬",
-                                             "🇳🇮",
-                                             "🇳🇱",
-                                             "🇳🇴",
-                                             "🇳🇵",
-                                             "🇳🇷",
-                                             "🇳🇺",
-                                             "🇳🇿",
-                                             "🇴🇲",
-                                             "🇵🇦",
-                                             "🇵🇪",
-                                             "🇵🇫",
-                                             "🇵🇬",
-                                             "🇵🇭",
-                                             "🇵🇰",
-                                             "🇵🇱",
-                                             "🇵🇲",
-                                             "🇵🇳",
-                                             "🇵🇷",
-                                             "🇵🇸",
-                                             "🇵🇹",
-                                             "🇵🇼",
-                                             "🇵🇾",
-                                             "🇶🇦",
-                                             "🇷🇪",
-                                             "🇷🇴",
-                                             "🇷🇸",
-                                             "🇷🇺",
-                                             "🇷🇼",
-                                             "🇸🇦",
-                                             "🇸🇧",
-                                             "🇸🇨",
-                                             "🇸🇩",
-                                             "🇸🇪",
-                                             "🇸🇬",
-                                             "🇸🇭",
-                                             "🇸🇮",
-                                             "🇸🇯",
-                                             "🇸🇰",
-                                             "🇸🇱",
-                                             "🇸🇲",
-                                             "🇸🇳",
-                                             "🇸🇴",
-                                             "🇸🇷",
-                                             "🇸🇸",
-                                             "🇸🇹",
-                                             "🇸🇻",
-                                             "🇸🇽",
-                                             "🇸🇾",
-                                             "🇸🇿",
-                                             "🇹🇦",
-                                             "🇹🇨",
-                                             "🇹🇩",
-                                             "🇹🇫",
-                                             "🇹🇬",
-                                             "🇹🇭",
-                                             "🇹🇯",
-                                             "🇹🇰",
-                                             "🇹🇱",
-                                             "🇹🇲",
-                                             "🇹🇳",
-                                             "🇹🇴",
-                                             "🇹🇷",
-                                             "🇹🇹",
-                                             "🇹🇻",
-                                             "🇹🇼",
-                                             "🇹🇿",
-                                             "🇺🇦",
-                                             "🇺🇬",
-                                             "🇺🇲",
-                                             "🇺🇳",
-                                             "🇺🇸",
-                                             "🇺🇾",
-                                             "🇺🇿",
-                                             "🇻🇦",
-                                             "🇻🇨",
-                                             "🇻🇪",
-                                             "🇻🇬",
-                                             "🇻🇮",
-                                             "🇻🇳",
-                                             "🇻🇺",
-                                             "🇼🇫",
-                                             "🇼🇸",
-                                             "🇽🇰",
-                                             "🇾🇪",
-                                             "🇾🇹",
-                                             "🇿🇦",
-                                             "🇿🇲",
-                                             "🇿🇼"};
+inline constexpr auto flagEmojis = std::to_array<std::string_view>({"🏁",
+                                                             "🚩",
+                                                             "🎌",
+                                                             "🏴",
+                                                             "🏳️",
+                                                             "🏳️‍🌈",
+                                                             "🏳️‍⚧️",
+                                                             "🏴‍☠️",
+                                                             "🇦🇨",
+                                                             "🇦🇩",
+                                                             "🇦🇪",
+                                                             "🇦🇫",
+                                                             "🇦🇬",
+                                                             "🇦🇮",
+                                                             "🇦🇱",
+                                                             "🇦🇲",
+                                                             "🇦🇴",
+                                                             "🇦🇶",
+                                                             "🇦🇷",
+                                                             "🇦🇸",
+                                                             "🇦🇹",
+                                                             "🇦🇺",
+                                                             "🇦🇼",
+                                                             "🇦🇽",
+                                                             "🇦🇿",
+                                                             "🇧🇦",
+                                                             "🇧🇧",
+                                                             "🇧🇩",
+                                                             "🇧🇪",
+                                                             "🇧🇫",
+                                                             "🇧🇬",
+                                                             "🇧🇭",
+                                                             "🇧🇮",
+                                                             "🇧🇯",
+                                                             "🇧🇱",
+                                                             "🇧🇲",
+                                                             "🇧🇳",
+                                                             "🇧🇴",
+                                                             "🇧🇶",
+                                                             "🇧🇷",
+                                                             "🇧🇸",
+                                                             "🇧🇹",
+                                                             "🇧🇻",
+                                                             "🇧🇼",
+                                                             "🇧🇾",
+                                                             "🇧🇿",
+                                                             "🇨🇦",
+                                                             "🇨🇨",
+                                                             "🇨🇩",
+                                                             "🇨🇫",
+                                                             "🇨🇬",
+                                                             "🇨🇭",
+                                                             "🇨🇮",
+                                                             "🇨🇰",
+                                                             "🇨🇱",
+                                                             "🇨🇲",
+                                                             "🇨🇳",
+                                                             "🇨🇴",
+                                                             "🇨🇵",
+                                                             "🇨🇷",
+                                                             "🇨🇺",
+                                                             "🇨🇻",
+                                                             "🇨🇼",
+                                                             "🇨🇽",
+                                                             "🇨🇾",
+                                                             "🇨🇿",
+                                                             "🇩🇪",
+                                                             "🇩🇬",
+                                                             "🇩🇯",
+                                                             "🇩🇰",
+                                                             "🇩🇲",
+                                                             "🇩🇴",
+                                                             "🇩🇿",
+                                                             "🇪🇦",
+                                                             "🇪🇨",
+                                                             "🇪🇪",
+                                                             "🇪🇬",
+                                                             "🇪🇭",
+                                                             "🇪🇷",
+                                                             "🇪🇸",
+                                                             "🇪🇹",
+                                                             "🇪🇺",
+                                                             "🇫🇮",
+                                                             "🇫🇯",
+                                                             "🇫🇰",
+                                                             "🇫🇲",
+                                                             "🇫🇴",
+                                                             "🇫🇷",
+                                                             "🇬🇦",
+                                                             "🇬🇧",
+                                                             "🇬🇩",
+                                                             "🇬🇪",
+                                                             "🇬🇫",
+                                                             "🇬🇬",
+                                                             "🇬🇭",
+                                                             "🇬🇮",
+                                                             "🇬🇱",
+                                                             "🇬🇲",
+                                                             "🇬🇳",
+                                                             "🇬🇵",
+                                                             "🇬🇶",
+                                                             "🇬🇷",
+                                                             "🇬🇸",
+                                                             "🇬🇹",
+                                                             "🇬🇺",
+                                                             "🇬🇼",
+                                                             "🇬🇾",
+                                                             "🇭🇰",
+                                                             "🇭🇲",
+                                                             "🇭🇳",
+                                                             "🇭🇷",
+                                                             "🇭🇹",
+                                                             "🇭🇺",
+                                                             "🇮🇨",
+                                                             "🇮🇩",
+                                                             "🇮🇪",
+                                                             "🇮🇱",
+                                                             "🇮🇲",
+                                                             "🇮🇳",
+                                                             "🇮🇴",
+                                                             "🇮🇶",
+                                                             "🇮🇷",
+                                                             "🇮🇸",
+                                                             "🇮🇹",
+                                                             "🇯🇪",
+                                                             "🇯🇲",
+                                                             "🇯🇴",
+                                                             "🇯🇵",
+                                                             "🇰🇪",
+                                                             "🇰🇬",
+                                                             "🇰🇭",
+                                                             "🇰🇮",
+                                                             "🇰🇲",
+                                                             "🇰🇳",
+                                                             "🇰🇵",
+                                                             "🇰🇷",
+                                                             "🇰🇼",
+                                                             "🇰🇾",
+                                                             "🇰🇿",
+                                                             "🇱🇦",
+                                                             "🇱🇧",
+                                                             "🇱🇨",
+                                                             "🇱🇮",
+                                                             "🇱🇰",
+                                                             "🇱🇷",
+                                                             "🇱🇸",
+                                                             "🇱🇹",
+                                                             "🇱🇺",
+                                                             "🇱🇻",
+                                                             "🇱🇾",
+                                                             "🇲🇦",
+                                                             "🇲🇨",
+                                                             "🇲🇩",
+                                                             "🇲🇪",
+                                                             "🇲🇫",
+                                                             "🇲🇬",
+                                                             "🇲🇭",
+                                                             "🇲🇰",
+                                                             "🇲🇱",
+                                                             "🇲🇲",
+                                                             "🇲🇳",
+                                                             "🇲🇴",
+                                                             "🇲🇵",
+                                                             "🇲🇶",
+                                                             "🇲🇷",
+                                                             "🇲🇸",
+                                                             "🇲🇹",
+                                                             "🇲🇺",
+                                                             "🇲🇻",
+                                                             "🇲🇼",
+                                                             "🇲🇽",
+                                                             "🇲🇾",
+                                                             "🇲🇿",
+                                                             "🇳🇦",
+                                                             "🇳🇨",
+                                                             "🇳🇪",
+                                                             "🇳🇫",
+                                                             "🇳🇬",
+                                                             "🇳🇮",
+                                                             "🇳🇱",
+                                                             "🇳🇴",
+                                                             "🇳🇵",
+                                                             "🇳🇷",
+                                                             "🇳🇺",
+                                                             "🇳🇿",
+                                                             "🇴🇲",
+                                                             "🇵🇦",
+                                                             "🇵🇪",
+                                                             "🇵🇫",
+                                                             "🇵🇬",
+                                                             "🇵🇭",
+                                                             "🇵🇰",
+                                                             "🇵🇱",
+                                                             "🇵🇲",
+                                                             "🇵🇳",
+                                                             "🇵🇷",
+                                                             "🇵🇸",
+                                                             "🇵🇹",
+                                                             "🇵🇼",
+                                                             "🇵🇾",
+                                                             "🇶🇦",
+                                                             "🇷🇪",
+                                                             "🇷🇴",
+                                                             "🇷🇸",
+                                                             "🇷🇺",
+                                                             "🇷🇼",
+                                                             "🇸🇦",
+                                                             "🇸🇧",
+                                                             "🇸🇨",
+                                                             "🇸🇩",
+                                                             "🇸🇪",
+                                                             "🇸🇬",
+                                                             "🇸🇭",
+                                                             "🇸🇮",
+                                                             "🇸🇯",
+                                                             "🇸🇰",
+                                                             "🇸🇱",
+                                                             "🇸🇲",
+                                                             "🇸🇳",
+                                                             "🇸🇴",
+                                                             "🇸🇷",
+                                                             "🇸🇸",
+                                                             "🇸🇹",
+                                                             "🇸🇻",
+                                                             "🇸🇽",
+                                                             "🇸🇾",
+                                                             "🇸🇿",
+                                                             "🇹🇦",
+                                                             "🇹🇨",
+                                                             "🇹🇩",
+                                                             "🇹🇫",
+                                                             "🇹🇬",
+                                                             "🇹🇭",
+                                                             "🇹🇯",
+                                                             "🇹🇰",
+                                                             "🇹🇱",
+                                                             "🇹🇲",
+                                                             "🇹🇳",
+                                                             "🇹🇴",
+                                                             "🇹🇷",
+                                                             "🇹🇹",
+                                                             "🇹🇻",
+                                                             "🇹🇼",
+                                                             "🇹🇿",
+                                                             "🇺🇦",
+                                                             "🇺🇬",
+                                                             "🇺🇲",
+                                                             "🇺🇳",
+                                                             "🇺🇸",
+                                                             "🇺🇾",
+                                                             "🇺🇿",
+                                                             "🇻🇦",
+                                                             "🇻🇨",
+                                                             "🇻🇪",
+                                                             "🇻🇬",
+                                                             "🇻🇮",
+                                                             "🇻🇳",
+                                                             "🇻🇺",
+                                                             "🇼🇫",
+                                                             "🇼🇸",
+                                                             "🇽🇰",
+                                                             "🇾🇪",
+                                                             "🇾🇹",
+                                                             "🇿🇦",
+                                                             "🇿🇲",
+                                                             "🇿🇼"});
 }
@@ -0,0 +1,428 @@
+#include "faker-cxx/GeoPointGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <numeric>
+#include <stdexcept>
+
+#include "faker-cxx/Number.h"
+
+namespace faker
+{
+namespace
+{
+constexpr double degreesPerRadian = 180.0 / std::numbers::pi;
+constexpr double kilometersPerDegree = 111.32;
+// Longitude distances of hotspots close to a pole are scaled as if they were at about 89.9 degrees of latitude.
+constexpr double minLatitudeCosine = 0.002;
+// Points of a hotspot are at most about 9 standard deviations from its center, so with this bound their longitudes are
+// within 25000 turns of it.
+constexpr double maxLongitudeScale = 1e6;
+// Added to turns to make them positive, so truncating them rounds them down.
+constexpr double turnOffset = 65536.0;
+constexpr std::size_t chunkSize = 256;
+
+// Uniform in [0, 1), from the 53 high bits of a 64-bit draw.
+double randomUnit()
+{
+    return static_cast<double>(Number::integer<std::uint64_t>(std::numeric_limits<std::uint64_t>::max()) >> 11) *
+           0x1.0p-53;
+}
+
+std::size_t randomWeightedIndex(const std::vector<double>& cumulativeWeights)
+{
+    const auto index = std::ranges::upper_bound(cumulativeWeights, randomUnit()) - cumulativeWeights.begin();
+
+    return std::min(static_cast<std::size_t>(index), cumulativeWeights.size() - 1);
+}
+
+// Running sums of the weights, divided by their total.
+std::vector<double> normalizedCumulativeWeights(const std::vector<double>& weights)
+{
+    std::vector<double> cumulativeWeights(weights.size());
+
+    std::partial_sum(weights.begin(), weights.end(), cumulativeWeights.begin());
+
+    const auto totalWeight = cumulativeWeights.back();
+
+    for (auto& cumulativeWeight : cumulativeWeights)
+    {
+        cumulativeWeight /= totalWeight;
+    }
+
+    return cumulativeWeights;
+}
+
+// Twice the signed area of the triangle, positive if its vertices are in counterclockwise order.
+double cross(const GeoPoint& origin, const GeoPoint& a, const GeoPoint& b)
+{
+    return (a.longitude - origin.longitude) * (b.latitude - origin.latitude) -
+           (a.latitude - origin.latitude) * (b.longitude - origin.longitude);
+}
+
+bool isInCounterclockwiseTriangle(const GeoPoint& point, const GeoPoint& a, const GeoPoint& b, const GeoPoint& c)
+{
+    return cross(a, b, point) >= 0 && cross(b, c, point) >= 0 && cross(c, a, point) >= 0;
+}
+
+bool isSamePoint(const GeoPoint& a, const GeoPoint& b)
+{
+    return a.latitude == b.latitude && a.longitude == b.longitude;
+}
+
+double twiceSignedArea(std::span<const GeoPoint> vertices)
+{
+    double area = 0;
+
+    for (std::size_t i = 0; i < vertices.size(); i++)
+    {
+        const auto& current = vertices[i];
+        const auto& next = vertices[(i + 1) % vertices.size()];
+
+        area += current.longitude * next.latitude - next.longitude * current.latitude;
+    }
+
+    return area;
+}
+}
+
+GeoPointGenerator::GeoPointGenerator(Area area) : area{area} {}
+
+GeoPointGenerator GeoPointGenerator::sphere()
+{
+    return GeoPointGenerator{Area::Sphere};
+}
+
+GeoPointGenerator GeoPointGenerator::boundingBox(const GeoBoundingBox& box)
+{
+    const auto isLatitude = [](double latitude) { return latitude >= -90.0 && latitude <= 90.0; };
+    const auto isLongitude = [](double longitude) { return longitude >= -180.0 && longitude <= 180.0; };
+
+    if (!isLatitude(box.minLatitude) || !isLatitude(box.maxLatitude) || !isLongitude(box.minLongitude) ||
+        !isLongitude(box.maxLongitude))
+    {
+        throw std::invalid_argument("Bounding box coordinates are out of range.");
+    }
+
+    if (box.minLatitude > box.maxLatitude)
+    {
+        throw std::invalid_argument("Minimum latitude must not be greater than maximum latitude.");
+    }
+
+    GeoPointGenerator generator{Area::BoundingBox};
+
+    generator.minLatitudeSine = std::sin(box.minLatitude / degreesPerRadian);
+    generator.latitudeSineSpan = std::sin(box.maxLatitude / degreesPerRadian) - generator.minLatitudeSine;
+    generator.minLongitude = box.minLongitude;
+    generator.longitudeSpan = box.minLongitude <= box.maxLongitude ? box.maxLongitude - box.minLongitude :
+                                                                     box.maxLongitude + 360.0 - box.minLongitude;
+
+    return generator;
+}
+
+GeoPointGenerator GeoPointGenerator::polygon(std::span<const GeoPoint> vertices)
+{
+    if (vertices.size() < 3)
+    {
+        throw std::invalid_argument("Polygon must have at least 3 vertices.");
+    }
+
+    const auto polygonArea = twiceSignedArea(vertices);
+
+    if (polygonArea == 0)
+    {
+        throw std::invalid_argument("Polygon must have an area.");
+    }
+
+    // Ear clipping: a convex vertex whose triangle with its neighbours holds no other vertex is cut off, until one
+    // triangle is left.
+    std::vector<std::size_t> remaining(vertices.size());
+    std::iota(remaining.begin(), remaining.end(), 0);
+
+    if (polygonArea < 0)
+    {
+        std::ranges::reverse(remaining);
+    }
+
+    GeoPointGenerator generator{Area::Polygon};
+    std::vector<double> areas;
+
+    while (remaining.size() >= 3)
+    {
+        bool clipped = false;
+
+        for (std::size_t i = 0; i < remaining.size() && !clipped; i++)
+        {
+            const auto& previous = vertices[remaining[(i + remaining.size() - 1) % remaining.size()]];
+            const auto& current = vertices[remaining[i]];
+            const auto& next = vertices[remaining[(i + 1) % remaining.size()]];
+
+            const auto area = cross(previous, current, next);
+
+            if (area < 0)
+            {
+                continue;
+            }
+
+            const auto isEar = [&](std::size_t index)
+            {
+                const auto& vertex = vertices[index];
+
+                return isSamePoint(vertex, previous) || isSamePoint(vertex, current) || isSamePoint(vertex, next) ||
+                       !isInCounterclockwiseTriangle(vertex, previous, current, next);
+            };
+
+            if (area > 0 && !std::ranges::all_of(remaining, isEar))
+            {
+                continue;
+            }
+
+            // Collinear vertices are dropped without a triangle.
+            if (area > 0)
+            {
+                generator.triangles.push_back({previous, current, next});
+                areas.push_back(area);
+            }
+
+            remaining.erase(remaining.begin() + static_cast<std::ptrdiff_t>(i));
+            clipped = true;
+        }
+
+        if (!clipped)
+        {
+            throw std::invalid_argument("Polygon must not intersect itself.");
+        }
+    }
+
+    // Triangles of a self-intersecting polygon overlap or stick out of it, so their areas do not add up.
+    const auto trianglesArea = std::accumulate(areas.begin(), areas.end(), 0.0);
+
+    if (areas.empty() || std::abs(trianglesArea - std::abs(polygonArea)) > 1e-9 * std::abs(polygonArea))
+    {
+        throw std::invalid_argument("Polygon must not intersect itself.");
+    }
+
+    generator.cumulativeWeights = normalizedCumulativeWeights(areas);
+
+    return generator;
+}
+
+GeoPointGenerator GeoPointGenerator::hotspots(std::span<const GeoHotspot> hotspots)
+{
+    if (hotspots.empty())
+    {
+        throw std::invalid_argument("At least one hotspot is required.");
+    }
+
+    std::vector<double> weights;
+
+    for (const auto& hotspot : hotspots)
+    {
+        if (hotspot.radiusKm < 0 || hotspot.weight < 0)
+        {
+            throw std::invalid_argument("Hotspot radius and weight must not be negative.");
+        }
+
+        if (hotspot.center.latitude < -90.0 || hotspot.center.latitude > 90.0)
+        {
+            throw std::invalid_argument("Hotspot latitude is out of range.");
+        }
+
+        weights.push_back(hotspot.weight);
+    }
+
+    if (std::accumulate(weights.begin(), weights.end(), 0.0) <= 0)
+    {
+        throw std::invalid_argument("Hotspot weights must not sum to 0.");
+    }
+
+    GeoPointGenerator generator{Area::Hotspots};
+
+    for (const auto& hotspot : hotspots)
+    {
+        const auto latitudeScale = hotspot.radiusKm / kilometersPerDegree;
+        const auto longitudeScale = std::min(
+            latitudeScale / std::max(std::cos(hotspot.center.latitude / degreesPerRadian), minLatitudeCosine),
+            maxLongitudeScale);
+
+        generator.hotspotList.push_back({hotspot.center, latitudeScale, longitudeScale});
+    }
+    generator.cumulativeWeights = normalizedCumulativeWeights(weights);
+
+    return generator;
+}
+
+void GeoPointGenerator::fill(std::span<double> latitudes, std::span<double> longitudes) const
+{
+    fillPoints(latitudes, longitudes);
+}
+
+void GeoPointGenerator::fill(std::span<float> latitudes, std::span<float> longitudes) const
+{
+    fillPoints(latitudes, longitudes);
+}
+
+GeoPoint GeoPointGenerator::next() const
+{
+    GeoPoint point{};
+
+    generateChunk(std::span{&point.latitude, 1}, std::span{&point.longitude, 1});
+
+    return point;
+}
+
+template <std::floating_point T>
+void GeoPointGenerator::fillPoints(std::span<T> latitudes, std::span<T> longitudes) const
+{
+    if (latitudes.size() != longitudes.size())
+    {
+        throw std::invalid_argument("Latitudes and longitudes must have the same size.");
+    }
+
+    // Coordinates are computed in double precision and only rounded when stored.
+    std::array<double, chunkSize> chunkLatitudes;
+    std::array<double, chunkSize> chunkLongitudes;
+
+    for (std::size_t start = 0; start < latitudes.size(); start += chunkSize)
+    {
+        const auto size = std::min(chunkSize, latitudes.size() - start);
+
+        generateChunk(std::span{chunkLatitudes}.first(size), std::span{chunkLongitudes}.first(size));
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            latitudes[start + i] = static_cast<T>(chunkLatitudes[i]);
+            longitudes[start + i] = static_cast<T>(chunkLongitudes[i]);
+        }
+    }
+}
+
+// Draws from the random engine, choices of triangles or hotspots and calls into libm run in scalar passes of their
+// own, so the passes combining them are plain arithmetic over contiguous arrays that compilers vectorize.
+void GeoPointGenerator::generateChunk(std::span<double> latitudes, std::span<double> longitudes) const
+{
+    const auto size = latitudes.size();
+
+    for (std::size_t i = 0; i < size; i++)
+    {
+        latitudes[i] = randomUnit();
+        longitudes[i] = randomUnit();
+    }
+
+    switch (area)
+    {
+    case Area::Sphere:
+    case Area::BoundingBox:
+    {
+        // Copies of the members, which the compiler could not otherwise tell apart from the coordinates written.
+        const auto boxMinLongitude = minLongitude;
+        const auto boxLongitudeSpan = longitudeSpan;
+
+        // Sines of latitudes of uniform points on the sphere are uniform.
+        for (auto& latitude : latitudes)
+        {
+            latitude = std::asin(std::min(minLatitudeSine + latitude * latitudeSineSpan, 1.0)) * degreesPerRadian;
+        }
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            const auto shiftedLongitude = boxMinLongitude + longitudes[i] * boxLongitudeSpan;
+
+            // Shifted longitudes are within two turns from -180, truncating their turns rounds them down. The
+            // conversion stands for a select, which is not vectorized while comparisons may trap.
+            const auto turns = static_cast<double>(static_cast<std::int32_t>((shiftedLongitude + 180.0) / 360.0));
+
+            longitudes[i] = shiftedLongitude - 360.0 * turns;
+        }
+
+        break;
+    }
+    case Area::Polygon:
+    {
+        // Vertices of the chosen triangles, with the first vertex kept as an offset to the other two.
+        std::array<double, chunkSize> originLatitudes;
+        std::array<double, chunkSize> originLongitudes;
+        std::array<double, chunkSize> firstEdgeLatitudes;
+        std::array<double, chunkSize> firstEdgeLongitudes;
+        std::array<double, chunkSize> secondEdgeLatitudes;
+        std::array<double, chunkSize> secondEdgeLongitudes;
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            const auto& [a, b, c] = triangles[randomWeightedIndex(cumulativeWeights)];
+
+            originLatitudes[i] = a.latitude;
+            originLongitudes[i] = a.longitude;
+            firstEdgeLatitudes[i] = b.latitude - a.latitude;
+            firstEdgeLongitudes[i] = b.longitude - a.longitude;
+            secondEdgeLatitudes[i] = c.latitude - a.latitude;
+            secondEdgeLongitudes[i] = c.longitude - a.longitude;
+
+            latitudes[i] = std::sqrt(latitudes[i]);
+        }
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            const auto root = latitudes[i];
+            const auto weightB = root * (1.0 - longitudes[i]);
+            const auto weightC = root * longitudes[i];
+
+            latitudes[i] = originLatitudes[i] + weightB * firstEdgeLatitudes[i] + weightC * secondEdgeLatitudes[i];
+            longitudes[i] =
+                originLongitudes[i] + weightB * firstEdgeLongitudes[i] + weightC * secondEdgeLongitudes[i];
+        }
+
+        break;
+    }
+    case Area::Hotspots:
+    {
+        std::array<double, chunkSize> centerLatitudes;
+        std::array<double, chunkSize> centerLongitudes;
+        std::array<double, chunkSize> latitudeScales;
+        std::array<double, chunkSize> longitudeScales;
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            const auto& hotspot = hotspotList[randomWeightedIndex(cumulativeWeights)];
+
+            centerLatitudes[i] = hotspot.center.latitude;
+            centerLongitudes[i] = hotspot.center.longitude;
+            latitudeScales[i] = hotspot.latitudeScale;
+            longitudeScales[i] = hotspot.longitudeScale;
+        }
+
+        // Box-Muller transform of the two uniforms into two independent standard normal distances.
+        for (std::size_t i = 0; i < size; i++)
+        {
+            const auto distance = std::sqrt(-2.0 * std::log1p(-latitudes[i]));
+            const auto angle = 2.0 * std::numbers::pi * longitudes[i];
+
+            latitudes[i] = distance * std::sin(angle);
+            longitudes[i] = distance * std::cos(angle);
+        }
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            latitudes[i] = std::clamp(centerLatitudes[i] + latitudes[i] * latitudeScales[i], -90.0, 90.0);
+        }
+
+        // std::floor is a call without SSE4.1, so whole turns are rounded down by truncation instead. The clamp
+        // catches longitudes rounded just past -180 or 180.
+        for (std::size_t i = 0; i < size; i++)
+        {
+            const auto longitude = centerLongitudes[i] + longitudes[i] * longitudeScales[i];
+            const auto turns =
+                static_cast<double>(static_cast<std::int32_t>((longitude + 180.0) / 360.0 + turnOffset)) - turnOffset;
+
+            longitudes[i] = std::clamp(longitude - 360.0 * turns, -180.0, 180.0);
+        }
+
+        break;
+    }
+    }
+}
+}
@@ -0,0 +1,208 @@
+#include "faker-cxx/GeoPointGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+class GeoPointGeneratorTest : public Test
+{
+public:
+    static bool isInPolygon(const GeoPoint& point, std::span<const GeoPoint> vertices)
+    {
+        bool inside = false;
+
+        for (std::size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++)
+        {
+            const auto& a = vertices[i];
+            const auto& b = vertices[j];
+
+            if ((a.latitude > point.latitude) != (b.latitude > point.latitude) &&
+                point.longitude < (b.longitude - a.longitude) * (point.latitude - a.latitude) /
+                                          (b.latitude - a.latitude) +
+                                      a.longitude)
+            {
+                inside = !inside;
+            }
+        }
+
+        return inside;
+    }
+};
+
+TEST_F(GeoPointGeneratorTest, shouldGenerateUniformPointsOnSphere)
+{
+    const auto generator = GeoPointGenerator::sphere();
+
+    std::vector<double> latitudes(20000);
+    std::vector<double> longitudes(20000);
+
+    generator.fill(latitudes, longitudes);
+
+    ASSERT_TRUE(std::ranges::all_of(latitudes, [](double latitude) { return latitude >= -90 && latitude <= 90; }));
+    ASSERT_TRUE(
+        std::ranges::all_of(longitudes, [](double longitude) { return longitude >= -180 && longitude < 180; }));
+
+    // Half of the surface of the sphere lies between latitudes -30 and 30.
+    const auto tropicalCount =
+        std::ranges::count_if(latitudes, [](double latitude) { return std::abs(latitude) < 30; });
+
+    ASSERT_NEAR(static_cast<double>(tropicalCount) / 20000, 0.5, 0.03);
+}
+
+TEST_F(GeoPointGeneratorTest, shouldGeneratePointsInBoundingBox)
+{
+    const auto generator = GeoPointGenerator::boundingBox({35.0, 71.0, -10.0, 40.0});
+
+    std::vector<float> latitudes(5000);
+    std::vector<float> longitudes(5000);
+
+    generator.fill(latitudes, longitudes);
+
+    for (std::size_t i = 0; i < latitudes.size(); i++)
+    {
+        ASSERT_GE(latitudes[i], 35.0f);
+        ASSERT_LE(latitudes[i], 71.0f);
+        ASSERT_GE(longitudes[i], -10.0f);
+        ASSERT_LE(longitudes[i], 40.0f);
+    }
+}
+
+TEST_F(GeoPointGeneratorTest, shouldGeneratePointsInBoundingBoxCrossingAntimeridian)
+{
+    const auto generator = GeoPointGenerator::boundingBox({-20.0, -10.0, 170.0, -170.0});
+
+    for (int i = 0; i < 1000; i++)
+    {
+        const auto point = generator.next();
+
+        ASSERT_GE(point.latitude, -20.0);
+        ASSERT_LE(point.latitude, -10.0);
+        ASSERT_TRUE(point.longitude >= 170.0 || point.longitude <= -170.0);
+    }
+}
+
+TEST_F(GeoPointGeneratorTest, shouldRejectInvalidBoundingBox)
+{
+    ASSERT_THROW(GeoPointGenerator::boundingBox({10.0, -10.0, 0.0, 10.0}), std::invalid_argument);
+    ASSERT_THROW(GeoPointGenerator::boundingBox({-10.0, 91.0, 0.0, 10.0}), std::invalid_argument);
+    ASSERT_THROW(GeoPointGenerator::boundingBox({-10.0, 10.0, -181.0, 10.0}), std::invalid_argument);
+}
+
+TEST_F(GeoPointGeneratorTest, shouldGeneratePointsInConcavePolygon)
+{
+    // L-shaped polygon, listed clockwise.
+    const auto vertices = std::to_array<GeoPoint>({{50, 10}, {52, 10}, {52, 11}, {51, 11}, {51, 14}, {50, 14}});
+
+    const auto generator = GeoPointGenerator::polygon(vertices);
+
+    std::vector<double> latitudes(5000);
+    std::vector<double> longitudes(5000);
+
+    generator.fill(latitudes, longitudes);
+
+    std::size_t inArm = 0;
+
+    for (std::size_t i = 0; i < latitudes.size(); i++)
+    {
+        ASSERT_TRUE(isInPolygon({latitudes[i], longitudes[i]}, vertices));
+
+        inArm += longitudes[i] > 11 ? 1 : 0;
+    }
+
+    // The arm east of longitude 11 covers 3 of the 5 square degrees of the polygon.
+    ASSERT_NEAR(static_cast<double>(inArm) / 5000, 0.6, 0.03);
+}
+
+TEST_F(GeoPointGeneratorTest, shouldRejectInvalidPolygon)
+{
+    const auto twoVertices = std::to_array<GeoPoint>({{0, 0}, {1, 1}});
+    const auto collinear = std::to_array<GeoPoint>({{0, 0}, {1, 1}, {2, 2}});
+    const auto bowTie = std::to_array<GeoPoint>({{0, 0}, {1, 1}, {1, 0}, {0, 2}});
+
+    ASSERT_THROW(GeoPointGenerator::polygon(twoVertices), std::invalid_argument);
+    ASSERT_THROW(GeoPointGenerator::polygon(collinear), std::invalid_argument);
+    ASSERT_THROW(GeoPointGenerator::polygon(bowTie), std::invalid_argument);
+}
+
+TEST_F(GeoPointGeneratorTest, shouldGeneratePointsAroundHotspots)
+{
+    const auto hotspots = std::to_array<GeoHotspot>({{{52.2297, 21.0122}, 5.0, 3.0}, {{48.8566, 2.3522}, 5.0, 1.0}});
+
+    const auto generator = GeoPointGenerator::hotspots(hotspots);
+
+    std::vector<double> latitudes(4000);
+    std::vector<double> longitudes(4000);
+
+    generator.fill(latitudes, longitudes);
+
+    std::size_t nearFirst = 0;
+
+    for (std::size_t i = 0; i < latitudes.size(); i++)
+    {
+        // Six standard deviations are about 0.27 degrees of latitude.
+        const auto isNearFirst = std::abs(latitudes[i] - 52.2297) < 0.3 && std::abs(longitudes[i] - 21.0122) < 0.5;
+        const auto isNearSecond = std::abs(latitudes[i] - 48.8566) < 0.3 && std::abs(longitudes[i] - 2.3522) < 0.5;
+
+        ASSERT_TRUE(isNearFirst || isNearSecond);
+
+        nearFirst += isNearFirst ? 1 : 0;
+    }
+
+    ASSERT_NEAR(static_cast<double>(nearFirst) / 4000, 0.75, 0.03);
+}
+
+TEST_F(GeoPointGeneratorTest, shouldWrapHotspotPointsAcrossAntimeridian)
+{
+    const auto hotspots = std::to_array<GeoHotspot>({{{0.0, 179.99}, 50.0}});
+
+    const auto generator = GeoPointGenerator::hotspots(hotspots);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        const auto point = generator.next();
+
+        ASSERT_GE(point.longitude, -180.0);
+        ASSERT_LT(point.longitude, 180.0);
+    }
+}
+
+TEST_F(GeoPointGeneratorTest, shouldWrapPointsOfHugeHotspotIntoRange)
+{
+    const auto hotspots = std::to_array<GeoHotspot>({{{89.99, -179.0}, 1e9}});
+
+    const auto generator = GeoPointGenerator::hotspots(hotspots);
+
+    std::vector<double> latitudes(4096);
+    std::vector<double> longitudes(4096);
+
+    generator.fill(latitudes, longitudes);
+
+    ASSERT_TRUE(std::ranges::all_of(latitudes, [](double latitude) { return latitude >= -90 && latitude <= 90; }));
+    ASSERT_TRUE(
+        std::ranges::all_of(longitudes, [](double longitude) { return longitude >= -180 && longitude <= 180; }));
+}
+
+TEST_F(GeoPointGeneratorTest, shouldRejectInvalidHotspots)
+{
+    const auto negativeRadius = std::to_array<GeoHotspot>({{{0.0, 0.0}, -1.0}});
+    const auto zeroWeights = std::to_array<GeoHotspot>({{{0.0, 0.0}, 1.0, 0.0}});
+
+    ASSERT_THROW(GeoPointGenerator::hotspots({}), std::invalid_argument);
+    ASSERT_THROW(GeoPointGenerator::hotspots(negativeRadius), std::invalid_argument);
+    ASSERT_THROW(GeoPointGenerator::hotspots(zeroWeights), std::invalid_argument);
+}
+
+TEST_F(GeoPointGeneratorTest, shouldRejectArraysOfDifferentSizes)
+{
+    std::vector<double> latitudes(10);
+    std::vector<double> longitudes(9);
+
+    ASSERT_THROW(GeoPointGenerator::sphere().fill(latitudes, longitudes), std::invalid_argument);
+}
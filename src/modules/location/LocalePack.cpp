@@ -0,0 +1,415 @@
+#include "faker-cxx/LocalePack.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace faker
+{
+namespace
+{
+constexpr std::array<char, 8> packMagic{'F', 'K', 'R', 'L', 'P', 'A', 'C', 'K'};
+constexpr std::uint32_t packVersion = 1;
+// Read back differently by a machine of the other byte order.
+constexpr std::uint32_t byteOrderMark = 0x01020304;
+
+struct PackHeader {
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t byteOrderMark;
+    std::uint32_t listCount;
+    std::uint32_t reserved;
+    std::uint64_t charactersOffset;
+    std::uint64_t charactersSize;
+};
+
+// Names are strings of the pool, offsets of the strings of a list are an array of 32-bit offsets into the pool.
+struct PackListEntry {
+    std::uint32_t nameOffset;
+    std::uint32_t stringCount;
+    std::uint64_t offsetsOffset;
+};
+
+static_assert(sizeof(PackHeader) == 40 && sizeof(PackListEntry) == 16);
+
+struct MappedFile {
+    const std::byte* data;
+    std::size_t size;
+};
+
+MappedFile mapFile(const std::filesystem::path& path)
+{
+    const auto error = [&path](std::string_view reason)
+    { return std::runtime_error(std::format("Cannot map locale pack {}: {}.", path.string(), reason)); };
+
+#ifdef _WIN32
+    const auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw error("file cannot be opened");
+    }
+
+    LARGE_INTEGER fileSize;
+
+    if (!GetFileSizeEx(file, &fileSize) || static_cast<std::uint64_t>(fileSize.QuadPart) < sizeof(PackHeader))
+    {
+        CloseHandle(file);
+
+        throw error("file is too small");
+    }
+
+    const auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    CloseHandle(file);
+
+    if (mapping == nullptr)
+    {
+        throw error("file cannot be mapped");
+    }
+
+    const auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    CloseHandle(mapping);
+
+    if (view == nullptr)
+    {
+        throw error("file cannot be mapped");
+    }
+
+    return {static_cast<const std::byte*>(view), static_cast<std::size_t>(fileSize.QuadPart)};
+#else
+    const auto file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (file == -1)
+    {
+        throw error("file cannot be opened");
+    }
+
+    struct stat status{};
+
+    if (::fstat(file, &status) == -1 || static_cast<std::uint64_t>(status.st_size) < sizeof(PackHeader))
+    {
+        ::close(file);
+
+        throw error("file is too small");
+    }
+
+    const auto size = static_cast<std::size_t>(status.st_size);
+
+    const auto address = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+
+    ::close(file);
+
+    if (address == MAP_FAILED)
+    {
+        throw error("file cannot be mapped");
+    }
+
+    return {static_cast<const std::byte*>(address), size};
+#endif
+}
+
+void unmapFile(const std::byte* data, [[maybe_unused]] std::size_t size)
+{
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    ::munmap(const_cast<std::byte*>(data), size);
+#endif
+}
+
+template <typename T>
+T readStruct(const std::byte* data, std::size_t offset)
+{
+    T value;
+
+    std::memcpy(&value, data + offset, sizeof(T));
+
+    return value;
+}
+
+bool isStringInPool(std::uint64_t offset, const char* characters, std::uint64_t charactersSize)
+{
+    return offset < charactersSize && offset + 1 + static_cast<unsigned char>(characters[offset]) <= charactersSize;
+}
+
+std::uint32_t checkedOffset(std::size_t offset)
+{
+    if (offset > std::numeric_limits<std::uint32_t>::max())
+    {
+        throw std::length_error("Locale pack strings do not fit in 32-bit offsets.");
+    }
+
+    return static_cast<std::uint32_t>(offset);
+}
+
+void checkPackStringLength(std::string_view string)
+{
+    if (string.size() > std::numeric_limits<unsigned char>::max())
+    {
+        throw std::length_error("String is too long to be stored in a locale pack.");
+    }
+}
+
+struct RegisteredPack {
+    std::filesystem::path path;
+    std::shared_ptr<const LocalePack> pack;
+};
+
+std::mutex registryMutex;
+std::map<Country, RegisteredPack> registeredPacks;
+}
+
+LocalePack::LocalePack(const std::filesystem::path& path)
+{
+    const auto [mappedData, mappedSize] = mapFile(path);
+
+    data = mappedData;
+    size = mappedSize;
+
+    try
+    {
+        const auto invalid = [&path](std::string_view reason)
+        { return std::runtime_error(std::format("Invalid locale pack {}: {}.", path.string(), reason)); };
+
+        const auto header = readStruct<PackHeader>(data, 0);
+
+        if (header.magic != packMagic || header.version != packVersion)
+        {
+            throw invalid("unknown format");
+        }
+
+        if (header.byteOrderMark != byteOrderMark)
+        {
+            throw invalid("written in a different byte order");
+        }
+
+        if (header.charactersOffset > size || header.charactersSize > size - header.charactersOffset ||
+            header.listCount > (size - sizeof(PackHeader)) / sizeof(PackListEntry))
+        {
+            throw invalid("sections exceed the file");
+        }
+
+        const auto characters = reinterpret_cast<const char*>(data + header.charactersOffset);
+
+        lists.reserve(header.listCount);
+
+        for (std::size_t i = 0; i < header.listCount; i++)
+        {
+            const auto entry = readStruct<PackListEntry>(data, sizeof(PackHeader) + i * sizeof(PackListEntry));
+
+            if (!isStringInPool(entry.nameOffset, characters, header.charactersSize))
+            {
+                throw invalid("list name exceeds the strings");
+            }
+
+            if (entry.offsetsOffset % alignof(std::uint32_t) != 0 || entry.offsetsOffset > size ||
+                entry.stringCount > (size - entry.offsetsOffset) / sizeof(std::uint32_t))
+            {
+                throw invalid("list offsets exceed the file");
+            }
+
+            const std::span offsets{reinterpret_cast<const std::uint32_t*>(data + entry.offsetsOffset),
+                                    entry.stringCount};
+
+            if (!std::ranges::all_of(offsets, [characters, &header](std::uint32_t offset)
+                                     { return isStringInPool(offset, characters, header.charactersSize); }))
+            {
+                throw invalid("list string exceeds the strings");
+            }
+
+            const std::string_view name{characters + entry.nameOffset + 1,
+                                        static_cast<unsigned char>(characters[entry.nameOffset])};
+
+            lists.push_back({name, StringPoolView{characters, offsets}});
+        }
+    }
+    catch (...)
+    {
+        unmap();
+
+        throw;
+    }
+}
+
+LocalePack::LocalePack(LocalePack&& other) noexcept
+    : data{std::exchange(other.data, nullptr)}, size{std::exchange(other.size, 0)}, lists{std::move(other.lists)}
+{
+}
+
+LocalePack& LocalePack::operator=(LocalePack&& other) noexcept
+{
+    if (this != &other)
+    {
+        unmap();
+
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+        lists = std::move(other.lists);
+    }
+
+    return *this;
+}
+
+LocalePack::~LocalePack()
+{
+    unmap();
+}
+
+void LocalePack::unmap()
+{
+    if (data != nullptr)
+    {
+        unmapFile(data, size);
+
+        data = nullptr;
+        size = 0;
+    }
+}
+
+bool LocalePack::contains(std::string_view name) const
+{
+    return std::ranges::any_of(lists, [name](const List& list) { return list.name == name; });
+}
+
+StringPoolView LocalePack::list(std::string_view name) const
+{
+    const auto list = std::ranges::find(lists, name, &List::name);
+
+    if (list == lists.end())
+    {
+        throw std::out_of_range(std::format("Locale pack has no list {}.", name));
+    }
+
+    return list->strings;
+}
+
+Dictionary LocalePack::dictionary(std::string_view name) const
+{
+    return Dictionary{list(name)};
+}
+
+void LocalePackWriter::addList(std::string_view name, std::span<const std::string_view> strings)
+{
+    if (std::ranges::any_of(lists, [name](const auto& list) { return list.first == name; }))
+    {
+        throw std::invalid_argument(std::format("Locale pack already has list {}.", name));
+    }
+
+    checkPackStringLength(name);
+    std::ranges::for_each(strings, checkPackStringLength);
+
+    lists.emplace_back(std::string{name}, std::vector<std::string>{strings.begin(), strings.end()});
+}
+
+void LocalePackWriter::write(const std::filesystem::path& path) const
+{
+    std::string characters;
+    std::unordered_map<std::string_view, std::uint32_t> stringOffsets;
+
+    const auto addString = [&characters, &stringOffsets](std::string_view string)
+    {
+        const auto [entry, inserted] = stringOffsets.try_emplace(string, checkedOffset(characters.size()));
+
+        if (inserted)
+        {
+            characters += static_cast<char>(string.size());
+            characters += string;
+        }
+
+        return entry->second;
+    };
+
+    std::vector<PackListEntry> entries;
+    std::vector<std::uint32_t> offsets;
+
+    auto offsetsOffset = sizeof(PackHeader) + lists.size() * sizeof(PackListEntry);
+
+    for (const auto& [name, strings] : lists)
+    {
+        entries.push_back({addString(name), checkedOffset(strings.size()), offsetsOffset});
+
+        for (const auto& string : strings)
+        {
+            offsets.push_back(addString(string));
+        }
+
+        offsetsOffset += strings.size() * sizeof(std::uint32_t);
+    }
+
+    const PackHeader header{packMagic, packVersion, byteOrderMark, checkedOffset(lists.size()), 0,
+                            offsetsOffset, characters.size()};
+
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entries.data()),
+               static_cast<std::streamsize>(entries.size() * sizeof(PackListEntry)));
+    file.write(reinterpret_cast<const char*>(offsets.data()),
+               static_cast<std::streamsize>(offsets.size() * sizeof(std::uint32_t)));
+    file.write(characters.data(), static_cast<std::streamsize>(characters.size()));
+    file.close();
+
+    if (!file)
+    {
+        throw std::runtime_error(std::format("Cannot write locale pack {}.", path.string()));
+    }
+}
+
+void LocalePackRegistry::registerPack(Country country, std::filesystem::path path)
+{
+    const std::lock_guard lock{registryMutex};
+
+    registeredPacks.insert_or_assign(country, RegisteredPack{std::move(path), nullptr});
+}
+
+void LocalePackRegistry::unregisterPack(Country country)
+{
+    const std::lock_guard lock{registryMutex};
+
+    registeredPacks.erase(country);
+}
+
+std::shared_ptr<const LocalePack> LocalePackRegistry::find(Country country)
+{
+    const std::lock_guard lock{registryMutex};
+
+    const auto registeredPack = registeredPacks.find(country);
+
+    if (registeredPack == registeredPacks.end())
+    {
+        return nullptr;
+    }
+
+    auto& [path, pack] = registeredPack->second;
+
+    if (!pack)
+    {
+        pack = std::make_shared<const LocalePack>(path);
+    }
+
+    return pack;
+}
+}
@@ -0,0 +1,231 @@
+#include "faker-cxx/LocalePack.h"
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+#include "gtest/gtest.h"
+
+#include "faker-cxx/Location.h"
+
+using namespace ::testing;
+using namespace faker;
+
+namespace
+{
+const auto cities = std::to_array<std::string_view>({"Warszawa", "Kraków", "Gdańsk"});
+const auto streetSuffixes = std::to_array<std::string_view>({"Aleja", "Ulica"});
+}
+
+class LocalePackTest : public Test
+{
+public:
+    LocalePackTest()
+        : path{std::filesystem::temp_directory_path() /
+               (std::string{"faker-cxx-"} + UnitTest::GetInstance()->current_test_info()->name() + ".pack")}
+    {
+    }
+
+    ~LocalePackTest() override
+    {
+        LocalePackRegistry::unregisterPack(Country::Poland);
+        std::filesystem::remove(path);
+    }
+
+    void writeFile(std::string_view content) const
+    {
+        std::ofstream file{path, std::ios::binary};
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    std::filesystem::path path;
+};
+
+TEST_F(LocalePackTest, shouldReadWrittenLists)
+{
+    LocalePackWriter writer;
+    writer.addList("cities", cities);
+    writer.addList("streetSuffixes", streetSuffixes);
+    writer.addList("empty", {});
+    writer.write(path);
+
+    const LocalePack pack{path};
+
+    ASSERT_TRUE(pack.contains("cities"));
+    ASSERT_TRUE(pack.contains("empty"));
+    ASSERT_FALSE(pack.contains("streets"));
+
+    const auto packCities = pack.list("cities");
+
+    ASSERT_EQ(packCities.size(), cities.size());
+
+    for (std::size_t i = 0; i < cities.size(); i++)
+    {
+        ASSERT_EQ(packCities[i], cities[i]);
+    }
+
+    const auto packStreetSuffixes = pack.dictionary("streetSuffixes");
+
+    ASSERT_EQ(packStreetSuffixes.size(), streetSuffixes.size());
+    ASSERT_EQ(packStreetSuffixes[1], "Ulica");
+    ASSERT_TRUE(pack.list("empty").empty());
+}
+
+TEST_F(LocalePackTest, shouldStoreRepeatedStringsOnce)
+{
+    const auto repeated = std::to_array<std::string_view>({"word", "word", "word"});
+
+    LocalePackWriter writer;
+    writer.addList("words", repeated);
+    writer.write(path);
+
+    const LocalePack pack{path};
+    const auto words = pack.list("words");
+
+    ASSERT_EQ(words.size(), 3);
+    ASSERT_EQ(words[0].data(), words[2].data());
+}
+
+TEST_F(LocalePackTest, shouldKeepListsValidAfterMove)
+{
+    LocalePackWriter writer;
+    writer.addList("cities", cities);
+    writer.write(path);
+
+    LocalePack pack{path};
+    const auto movedPack = std::move(pack);
+
+    ASSERT_EQ(movedPack.list("cities")[2], "Gdańsk");
+}
+
+TEST_F(LocalePackTest, shouldThrowWhenListIsMissing)
+{
+    LocalePackWriter writer;
+    writer.write(path);
+
+    const LocalePack pack{path};
+
+    ASSERT_THROW(pack.list("cities"), std::out_of_range);
+}
+
+TEST_F(LocalePackTest, shouldRejectDuplicateAndTooLongEntries)
+{
+    LocalePackWriter writer;
+    writer.addList("cities", cities);
+
+    const std::string tooLong(256, 'a');
+    const auto tooLongStrings = std::to_array<std::string_view>({tooLong});
+
+    ASSERT_THROW(writer.addList("cities", cities), std::invalid_argument);
+    ASSERT_THROW(writer.addList("long", tooLongStrings), std::length_error);
+}
+
+TEST_F(LocalePackTest, shouldRejectInvalidFiles)
+{
+    ASSERT_THROW(LocalePack{path}, std::runtime_error);
+
+    writeFile("not a locale pack");
+
+    ASSERT_THROW(LocalePack{path}, std::runtime_error);
+
+    writeFile(std::string(64, 'x'));
+
+    ASSERT_THROW(LocalePack{path}, std::runtime_error);
+}
+
+TEST_F(LocalePackTest, shouldRejectTruncatedPack)
+{
+    LocalePackWriter writer;
+    writer.addList("cities", cities);
+    writer.write(path);
+
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+
+    ASSERT_THROW(LocalePack{path}, std::runtime_error);
+}
+
+TEST_F(LocalePackTest, shouldFindRegisteredPackOnlyAfterRegistration)
+{
+    LocalePackWriter writer;
+    writer.addList("cities", cities);
+    writer.write(path);
+
+    ASSERT_EQ(LocalePackRegistry::find(Country::Poland), nullptr);
+
+    LocalePackRegistry::registerPack(Country::Poland, path);
+
+    const auto pack = LocalePackRegistry::find(Country::Poland);
+
+    ASSERT_NE(pack, nullptr);
+    ASSERT_EQ(LocalePackRegistry::find(Country::Poland), pack);
+
+    LocalePackRegistry::unregisterPack(Country::Poland);
+
+    ASSERT_EQ(LocalePackRegistry::find(Country::Poland), nullptr);
+}
+
+TEST_F(LocalePackTest, shouldGenerateLocationDataFromRegisteredPack)
+{
+    const auto zipCodeFormats = std::to_array<std::string_view>({"##-###"});
+    const auto buildingNumberFormats = std::to_array<std::string_view>({"##", "#"});
+    const auto streetFormats = std::to_array<std::string_view>({"{streetSuffix} {lastName}"});
+    const auto addressFormats = std::to_array<std::string_view>({"{street} {buildingNumber}"});
+
+    LocalePackWriter writer;
+    writer.addList("cities", cities);
+    writer.addList("zipCodeFormats", zipCodeFormats);
+    writer.addList("buildingNumberFormats", buildingNumberFormats);
+    writer.addList("streetFormats", streetFormats);
+    writer.addList("streetSuffixes", streetSuffixes);
+    writer.addList("addressFormats", addressFormats);
+    writer.write(path);
+
+    LocalePackRegistry::registerPack(Country::Poland, path);
+
+    const auto city = Location::city(Country::Poland);
+
+    ASSERT_TRUE(std::ranges::find(cities, city) != cities.end());
+
+    const auto zipCode = Location::zipCode(Country::Poland);
+
+    ASSERT_EQ(zipCode.size(), 6);
+    ASSERT_EQ(zipCode[2], '-');
+
+    const auto streetAddress = Location::streetAddress(Country::Poland);
+
+    ASSERT_TRUE(streetAddress.starts_with("Aleja ") || streetAddress.starts_with("Ulica "));
+    ASSERT_TRUE(std::isdigit(streetAddress.back()));
+}
+
+TEST_F(LocalePackTest, shouldTakeStreetNamesFromRegisteredPack)
+{
+    const auto streetFormats = std::to_array<std::string_view>({"{firstName} {lastName}"});
+    const auto firstNames = std::to_array<std::string_view>({"Jan"});
+    const auto lastNames = std::to_array<std::string_view>({"Kowalski"});
+
+    LocalePackWriter writer;
+    writer.addList("streetFormats", streetFormats);
+    writer.addList("firstNames", firstNames);
+    writer.addList("lastNames", lastNames);
+    writer.write(path);
+
+    LocalePackRegistry::registerPack(Country::Poland, path);
+
+    ASSERT_EQ(Location::street(Country::Poland), "Jan Kowalski");
+}
+
+TEST_F(LocalePackTest, shouldRejectPackFormatWithUnknownPlaceholder)
+{
+    const auto streetFormats = std::to_array<std::string_view>({"{street}"});
+
+    LocalePackWriter writer;
+    writer.addList("streetFormats", streetFormats);
+    writer.write(path);
+
+    LocalePackRegistry::registerPack(Country::Poland, path);
+
+    ASSERT_THROW(Location::street(Country::Poland), std::invalid_argument);
+}
@@ -1,192 +1,460 @@
 #include "faker-cxx/Location.h"
 
-#include <map>
-
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../../common/EnumMap.h"
 #include "../../common/mappers/PrecisionMapper.h"
-#include "../../common/StringHelper.h"
+#include "../../common/NumberFormatter.h"
+#include "../../common/RandomDigits.h"
 #include "data/Countries.h"
 #include "data/States.h"
 #include "data/usa/UsaAddressFormat.h"
 #include "data/usa/UsaCities.h"
 #include "data/usa/UsaStreetSuffixes.h"
 #include "faker-cxx/Helper.h"
+#include "faker-cxx/LocalePack.h"
+#include "faker-cxx/Number.h"
 #include "faker-cxx/Person.h"
-#include "faker-cxx/String.h"
 
 namespace faker
 {
 namespace
 {
-const std::map<Country, std::vector<std::string>> countryToCitiesMapping{
-    {Country::Usa, usaCities},
-};
-
-const std::map<Country, std::string> countryToZipCodeFormatMapping{
+constexpr auto countryToCitiesMapping =
+    EnumMapBuilder::build<Country, std::span<const std::string_view>, Country::Italy>({
+        {Country::Usa, usaCities},
+        {Country::Poland, {}},
+        {Country::France, {}},
+        {Country::Germany, {}},
+        {Country::Italy, {}},
+    });
+
+constexpr auto countryToZipCodeFormatMapping = EnumMapBuilder::build<Country, std::string_view, Country::Italy>({
     {Country::Usa, usaZipCodeFormat},
+    {Country::Poland, {}},
+    {Country::France, {}},
+    {Country::Germany, {}},
+    {Country::Italy, {}},
+});
+
+constexpr auto countryToBuildingNumberFormatsMapping =
+    EnumMapBuilder::build<Country, std::span<const std::string_view>, Country::Italy>({
+        {Country::Usa, usaBuildingNumberFormats},
+        {Country::Poland, {}},
+        {Country::France, {}},
+        {Country::Germany, {}},
+        {Country::Italy, {}},
+    });
+
+enum class AddressTokenType {
+    Literal,
+    BuildingNumber,
+    Street,
+    FirstName,
+    LastName,
+    StreetSuffix,
 };
 
-const std::map<Country, std::vector<std::string>> countryToBuildingNumberFormatsMapping{
-    {Country::Usa, usaBuildingNumberFormats},
+struct AddressToken {
+    AddressTokenType type;
+    std::string_view literal;
 };
 
-const std::map<Country, std::vector<std::string>> countryToStreetFormatsMapping{
-    {Country::Usa, usaStreetFormats},
-};
+constexpr std::size_t maxAddressTokens = 8;
 
-const std::map<Country, std::string> countryToAddressFormatMapping{
-    {Country::Usa, usaAddressFormat},
-};
+/**
+ * Address format split once into literal text and placeholders, so generating an address only appends the value of
+ * every token to the output.
+ */
+struct AddressTemplate {
+    std::array<AddressToken, maxAddressTokens> tokens{};
+    std::size_t tokenCount = 0;
 
-const std::map<Country, std::vector<std::string>> countryToStreetSuffixesMapping{
-    {Country::Usa, usaStreetSuffixes},
+    constexpr bool empty() const
+    {
+        return tokenCount == 0;
+    }
 };
-}
 
-std::string Location::country()
+constexpr auto addressPlaceholders = std::to_array<std::pair<std::string_view, AddressTokenType>>({
+    {"{buildingNumber}", AddressTokenType::BuildingNumber},
+    {"{street}", AddressTokenType::Street},
+    {"{firstName}", AddressTokenType::FirstName},
+    {"{lastName}", AddressTokenType::LastName},
+    {"{streetSuffix}", AddressTokenType::StreetSuffix},
+});
+
+/**
+ * Splits a format such as "{buildingNumber} {street}" into tokens. Placeholders not in `allowedPlaceholders` fail the
+ * compilation, which keeps a street format from referring to itself.
+ */
+constexpr AddressTemplate compileAddressTemplate(std::string_view format,
+                                                 std::span<const AddressTokenType> allowedPlaceholders)
 {
-    return Helper::arrayElement<std::string>(countries);
+    AddressTemplate addressTemplate;
+
+    const auto addToken = [&addressTemplate](AddressTokenType type, std::string_view literal)
+    {
+        if (addressTemplate.tokenCount == maxAddressTokens)
+        {
+            throw std::invalid_argument("Address format has too many tokens.");
+        }
+
+        addressTemplate.tokens[addressTemplate.tokenCount++] = {type, literal};
+    };
+
+    while (!format.empty())
+    {
+        const auto placeholderStart = format.find('{');
+
+        if (placeholderStart != 0)
+        {
+            addToken(AddressTokenType::Literal, format.substr(0, placeholderStart));
+
+            if (placeholderStart == std::string_view::npos)
+            {
+                break;
+            }
+
+            format.remove_prefix(placeholderStart);
+        }
+
+        const auto placeholderEnd = format.find('}');
+
+        if (placeholderEnd == std::string_view::npos)
+        {
+            throw std::invalid_argument("Address format has an unterminated placeholder.");
+        }
+
+        const auto placeholder = format.substr(0, placeholderEnd + 1);
+        const auto entry = std::ranges::find_if(addressPlaceholders, [placeholder](const auto& addressPlaceholder)
+                                                { return addressPlaceholder.first == placeholder; });
+
+        if (entry == addressPlaceholders.end() ||
+            std::ranges::find(allowedPlaceholders, entry->second) == allowedPlaceholders.end())
+        {
+            throw std::invalid_argument("Address format has an unknown placeholder.");
+        }
+
+        addToken(entry->second, {});
+        format.remove_prefix(placeholder.size());
+    }
+
+    return addressTemplate;
 }
 
-std::string Location::state()
+constexpr auto addressFormatPlaceholders =
+    std::to_array<AddressTokenType>({AddressTokenType::BuildingNumber, AddressTokenType::Street});
+
+constexpr auto streetFormatPlaceholders = std::to_array<AddressTokenType>(
+    {AddressTokenType::FirstName, AddressTokenType::LastName, AddressTokenType::StreetSuffix});
+
+template <std::size_t Size>
+constexpr std::array<AddressTemplate, Size> compileStreetTemplates(const std::array<std::string_view, Size>& formats)
 {
-    return Helper::arrayElement<std::string>(states);
+    std::array<AddressTemplate, Size> streetTemplates{};
+
+    for (std::size_t i = 0; i < Size; i++)
+    {
+        streetTemplates[i] = compileAddressTemplate(formats[i], streetFormatPlaceholders);
+    }
+
+    return streetTemplates;
 }
 
-std::string Location::city(Country country)
+constexpr auto usaStreetTemplates = compileStreetTemplates(usaStreetFormats);
+
+constexpr auto countryToStreetTemplatesMapping =
+    EnumMapBuilder::build<Country, std::span<const AddressTemplate>, Country::Italy>({
+        {Country::Usa, usaStreetTemplates},
+        {Country::Poland, {}},
+        {Country::France, {}},
+        {Country::Germany, {}},
+        {Country::Italy, {}},
+    });
+
+constexpr auto countryToAddressTemplateMapping = EnumMapBuilder::build<Country, AddressTemplate, Country::Italy>({
+    {Country::Usa, compileAddressTemplate(usaAddressFormat, addressFormatPlaceholders)},
+    {Country::Poland, {}},
+    {Country::France, {}},
+    {Country::Germany, {}},
+    {Country::Italy, {}},
+});
+
+constexpr auto countryToStreetSuffixesMapping =
+    EnumMapBuilder::build<Country, std::span<const std::string_view>, Country::Italy>({
+        {Country::Usa, usaStreetSuffixes},
+        {Country::Poland, {}},
+        {Country::France, {}},
+        {Country::Germany, {}},
+        {Country::Italy, {}},
+    });
+
+// Countries without compiled data have empty entries, their data comes from the locale pack registered for them.
+std::shared_ptr<const LocalePack> countryPack(Country country)
 {
-    const auto& cities = countryToCitiesMapping.at(country);
+    auto pack = LocalePackRegistry::find(country);
 
-    return Helper::arrayElement<std::string>(cities);
+    if (!pack)
+    {
+        throw std::out_of_range("Country is not supported.");
+    }
+
+    return pack;
 }
 
-std::string Location::zipCode(Country country)
+/**
+ * Country of one generation. Its pack is looked up on first use and held until the generation ends, so strings of the
+ * pack stay mapped even if the pack is unregistered meanwhile.
+ */
+class CountrySource
 {
-    const auto& zipCodeFormat = countryToZipCodeFormatMapping.at(country);
+public:
+    explicit CountrySource(Country country) : country{country} {}
 
-    std::string zipCode;
+    Country id() const
+    {
+        return country;
+    }
 
-    for (const auto& zipCodeFormatCharacter : zipCodeFormat)
+    const LocalePack& pack()
     {
-        if (zipCodeFormatCharacter == '#')
+        if (!localePack)
         {
-            zipCode += String::numeric(1);
-        }
-        else
-        {
-            zipCode += zipCodeFormatCharacter;
+            localePack = countryPack(country);
         }
+
+        return *localePack;
     }
 
-    return zipCode;
-}
+private:
+    Country country;
+    std::shared_ptr<const LocalePack> localePack;
+};
 
-std::string Location::streetAddress(Country country)
+template <std::size_t Size>
+Dictionary countryDataDictionary(const EnumMap<Country, std::span<const std::string_view>, Size>& mapping,
+                                 CountrySource& source, std::string_view packList)
 {
-    const auto& addressFormat = countryToAddressFormatMapping.at(country);
+    const auto data = mapping.at(source.id());
+
+    if (!data.empty())
+    {
+        return Dictionary{data};
+    }
 
-    const auto addressFormatElements = StringHelper::split(addressFormat, " ");
+    return source.pack().dictionary(packList);
+}
 
-    std::vector<std::string> addressElements;
+std::string_view randomEntry(const Dictionary& dictionary)
+{
+    return dictionary[dictionary.randomIndex()];
+}
 
-    for (const auto& addressFormatElement : addressFormatElements)
+// Formats of packs are only known at run time, so they are compiled every time they are used.
+AddressTemplate packAddressTemplate(CountrySource& source, std::string_view packList,
+                                    std::span<const AddressTokenType> allowedPlaceholders)
+{
+    return compileAddressTemplate(randomEntry(source.pack().dictionary(packList)), allowedPlaceholders);
+}
+
+// Countries with pack data take names from the list of their pack if it has one, other names come from Person.
+template <typename PersonName>
+std::string_view randomName(CountrySource& source, std::string_view packList, PersonName personName)
+{
+    if (countryToAddressTemplateMapping.at(source.id()).empty() && source.pack().contains(packList))
     {
-        if (addressFormatElement == "{buildingNumber}")
-        {
-            addressElements.push_back(buildingNumber(country));
-        }
-        else if (addressFormatElement == "{street}")
-        {
-            addressElements.push_back(street(country));
-        }
+        return randomEntry(source.pack().dictionary(packList));
     }
 
-    return StringHelper::join(addressElements, " ");
+    return personName();
 }
 
-std::string Location::street(Country country)
+void appendBuildingNumber(std::string& output, CountrySource& source)
 {
-    const auto& streetFormats = countryToStreetFormatsMapping.at(country);
+    const auto buildingNumberFormat =
+        randomEntry(countryDataDictionary(countryToBuildingNumberFormatsMapping, source, "buildingNumberFormats"));
 
-    const auto streetFormat = Helper::arrayElement<std::string>(streetFormats);
+    const auto start = output.size();
 
-    const auto streetFormatElements = StringHelper::split(streetFormat, " ");
+    output += buildingNumberFormat;
+
+    // Digits of building numbers and zip codes are never 0.
+    RandomDigits::fillTemplate(std::span{output}.subspan(start), '#', '1');
+}
 
-    std::vector<std::string> streetNameElements;
+void appendStreet(std::string& output, CountrySource& source);
 
-    for (const auto& streetFormatElement : streetFormatElements)
+void appendAddressTemplate(std::string& output, const AddressTemplate& addressTemplate, CountrySource& source)
+{
+    for (std::size_t i = 0; i < addressTemplate.tokenCount; i++)
     {
-        if (streetFormatElement == "{firstName}")
-        {
-            streetNameElements.push_back(Person::firstName());
-        }
-        else if (streetFormatElement == "{lastName}")
+        const auto& token = addressTemplate.tokens[i];
+
+        switch (token.type)
         {
-            streetNameElements.push_back(Person::lastName());
+        case AddressTokenType::Literal:
+            output += token.literal;
+            break;
+        case AddressTokenType::BuildingNumber:
+            appendBuildingNumber(output, source);
+            break;
+        case AddressTokenType::Street:
+            appendStreet(output, source);
+            break;
+        case AddressTokenType::FirstName:
+            output += randomName(source, "firstNames", [] { return Person::firstNameView(); });
+            break;
+        case AddressTokenType::LastName:
+            output += randomName(source, "lastNames", [] { return Person::lastNameView(); });
+            break;
+        case AddressTokenType::StreetSuffix:
+            output += randomEntry(countryDataDictionary(countryToStreetSuffixesMapping, source, "streetSuffixes"));
+            break;
         }
-        else if (streetFormatElement == "{streetSuffix}")
-        {
-            const auto& streetSuffixes = countryToStreetSuffixesMapping.at(country);
+    }
+}
 
-            const auto streetSuffix = Helper::arrayElement<std::string>(streetSuffixes);
+void appendStreet(std::string& output, CountrySource& source)
+{
+    const auto streetTemplates = countryToStreetTemplatesMapping.at(source.id());
 
-            streetNameElements.push_back(streetSuffix);
-        }
+    if (streetTemplates.empty())
+    {
+        appendAddressTemplate(output, packAddressTemplate(source, "streetFormats", streetFormatPlaceholders), source);
+
+        return;
     }
 
-    return StringHelper::join(streetNameElements, " ");
+    appendAddressTemplate(output, streetTemplates[Number::integer<std::size_t>(streetTemplates.size() - 1)], source);
+}
 }
 
-std::string Location::buildingNumber(Country country)
+std::string Location::country()
 {
-    const auto& buildingNumberFormats = countryToBuildingNumberFormatsMapping.at(country);
+    return std::string{countryView()};
+}
 
-    const auto buildingNumberFormat = Helper::arrayElement<std::string>(buildingNumberFormats);
+std::string_view Location::countryView()
+{
+    return Helper::arrayElement<std::string_view>(countries);
+}
 
-    std::string buildingNumber;
+Dictionary Location::countryDictionary()
+{
+    return Dictionary{countries};
+}
+
+std::string Location::state()
+{
+    return std::string{stateView()};
+}
+
+std::string_view Location::stateView()
+{
+    return Helper::arrayElement<std::string_view>(states);
+}
+
+Dictionary Location::stateDictionary()
+{
+    return Dictionary{states};
+}
+
+std::string Location::city(Country country)
+{
+    CountrySource source{country};
+
+    return std::string{randomEntry(countryDataDictionary(countryToCitiesMapping, source, "cities"))};
+}
+
+std::string_view Location::cityView(Country country)
+{
+    const auto cities = cityDictionary(country);
+
+    return cities[cities.randomIndex()];
+}
+
+Dictionary Location::cityDictionary(Country country)
+{
+    CountrySource source{country};
 
-    for (const auto& buildingNumberFormatCharacter : buildingNumberFormat)
+    return countryDataDictionary(countryToCitiesMapping, source, "cities");
+}
+
+std::string Location::zipCode(Country country)
+{
+    const auto zipCodeFormat = countryToZipCodeFormatMapping.at(country);
+
+    if (zipCodeFormat.empty())
     {
-        if (buildingNumberFormatCharacter == '#')
-        {
-            buildingNumber += String::numeric(1);
-        }
-        else
-        {
-            buildingNumber += buildingNumberFormatCharacter;
-        }
+        CountrySource source{country};
+
+        return RandomDigits::fromTemplate(randomEntry(source.pack().dictionary("zipCodeFormats")), '#', '1');
     }
 
-    return buildingNumber;
+    return RandomDigits::fromTemplate(zipCodeFormat, '#', '1');
 }
 
-std::string Location::latitude(Precision precision)
+std::string Location::streetAddress(Country country)
 {
-    const std::floating_point auto latitude = Number::decimal<double>(-90.0, 90.0);
+    const auto& addressTemplate = countryToAddressTemplateMapping.at(country);
 
-    std::stringstream ss;
+    CountrySource source{country};
+    std::string streetAddress;
+
+    if (addressTemplate.empty())
+    {
+        appendAddressTemplate(streetAddress, packAddressTemplate(source, "addressFormats", addressFormatPlaceholders),
+                              source);
+    }
+    else
+    {
+        appendAddressTemplate(streetAddress, addressTemplate, source);
+    }
 
-    ss << std::fixed;
+    return streetAddress;
+}
 
-    ss.precision(PrecisionMapper::toDecimalPlaces(precision));
+std::string Location::street(Country country)
+{
+    CountrySource source{country};
+    std::string street;
 
-    ss << latitude;
+    appendStreet(street, source);
 
-    return ss.str();
+    return street;
 }
 
-std::string Location::longitude(Precision precision)
+std::string Location::buildingNumber(Country country)
 {
-    const std::floating_point auto longitude = Number::decimal<double>(-180.0, 180.0);
+    CountrySource source{country};
+    std::string buildingNumber;
+
+    appendBuildingNumber(buildingNumber, source);
 
-    std::stringstream ss;
+    return buildingNumber;
+}
 
-    ss << std::fixed;
+std::string Location::latitude(Precision precision)
+{
+    const std::floating_point auto latitude = Number::decimal<double>(-90.0, 90.0);
 
-    ss.precision(PrecisionMapper::toDecimalPlaces(precision));
+    return NumberFormatter::fixed(latitude, PrecisionMapper::toDecimalPlaces(precision));
+}
 
-    ss << longitude;
+std::string Location::longitude(Precision precision)
+{
+    const std::floating_point auto longitude = Number::decimal<double>(-180.0, 180.0);
 
-    return ss.str();
+    return NumberFormatter::fixed(longitude, PrecisionMapper::toDecimalPlaces(precision));
 }
 
 }
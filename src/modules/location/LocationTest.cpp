@@ -37,7 +37,7 @@ TEST_F(LocationTest, shouldGenerateCountry)
     const auto generatedCountry = Location::country();
 
     ASSERT_TRUE(std::any_of(countries.begin(), countries.end(),
-                            [generatedCountry](const std::string& country) { return country == generatedCountry; }));
+                            [generatedCountry](std::string_view country) { return country == generatedCountry; }));
 }
 
 TEST_F(LocationTest, shouldGenerateState)
@@ -45,7 +45,7 @@ TEST_F(LocationTest, shouldGenerateState)
     const auto generatedState = Location::state();
 
     ASSERT_TRUE(std::any_of(states.begin(), states.end(),
-                            [generatedState](const std::string& state) { return state == generatedState; }));
+                            [generatedState](std::string_view state) { return state == generatedState; }));
 }
 
 TEST_F(LocationTest, shouldGenerateUsaCity)
@@ -53,7 +53,18 @@ TEST_F(LocationTest, shouldGenerateUsaCity)
     const auto generatedCity = Location::city();
 
     ASSERT_TRUE(std::any_of(usaCities.begin(), usaCities.end(),
-                            [generatedCity](const std::string& city) { return city == generatedCity; }));
+                            [generatedCity](std::string_view city) { return city == generatedCity; }));
+}
+
+TEST_F(LocationTest, shouldGenerateStateAndCityViews)
+{
+    const auto generatedState = Location::stateView();
+    const auto generatedCity = Location::cityView();
+
+    ASSERT_TRUE(std::any_of(states.begin(), states.end(),
+                            [generatedState](std::string_view state) { return state == generatedState; }));
+    ASSERT_TRUE(std::any_of(usaCities.begin(), usaCities.end(),
+                            [generatedCity](std::string_view city) { return city == generatedCity; }));
 }
 
 TEST_F(LocationTest, shouldGenerateUsaZipCode)
@@ -81,18 +92,18 @@ TEST_F(LocationTest, shouldGenerateUsaStreet)
     const auto& generatedFirstOrLastName = generatedStreetElements[0];
     const auto& generatedStreetSuffix = generatedStreetElements[1];
 
-    std::vector<std::string> firstNames{firstNamesMales};
+    std::vector<std::string_view> firstNames(firstNamesMales.begin(), firstNamesMales.end());
     firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
     ASSERT_EQ(generatedStreetElements.size(), 2);
     ASSERT_TRUE(std::any_of(firstNames.begin(), firstNames.end(),
-                            [generatedFirstOrLastName](const std::string& firstName)
+                            [generatedFirstOrLastName](std::string_view firstName)
                             { return firstName == generatedFirstOrLastName; }) ||
                 std::any_of(lastNames.begin(), lastNames.end(),
-                            [generatedFirstOrLastName](const std::string& lastName)
+                            [generatedFirstOrLastName](std::string_view lastName)
                             { return lastName == generatedFirstOrLastName; }));
     ASSERT_TRUE(std::any_of(usaStreetSuffixes.begin(), usaStreetSuffixes.end(),
-                            [generatedStreetSuffix](const std::string& streetSuffix)
+                            [generatedStreetSuffix](std::string_view streetSuffix)
                             { return streetSuffix == generatedStreetSuffix; }));
 }
 
@@ -106,23 +117,30 @@ TEST_F(LocationTest, shouldGenerateUsaStreetAddress)
     const auto& generatedFirstOrLastName = generatedStreetAddressElements[1];
     const auto& generatedStreetSuffix = generatedStreetAddressElements[2];
 
-    std::vector<std::string> firstNames{firstNamesMales};
+    std::vector<std::string_view> firstNames(firstNamesMales.begin(), firstNamesMales.end());
     firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
     ASSERT_EQ(generatedStreetAddressElements.size(), 3);
     ASSERT_TRUE(generatedBuildingNumber.size() >= 3 && generatedBuildingNumber.size() <= 5);
     ASSERT_TRUE(checkIfAllCharactersAreNumeric(generatedBuildingNumber));
     ASSERT_TRUE(std::any_of(firstNames.begin(), firstNames.end(),
-                            [generatedFirstOrLastName](const std::string& firstName)
+                            [generatedFirstOrLastName](std::string_view firstName)
                             { return firstName == generatedFirstOrLastName; }) ||
                 std::any_of(lastNames.begin(), lastNames.end(),
-                            [generatedFirstOrLastName](const std::string& lastName)
+                            [generatedFirstOrLastName](std::string_view lastName)
                             { return lastName == generatedFirstOrLastName; }));
     ASSERT_TRUE(std::any_of(usaStreetSuffixes.begin(), usaStreetSuffixes.end(),
-                            [generatedStreetSuffix](const std::string& streetSuffix)
+                            [generatedStreetSuffix](std::string_view streetSuffix)
                             { return streetSuffix == generatedStreetSuffix; }));
 }
 
+TEST_F(LocationTest, shouldThrowForCountryWithoutAddressData)
+{
+    ASSERT_THROW(Location::streetAddress(Country::Poland), std::out_of_range);
+    ASSERT_THROW(Location::street(Country::France), std::out_of_range);
+    ASSERT_THROW(Location::buildingNumber(Country::Italy), std::out_of_range);
+}
+
 TEST_F(LocationTest, shouldGenerateLatitude)
 {
     const auto latitude = Location::latitude();
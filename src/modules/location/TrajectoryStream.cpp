@@ -0,0 +1,271 @@
+#include "faker-cxx/TrajectoryStream.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <numeric>
+#include <stdexcept>
+
+#include "faker-cxx/Number.h"
+
+namespace faker
+{
+namespace
+{
+constexpr double degreesPerRadian = 180.0 / std::numbers::pi;
+constexpr double kilometersPerDegree = 111.32;
+// East-west distances close to a pole are scaled as if they were at about 89.9 degrees of latitude.
+constexpr double minLatitudeCosine = 0.002;
+// Time in which the speed of an object drifts most of the way back to the mean speed.
+constexpr double speedReversionSeconds = 60.0;
+
+// Uniform in [0, 1), from the 53 high bits of a 64-bit draw.
+double randomUnit()
+{
+    return static_cast<double>(Number::integer<std::uint64_t>(std::numeric_limits<std::uint64_t>::max()) >> 11) *
+           0x1.0p-53;
+}
+
+// Box-Muller transform of pairs of uniforms drawn first, every pair gives two independent standard normal numbers.
+void fillStandardNormal(std::span<double> values)
+{
+    for (auto& value : values)
+    {
+        value = randomUnit();
+    }
+
+    for (std::size_t i = 0; i + 1 < values.size(); i += 2)
+    {
+        const auto distance = std::sqrt(-2.0 * std::log1p(-values[i]));
+        const auto angle = 2.0 * std::numbers::pi * values[i + 1];
+
+        values[i] = distance * std::cos(angle);
+        values[i + 1] = distance * std::sin(angle);
+    }
+
+    if (values.size() % 2 == 1)
+    {
+        values.back() = std::sqrt(-2.0 * std::log1p(-values.back())) * std::cos(2.0 * std::numbers::pi * randomUnit());
+    }
+}
+
+double wrapLongitude(double longitude)
+{
+    return longitude - 360.0 * std::floor((longitude + 180.0) / 360.0);
+}
+
+double kilometersPerLongitudeDegree(double latitude)
+{
+    return kilometersPerDegree * std::max(std::cos(latitude / degreesPerRadian), minLatitudeCosine);
+}
+}
+
+TrajectoryStream::TrajectoryStream(const GeoPointGenerator& area, std::uint32_t objectCount, TimePoint from,
+                                   std::chrono::nanoseconds pingInterval, TrajectoryMotion motion)
+    : area{area},
+      from{from},
+      pingInterval{pingInterval},
+      motion{motion},
+      latitudes(objectCount),
+      longitudes(objectCount),
+      headings(objectCount),
+      speeds(objectCount),
+      targetLatitudes(objectCount),
+      targetLongitudes(objectCount),
+      offsets(objectCount),
+      pingOrder(objectCount),
+      speedNoise(objectCount),
+      headingNoise(objectCount),
+      latitudeSteps(objectCount),
+      longitudeSteps(objectCount),
+      interval{0},
+      position{0}
+{
+    if (objectCount == 0)
+    {
+        throw std::invalid_argument("At least one object is required.");
+    }
+
+    if (pingInterval <= std::chrono::nanoseconds::zero())
+    {
+        throw std::invalid_argument("Ping interval must be positive.");
+    }
+
+    if (motion.meanSpeedKmh < 0 || motion.speedDeviationKmh < 0 || motion.headingDeviationDegrees < 0)
+    {
+        throw std::invalid_argument("Speeds and deviations must not be negative.");
+    }
+
+    area.fill(latitudes, longitudes);
+    area.fill(targetLatitudes, targetLongitudes);
+    fillStandardNormal(speeds);
+
+    for (std::uint32_t i = 0; i < objectCount; i++)
+    {
+        headings[i] = Number::decimal<double>(0.0, 2.0 * std::numbers::pi);
+        speeds[i] = std::max(motion.meanSpeedKmh + motion.speedDeviationKmh * speeds[i], 0.0);
+        offsets[i] = std::chrono::nanoseconds{Number::integer<std::int64_t>(pingInterval.count() - 1)};
+    }
+
+    std::iota(pingOrder.begin(), pingOrder.end(), 0);
+    std::ranges::sort(pingOrder, {}, [this](std::uint32_t objectId) { return offsets[objectId]; });
+}
+
+TrajectoryPing TrajectoryStream::next()
+{
+    if (position == pingOrder.size())
+    {
+        step();
+
+        interval++;
+        position = 0;
+    }
+
+    const auto objectId = pingOrder[position++];
+
+    return {objectId, from + pingInterval * static_cast<std::int64_t>(interval) + offsets[objectId],
+            latitudes[objectId], longitudes[objectId]};
+}
+
+std::size_t TrajectoryStream::nextChunk(std::span<TrajectoryPing> chunk)
+{
+    for (auto& ping : chunk)
+    {
+        ping = next();
+    }
+
+    return chunk.size();
+}
+
+// Every object moves for one interval. Random numbers, calls into libm and waypoint arrivals are handled in scalar
+// passes of their own, the passes updating speeds, headings and positions are arithmetic that compilers vectorize.
+void TrajectoryStream::step()
+{
+    const auto seconds = std::chrono::duration<double>{pingInterval}.count();
+    const auto hours = seconds / 3600.0;
+
+    fillStandardNormal(speedNoise);
+
+    // Ornstein-Uhlenbeck process, which keeps the deviation of speeds from the mean speed stable over time.
+    const auto meanSpeed = motion.meanSpeedKmh;
+    const auto speedDecay = std::exp(-seconds / speedReversionSeconds);
+    const auto speedNoiseScale = motion.speedDeviationKmh * std::sqrt(1.0 - speedDecay * speedDecay);
+
+    for (std::size_t i = 0; i < speeds.size(); i++)
+    {
+        speeds[i] = std::max(meanSpeed + (speeds[i] - meanSpeed) * speedDecay + speedNoiseScale * speedNoise[i], 0.0);
+    }
+
+    if (motion.model == TrajectoryModel::RandomWalk)
+    {
+        fillStandardNormal(headingNoise);
+
+        const auto headingNoiseScale = motion.headingDeviationDegrees / degreesPerRadian * std::sqrt(seconds);
+
+        for (std::size_t i = 0; i < headings.size(); i++)
+        {
+            headings[i] += headingNoiseScale * headingNoise[i];
+        }
+
+        for (std::size_t i = 0; i < latitudes.size(); i++)
+        {
+            const auto distance = speeds[i] * hours;
+
+            latitudeSteps[i] = distance * std::cos(headings[i]) / kilometersPerDegree;
+            longitudeSteps[i] =
+                wrapLongitude(distance * std::sin(headings[i]) / kilometersPerLongitudeDegree(latitudes[i]));
+        }
+
+        move();
+
+        return;
+    }
+
+    arrivals.clear();
+
+    for (std::size_t i = 0; i < latitudes.size(); i++)
+    {
+        const auto distance = speeds[i] * hours;
+
+        const auto latitudeDelta = targetLatitudes[i] - latitudes[i];
+        const auto longitudeDelta = wrapLongitude(targetLongitudes[i] - longitudes[i]);
+        const auto northKm = latitudeDelta * kilometersPerDegree;
+        const auto eastKm = longitudeDelta * kilometersPerLongitudeDegree(latitudes[i]);
+        const auto remainingKm = std::hypot(northKm, eastKm);
+
+        headings[i] = std::atan2(eastKm, northKm);
+
+        auto fraction = 1.0;
+
+        if (remainingKm > distance)
+        {
+            fraction = distance / remainingKm;
+        }
+        else
+        {
+            arrivals.push_back({static_cast<std::uint32_t>(i), distance - remainingKm});
+        }
+
+        latitudeSteps[i] = latitudeDelta * fraction;
+        longitudeSteps[i] = longitudeDelta * fraction;
+    }
+
+    move();
+
+    // Objects reaching their waypoint travel the rest of the distance of the step towards the next one, passing any
+    // further waypoints reached within it.
+    for (auto [objectId, leftoverKm] : arrivals)
+    {
+        while (true)
+        {
+            latitudes[objectId] = targetLatitudes[objectId];
+            longitudes[objectId] = targetLongitudes[objectId];
+
+            const auto [targetLatitude, targetLongitude] = area.next();
+
+            targetLatitudes[objectId] = targetLatitude;
+            targetLongitudes[objectId] = targetLongitude;
+
+            const auto latitudeDelta = targetLatitude - latitudes[objectId];
+            const auto longitudeDelta = wrapLongitude(targetLongitude - longitudes[objectId]);
+            const auto northKm = latitudeDelta * kilometersPerDegree;
+            const auto eastKm = longitudeDelta * kilometersPerLongitudeDegree(latitudes[objectId]);
+            const auto remainingKm = std::hypot(northKm, eastKm);
+
+            headings[objectId] = std::atan2(eastKm, northKm);
+
+            // An area of a single point has no next waypoint to head to.
+            if (remainingKm > leftoverKm || remainingKm == 0.0)
+            {
+                const auto fraction = remainingKm == 0.0 ? 0.0 : leftoverKm / remainingKm;
+
+                latitudes[objectId] += latitudeDelta * fraction;
+                longitudes[objectId] = wrapLongitude(longitudes[objectId] + longitudeDelta * fraction);
+
+                break;
+            }
+
+            leftoverKm -= remainingKm;
+        }
+    }
+}
+
+// Steps are at most half a turn of longitude, so positions stay within a turn of the range and truncating their turns
+// after an offset of one turn rounds them down.
+void TrajectoryStream::move()
+{
+    for (std::size_t i = 0; i < latitudes.size(); i++)
+    {
+        latitudes[i] = std::clamp(latitudes[i] + latitudeSteps[i], -90.0, 90.0);
+    }
+
+    for (std::size_t i = 0; i < longitudes.size(); i++)
+    {
+        const auto longitude = longitudes[i] + longitudeSteps[i];
+        const auto turns = static_cast<double>(static_cast<std::int32_t>((longitude + 180.0) / 360.0 + 1.0)) - 1.0;
+
+        longitudes[i] = longitude - 360.0 * turns;
+    }
+}
+}
@@ -0,0 +1,129 @@
+#include "faker-cxx/TrajectoryStream.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+class TrajectoryStreamTest : public Test
+{
+public:
+    const GeoPointGenerator city = GeoPointGenerator::boundingBox({52.1, 52.4, 20.8, 21.3});
+    const TrajectoryStream::TimePoint from = std::chrono::sys_days{std::chrono::year{2024} / 1 / 1};
+};
+
+TEST_F(TrajectoryStreamTest, shouldEmitPingsInTimeOrder)
+{
+    TrajectoryStream stream{city, 100, from, std::chrono::seconds{1}};
+
+    std::vector<TrajectoryPing> pings(1000);
+
+    ASSERT_EQ(stream.nextChunk(pings), pings.size());
+
+    ASSERT_GE(pings.front().timestamp, from);
+    ASSERT_TRUE(std::ranges::is_sorted(pings, {}, &TrajectoryPing::timestamp));
+}
+
+TEST_F(TrajectoryStreamTest, shouldPingEveryObjectOncePerInterval)
+{
+    const auto pingInterval = std::chrono::milliseconds{500};
+
+    TrajectoryStream stream{city, 50, from, pingInterval};
+
+    std::vector<TrajectoryStream::TimePoint> lastPings(50);
+
+    for (int interval = 0; interval < 10; interval++)
+    {
+        std::vector<int> pingCounts(50);
+
+        for (int i = 0; i < 50; i++)
+        {
+            const auto ping = stream.next();
+
+            ASSERT_LT(ping.objectId, 50);
+
+            if (interval > 0)
+            {
+                ASSERT_EQ(ping.timestamp - lastPings[ping.objectId], pingInterval);
+            }
+
+            lastPings[ping.objectId] = ping.timestamp;
+            pingCounts[ping.objectId]++;
+        }
+
+        ASSERT_TRUE(std::ranges::all_of(pingCounts, [](int count) { return count == 1; }));
+    }
+}
+
+TEST_F(TrajectoryStreamTest, shouldMoveObjectsAtRealisticSpeed)
+{
+    TrajectoryStream stream{city, 20, from, std::chrono::seconds{10}, {TrajectoryModel::RandomWalk, 50.0, 10.0}};
+
+    std::vector<TrajectoryPing> previous(20);
+
+    for (int i = 0; i < 20; i++)
+    {
+        const auto ping = stream.next();
+        previous[ping.objectId] = ping;
+    }
+
+    for (int i = 0; i < 2000; i++)
+    {
+        const auto ping = stream.next();
+        const auto& last = previous[ping.objectId];
+
+        const auto northKm = (ping.latitude - last.latitude) * 111.32;
+        const auto eastKm =
+            (ping.longitude - last.longitude) * 111.32 * std::cos(last.latitude * std::numbers::pi / 180.0);
+
+        // 10 seconds at 50 km/h is about 0.14 km, speeds beyond 8 deviations above the mean are not expected.
+        ASSERT_LT(std::hypot(northKm, eastKm), 130.0 / 360.0);
+
+        previous[ping.objectId] = ping;
+    }
+}
+
+TEST_F(TrajectoryStreamTest, shouldKeepWaypointTrajectoriesInArea)
+{
+    TrajectoryStream stream{city, 10, from, std::chrono::seconds{30}, {TrajectoryModel::Waypoint, 300.0, 50.0}};
+
+    for (int i = 0; i < 20000; i++)
+    {
+        const auto ping = stream.next();
+
+        ASSERT_GE(ping.latitude, 52.1 - 1e-9);
+        ASSERT_LE(ping.latitude, 52.4 + 1e-9);
+        ASSERT_GE(ping.longitude, 20.8 - 1e-9);
+        ASSERT_LE(ping.longitude, 21.3 + 1e-9);
+    }
+}
+
+TEST_F(TrajectoryStreamTest, shouldStayAtWaypointOfSinglePointArea)
+{
+    const auto point = GeoPointGenerator::boundingBox({52.2, 52.2, 21.0, 21.0});
+
+    TrajectoryStream stream{point, 10, from, std::chrono::seconds{30}, {TrajectoryModel::Waypoint}};
+
+    for (int i = 0; i < 1000; i++)
+    {
+        const auto ping = stream.next();
+
+        ASSERT_NEAR(ping.latitude, 52.2, 1e-9);
+        ASSERT_NEAR(ping.longitude, 21.0, 1e-9);
+    }
+}
+
+TEST_F(TrajectoryStreamTest, shouldRejectInvalidArguments)
+{
+    ASSERT_THROW(TrajectoryStream(city, 0, from, std::chrono::seconds{1}), std::invalid_argument);
+    ASSERT_THROW(TrajectoryStream(city, 10, from, std::chrono::seconds{0}), std::invalid_argument);
+    ASSERT_THROW(TrajectoryStream(city, 10, from, std::chrono::seconds{1}, {TrajectoryModel::RandomWalk, -1.0}),
+                 std::invalid_argument);
+}
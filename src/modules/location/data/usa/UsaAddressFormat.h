@@ -1,16 +1,16 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::string usaAddressFormat = "{buildingNumber} {street}";
+inline constexpr std::string_view usaAddressFormat = "{buildingNumber} {street}";
 
-const std::vector<std::string> usaBuildingNumberFormats = {"#####", "####", "###"};
+inline constexpr auto usaBuildingNumberFormats = std::to_array<std::string_view>({"#####", "####", "###"});
 
-const std::string usaZipCodeFormat = "#####";
-
-const std::vector<std::string> usaStreetFormats = {"{firstName} {streetSuffix}", "{lastName} {streetSuffix}"};
+inline constexpr std::string_view usaZipCodeFormat = "#####";
 
+inline constexpr auto usaStreetFormats = std::to_array<std::string_view>({
+    "{firstName} {streetSuffix}", "{lastName} {streetSuffix}"});
 }
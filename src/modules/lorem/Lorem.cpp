@@ -8,7 +8,17 @@ namespace faker
 {
 std::string Lorem::word()
 {
-    return Helper::arrayElement<std::string>(loremWords);
+    return std::string{wordView()};
+}
+
+std::string_view Lorem::wordView()
+{
+    return Helper::arrayElement<std::string_view>(loremWords);
+}
+
+Dictionary Lorem::wordDictionary()
+{
+    return Dictionary{loremWords};
 }
 
 std::string Lorem::words(unsigned numberOfWords)
@@ -20,7 +20,15 @@ TEST_F(LoremTest, shouldGenerateWord)
     const auto generatedWord = Lorem::word();
 
     ASSERT_TRUE(std::any_of(loremWords.begin(), loremWords.end(),
-                            [generatedWord](const std::string& word) { return word == generatedWord; }));
+                            [generatedWord](std::string_view word) { return word == generatedWord; }));
+}
+
+TEST_F(LoremTest, shouldGenerateWordView)
+{
+    const auto generatedWord = Lorem::wordView();
+
+    ASSERT_TRUE(std::any_of(loremWords.begin(), loremWords.end(),
+                            [generatedWord](std::string_view word) { return word == generatedWord; }));
 }
 
 TEST_F(LoremTest, shouldGenerateWords)
@@ -36,7 +44,7 @@ TEST_F(LoremTest, shouldGenerateWords)
                             [](const std::string& separatedWord)
                             {
                                 return std::any_of(loremWords.begin(), loremWords.end(),
-                                                   [separatedWord](const std::string& word) {
+                                                   [separatedWord](std::string_view word) {
                                                        return word ==
                                                               static_cast<char>(std::tolower(separatedWord[0])) +
                                                                   separatedWord.substr(1);
@@ -59,7 +67,7 @@ TEST_F(LoremTest, shouldGenerateSentence)
                             [](const std::string& sentenceWord)
                             {
                                 return std::any_of(loremWords.begin(), loremWords.end(),
-                                                   [sentenceWord](const std::string& word) {
+                                                   [sentenceWord](std::string_view word) {
                                                        return word == static_cast<char>(std::tolower(sentenceWord[0])) +
                                                                           sentenceWord.substr(1);
                                                    });
@@ -86,7 +94,7 @@ TEST_F(LoremTest, shouldGenerateSentences)
                                 [](const std::string& sentenceWord)
                                 {
                                     return std::any_of(loremWords.begin(), loremWords.end(),
-                                                       [sentenceWord](const std::string& word) {
+                                                       [sentenceWord](std::string_view word) {
                                                            return word ==
                                                                   static_cast<char>(std::tolower(sentenceWord[0])) +
                                                                       sentenceWord.substr(1);
@@ -106,7 +114,7 @@ TEST_F(LoremTest, shouldGenerateSlug)
                             [](const std::string& separatedWord)
                             {
                                 return std::any_of(loremWords.begin(), loremWords.end(),
-                                                   [separatedWord](const std::string& word) {
+                                                   [separatedWord](std::string_view word) {
                                                        return word ==
                                                               static_cast<char>(std::tolower(separatedWord[0])) +
                                                                   separatedWord.substr(1);
@@ -134,7 +142,7 @@ TEST_F(LoremTest, shouldGenerateParagraph)
                                 [](const std::string& sentenceWord)
                                 {
                                     return std::any_of(loremWords.begin(), loremWords.end(),
-                                                       [sentenceWord](const std::string& word) {
+                                                       [sentenceWord](std::string_view word) {
                                                            return word ==
                                                                   static_cast<char>(std::tolower(sentenceWord[0])) +
                                                                       sentenceWord.substr(1);
@@ -167,7 +175,7 @@ TEST_F(LoremTest, shouldGenerateParagraphs)
                                     [](const std::string& sentenceWord)
                                     {
                                         return std::any_of(loremWords.begin(), loremWords.end(),
-                                                           [sentenceWord](const std::string& word) {
+                                                           [sentenceWord](std::string_view word) {
                                                                return word ==
                                                                       static_cast<char>(std::tolower(sentenceWord[0])) +
                                                                           sentenceWord.substr(1);
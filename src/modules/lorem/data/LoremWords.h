@@ -1,11 +1,11 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> loremWords = {
+inline constexpr auto loremWords = std::to_array<std::string_view>({
     "alias",
     "consequatur",
     "aut",
@@ -188,5 +188,5 @@ const std::vector<std::string> loremWords = {
     "doloribus",
     "asperiores",
     "repellat",
-};
+});
 }
@@ -1,6 +1,6 @@
 #include "faker-cxx/Number.h"
 
-#include <sstream>
+#include "../../common/NumberFormatter.h"
 
 namespace faker
 {
@@ -27,10 +27,8 @@ std::string Number::hex(std::optional<int> min, std::optional<int> max)
 
 std::string Number::convertToHex(int number)
 {
-    std::stringstream sstream;
-    sstream << std::hex << number;
-    std::string hexString = sstream.str();
-    return hexString;
+    // Negative numbers are formatted as their two's complement, as std::hex streams them.
+    return NumberFormatter::format(static_cast<unsigned>(number), 16);
 }
 
 }
@@ -0,0 +1,267 @@
+#include "faker-cxx/SortedUniqueIntegers.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <string_view>
+
+#include "faker-cxx/Number.h"
+
+namespace faker
+{
+namespace
+{
+// Method D switches to sequential search once the sample takes more than 1/13 of the remaining range.
+constexpr std::uint64_t sequentialSearchRatio = 13;
+
+constexpr std::string_view keyDigits = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+constexpr std::string_view hexKeyDigits = "0123456789abcdef";
+
+// Uniform value in range (0, 1], so that its logarithm is finite.
+double positiveUniform()
+{
+    return 1.0 - Number::decimal<double>(0.0, 1.0);
+}
+
+unsigned encodingBase(KeyEncoding encoding)
+{
+    switch (encoding)
+    {
+    case KeyEncoding::Decimal:
+        return 10;
+    case KeyEncoding::Hex:
+        return 16;
+    case KeyEncoding::Base62:
+        return 62;
+    }
+
+    throw std::invalid_argument("Unknown key encoding.");
+}
+
+unsigned digitCount(std::uint64_t value, unsigned base)
+{
+    unsigned count = 1;
+
+    while (value >= base)
+    {
+        value /= base;
+        count++;
+    }
+
+    return count;
+}
+}
+
+SortedUniqueIntegers::SortedUniqueIntegers(std::uint64_t min, std::uint64_t max, std::uint64_t count)
+    : nextCandidate{min}, remainingCount{count}, remainingRange{max > min ? max - min : 0}
+{
+    if (max < min || count > remainingRange)
+    {
+        throw std::invalid_argument("Range must contain at least as many values as requested.");
+    }
+}
+
+bool SortedUniqueIntegers::hasNext() const
+{
+    return remainingCount > 0;
+}
+
+std::uint64_t SortedUniqueIntegers::next()
+{
+    if (!hasNext())
+    {
+        throw std::out_of_range("All values of the sample were already returned.");
+    }
+
+    const auto skippedCount = skip();
+    const auto value = nextCandidate + skippedCount;
+
+    nextCandidate = value + 1;
+    remainingRange -= skippedCount + 1;
+    remainingCount--;
+
+    return value;
+}
+
+std::size_t SortedUniqueIntegers::nextChunk(std::span<std::uint64_t> chunk)
+{
+    std::size_t size = 0;
+
+    while (size < chunk.size() && hasNext())
+    {
+        chunk[size++] = next();
+    }
+
+    return size;
+}
+
+std::uint64_t SortedUniqueIntegers::remaining() const
+{
+    return remainingCount;
+}
+
+std::uint64_t SortedUniqueIntegers::skip() const
+{
+    if (remainingCount == 1)
+    {
+        return Number::integer<std::uint64_t>(remainingRange - 1);
+    }
+
+    if (remainingCount * sequentialSearchRatio >= remainingRange)
+    {
+        return skipBySequentialSearch();
+    }
+
+    return skipByRejection();
+}
+
+// Vitter's method A, walks the distribution of the skip until it exceeds a uniform value.
+std::uint64_t SortedUniqueIntegers::skipBySequentialSearch() const
+{
+    const auto uniform = Number::decimal<double>(0.0, 1.0);
+
+    auto top = static_cast<double>(remainingRange - remainingCount);
+    auto range = static_cast<double>(remainingRange);
+    auto quotient = top / range;
+
+    std::uint64_t skippedCount = 0;
+
+    while (quotient > uniform)
+    {
+        skippedCount++;
+        top--;
+        range--;
+        quotient = quotient * top / range;
+    }
+
+    return skippedCount;
+}
+
+// Vitter's method D, draws the skip from a continuous approximation of its distribution and accepts it by rejection.
+std::uint64_t SortedUniqueIntegers::skipByRejection() const
+{
+    const auto count = static_cast<double>(remainingCount);
+    const auto range = static_cast<double>(remainingRange);
+    const auto countInverse = 1.0 / count;
+    const auto countMinusOneInverse = 1.0 / (count - 1);
+    const auto candidateLimit = remainingRange - remainingCount + 1;
+    const auto candidateLimitReal = static_cast<double>(candidateLimit);
+
+    auto vPrime = std::exp(std::log(positiveUniform()) * countInverse);
+
+    while (true)
+    {
+        double x{};
+        std::uint64_t skippedCount{};
+
+        while (true)
+        {
+            x = range * (1.0 - vPrime);
+            skippedCount = static_cast<std::uint64_t>(x);
+
+            if (skippedCount < candidateLimit)
+            {
+                break;
+            }
+
+            vPrime = std::exp(std::log(positiveUniform()) * countInverse);
+        }
+
+        const auto skippedCountReal = static_cast<double>(skippedCount);
+        const auto y1 = std::exp(std::log(positiveUniform() * range / candidateLimitReal) * countMinusOneInverse);
+
+        vPrime = y1 * (1.0 - x / range) * (candidateLimitReal / (candidateLimitReal - skippedCountReal));
+
+        if (vPrime <= 1.0)
+        {
+            return skippedCount;
+        }
+
+        double y2 = 1.0;
+        double top = range - 1.0;
+        double bottom{};
+        std::uint64_t limit{};
+
+        if (remainingCount - 1 > skippedCount)
+        {
+            bottom = range - count;
+            limit = remainingRange - skippedCount;
+        }
+        else
+        {
+            bottom = range - skippedCountReal - 1.0;
+            limit = candidateLimit;
+        }
+
+        for (auto t = remainingRange - 1; t >= limit; t--)
+        {
+            y2 = y2 * top / bottom;
+            top--;
+            bottom--;
+        }
+
+        if (range / (range - x) >= y1 * std::exp(std::log(y2) * countMinusOneInverse))
+        {
+            return skippedCount;
+        }
+
+        vPrime = std::exp(std::log(positiveUniform()) * countInverse);
+    }
+}
+
+SortedKeys::SortedKeys(std::uint64_t min, std::uint64_t max, std::uint64_t count, KeyEncoding encoding,
+                       std::optional<unsigned> width)
+    : values{min, max, count}, base{encodingBase(encoding)}
+{
+    const auto requiredWidth = digitCount(max > min ? max - 1 : min, base);
+
+    keyWidth = width ? *width : requiredWidth;
+
+    if (keyWidth < requiredWidth)
+    {
+        throw std::invalid_argument("Key width is too small for values of the range.");
+    }
+}
+
+bool SortedKeys::hasNext() const
+{
+    return values.hasNext();
+}
+
+std::string SortedKeys::next()
+{
+    std::string key(keyWidth, '0');
+
+    encode(values.next(), key.data());
+
+    return key;
+}
+
+std::size_t SortedKeys::nextChunk(std::span<char> keys)
+{
+    std::size_t size = 0;
+
+    while ((size + 1) * keyWidth <= keys.size() && hasNext())
+    {
+        encode(values.next(), keys.data() + size * keyWidth);
+        size++;
+    }
+
+    return size;
+}
+
+unsigned SortedKeys::width() const
+{
+    return keyWidth;
+}
+
+void SortedKeys::encode(std::uint64_t value, char* key) const
+{
+    const auto digits = base == 16 ? hexKeyDigits : keyDigits;
+
+    for (auto i = keyWidth; i > 0; i--)
+    {
+        key[i - 1] = digits[value % base];
+        value /= base;
+    }
+}
+}
@@ -0,0 +1,153 @@
+#include "faker-cxx/SortedUniqueIntegers.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+class SortedUniqueIntegersTest : public Test
+{
+public:
+    static std::vector<std::uint64_t> generateAll(SortedUniqueIntegers& integers)
+    {
+        std::vector<std::uint64_t> values;
+
+        while (integers.hasNext())
+        {
+            values.push_back(integers.next());
+        }
+
+        return values;
+    }
+
+    static void expectUniformBuckets(std::uint64_t rangeSize, std::uint64_t count)
+    {
+        constexpr std::size_t numberOfBuckets = 10;
+        constexpr int numberOfSamples = 2000;
+
+        std::array<int, numberOfBuckets> buckets{};
+
+        for (int i = 0; i < numberOfSamples; i++)
+        {
+            SortedUniqueIntegers integers{0, rangeSize, count};
+
+            for (const auto value : generateAll(integers))
+            {
+                buckets[value * numberOfBuckets / rangeSize]++;
+            }
+        }
+
+        const auto expectedBucketSize = static_cast<double>(numberOfSamples * count) / numberOfBuckets;
+
+        for (const auto bucket : buckets)
+        {
+            EXPECT_NEAR(bucket, expectedBucketSize, expectedBucketSize * 0.15);
+        }
+    }
+};
+
+TEST_F(SortedUniqueIntegersTest, shouldGenerateSortedUniqueIntegersWithinRange)
+{
+    SortedUniqueIntegers integers{1000, 1000000000000, 10000};
+
+    const auto values = generateAll(integers);
+
+    ASSERT_EQ(values.size(), 10000);
+    ASSERT_TRUE(std::adjacent_find(values.begin(), values.end(), std::greater_equal<>()) == values.end());
+    ASSERT_GE(values.front(), 1000);
+    ASSERT_LT(values.back(), 1000000000000);
+}
+
+TEST_F(SortedUniqueIntegersTest, shouldGenerateWholeRangeWhenCountEqualsRangeSize)
+{
+    SortedUniqueIntegers integers{5, 105, 100};
+
+    const auto values = generateAll(integers);
+
+    ASSERT_EQ(values.size(), 100);
+
+    for (std::uint64_t i = 0; i < values.size(); i++)
+    {
+        ASSERT_EQ(values[i], 5 + i);
+    }
+}
+
+TEST_F(SortedUniqueIntegersTest, shouldSampleDenseRangesUniformly)
+{
+    expectUniformBuckets(100, 20);
+}
+
+TEST_F(SortedUniqueIntegersTest, shouldSampleSparseRangesUniformly)
+{
+    expectUniformBuckets(1000000, 20);
+}
+
+TEST_F(SortedUniqueIntegersTest, shouldGenerateIntegersInChunks)
+{
+    SortedUniqueIntegers integers{0, 1000, 250};
+
+    std::array<std::uint64_t, 100> chunk{};
+
+    ASSERT_EQ(integers.nextChunk(chunk), 100);
+    ASSERT_EQ(integers.remaining(), 150);
+    ASSERT_EQ(integers.nextChunk(chunk), 100);
+    ASSERT_EQ(integers.nextChunk(chunk), 50);
+    ASSERT_EQ(integers.nextChunk(chunk), 0);
+    ASSERT_THROW(integers.next(), std::out_of_range);
+}
+
+TEST_F(SortedUniqueIntegersTest, shouldThrowWhenRangeIsSmallerThanCount)
+{
+    ASSERT_THROW(SortedUniqueIntegers(0, 10, 11), std::invalid_argument);
+    ASSERT_THROW(SortedUniqueIntegers(10, 0, 1), std::invalid_argument);
+}
+
+TEST_F(SortedUniqueIntegersTest, shouldGenerateSortedFixedWidthKeys)
+{
+    for (const auto encoding : {KeyEncoding::Decimal, KeyEncoding::Hex, KeyEncoding::Base62})
+    {
+        SortedKeys keys{0, 1000000000, 1000, encoding};
+
+        std::vector<std::string> generatedKeys;
+
+        while (keys.hasNext())
+        {
+            generatedKeys.push_back(keys.next());
+        }
+
+        ASSERT_EQ(generatedKeys.size(), 1000);
+        ASSERT_TRUE(std::adjacent_find(generatedKeys.begin(), generatedKeys.end(), std::greater_equal<>()) ==
+                    generatedKeys.end());
+        ASSERT_TRUE(std::all_of(generatedKeys.begin(), generatedKeys.end(),
+                                [&keys](const std::string& key) { return key.size() == keys.width(); }));
+    }
+}
+
+TEST_F(SortedUniqueIntegersTest, shouldEncodeKeysWithGivenWidth)
+{
+    ASSERT_EQ(SortedKeys(0, 1000000000, 1, KeyEncoding::Decimal).width(), 9);
+    ASSERT_EQ(SortedKeys(0, 256, 1, KeyEncoding::Hex).width(), 2);
+    ASSERT_EQ(SortedKeys(0, 62 * 62 + 1, 1, KeyEncoding::Base62).width(), 3);
+
+    SortedKeys keys{61, 62, 1, KeyEncoding::Base62, 4};
+
+    ASSERT_EQ(keys.next(), "000z");
+    ASSERT_THROW(SortedKeys(0, 1000, 1, KeyEncoding::Decimal, 2), std::invalid_argument);
+}
+
+TEST_F(SortedUniqueIntegersTest, shouldWritePackedKeysInChunks)
+{
+    SortedKeys keys{0, 100, 100, KeyEncoding::Decimal};
+
+    std::array<char, 25> buffer{};
+
+    ASSERT_EQ(keys.nextChunk(buffer), 12);
+    ASSERT_EQ(std::string(buffer.data(), 24), "000102030405060708091011");
+}
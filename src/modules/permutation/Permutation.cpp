@@ -0,0 +1,105 @@
+#include "faker-cxx/Permutation.h"
+
+#include <bit>
+#include <limits>
+
+#include "../../common/Fingerprint.h"
+#include "faker-cxx/Number.h"
+
+namespace faker
+{
+Permutation::Permutation(std::uint64_t size, std::optional<std::uint64_t> key)
+    : rangeSize{size}, currentPosition{0}
+{
+    const auto rangeBits = size > 1 ? static_cast<unsigned>(std::bit_width(size - 1)) : 1u;
+
+    halfBits = (rangeBits + 1) / 2;
+    halfMask = (std::uint64_t{1} << halfBits) - 1;
+
+    const auto permutationKey = key ? *key : Number::integer<std::uint64_t>(std::numeric_limits<std::uint64_t>::max());
+
+    for (unsigned round = 0; round < numberOfRounds; round++)
+    {
+        roundKeys[round] = Fingerprint::of(permutationKey + round * 0x9e3779b97f4a7c15ULL);
+    }
+}
+
+std::uint64_t Permutation::at(std::uint64_t index) const
+{
+    if (index >= rangeSize)
+    {
+        throw std::out_of_range("Permutation index is out of range.");
+    }
+
+    auto value = encrypt(index);
+
+    while (value >= rangeSize)
+    {
+        value = encrypt(value);
+    }
+
+    return value;
+}
+
+std::uint64_t Permutation::next()
+{
+    const auto value = at(currentPosition);
+
+    currentPosition++;
+
+    return value;
+}
+
+std::string Permutation::nextNumeric(unsigned width)
+{
+    auto number = std::to_string(next());
+
+    if (number.size() < width)
+    {
+        number.insert(0, width - number.size(), '0');
+    }
+
+    return number;
+}
+
+void Permutation::seek(std::uint64_t index)
+{
+    if (index > rangeSize)
+    {
+        throw std::out_of_range("Permutation index is out of range.");
+    }
+
+    currentPosition = index;
+}
+
+bool Permutation::hasNext() const
+{
+    return currentPosition < rangeSize;
+}
+
+std::uint64_t Permutation::position() const
+{
+    return currentPosition;
+}
+
+std::uint64_t Permutation::size() const
+{
+    return rangeSize;
+}
+
+std::uint64_t Permutation::encrypt(std::uint64_t value) const
+{
+    auto left = (value >> halfBits) & halfMask;
+    auto right = value & halfMask;
+
+    for (const auto roundKey : roundKeys)
+    {
+        const auto roundOutput = left ^ (Fingerprint::of(right ^ roundKey) & halfMask);
+
+        left = right;
+        right = roundOutput;
+    }
+
+    return (left << halfBits) | right;
+}
+}
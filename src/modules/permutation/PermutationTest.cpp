@@ -0,0 +1,119 @@
+#include "faker-cxx/Permutation.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace faker;
+
+class PermutationTest : public Test
+{
+public:
+};
+
+TEST_F(PermutationTest, shouldReturnEveryValueExactlyOnce)
+{
+    for (const std::uint64_t size : {1u, 2u, 7u, 1000u, 4099u})
+    {
+        Permutation permutation{size};
+
+        std::vector<std::uint64_t> values;
+
+        while (permutation.hasNext())
+        {
+            values.push_back(permutation.next());
+        }
+
+        std::sort(values.begin(), values.end());
+
+        std::vector<std::uint64_t> expectedValues(size);
+        std::iota(expectedValues.begin(), expectedValues.end(), 0);
+
+        ASSERT_EQ(values, expectedValues);
+    }
+}
+
+TEST_F(PermutationTest, shouldThrowWhenExhausted)
+{
+    Permutation permutation{2};
+
+    permutation.next();
+    permutation.next();
+
+    ASSERT_FALSE(permutation.hasNext());
+    ASSERT_THROW(permutation.next(), std::out_of_range);
+}
+
+TEST_F(PermutationTest, shouldGenerateSameOrderForSameKey)
+{
+    Permutation permutation{100000, 42};
+    Permutation samePermutation{100000, 42};
+
+    for (int i = 0; i < 100; i++)
+    {
+        ASSERT_EQ(permutation.next(), samePermutation.next());
+    }
+}
+
+TEST_F(PermutationTest, shouldContinueFromSeekPosition)
+{
+    Permutation permutation{1000, 7};
+    Permutation shard{1000, 7};
+
+    shard.seek(500);
+
+    ASSERT_EQ(shard.position(), 500);
+
+    for (std::uint64_t index = 500; index < 510; index++)
+    {
+        ASSERT_EQ(shard.next(), permutation.at(index));
+    }
+
+    ASSERT_THROW(shard.seek(1001), std::out_of_range);
+    ASSERT_THROW(permutation.at(1000), std::out_of_range);
+}
+
+TEST_F(PermutationTest, shouldGenerateZeroPaddedNumbers)
+{
+    Permutation permutation{1000};
+
+    for (int i = 0; i < 100; i++)
+    {
+        const auto number = permutation.nextNumeric(3);
+
+        ASSERT_EQ(number.size(), 3);
+        ASSERT_TRUE(std::all_of(number.begin(), number.end(), ::isdigit));
+    }
+}
+
+TEST_F(PermutationTest, shouldReturnEveryElementOnce)
+{
+    const std::vector<std::string> data{"apple", "banana", "cherry"};
+
+    Permutation permutation{data.size()};
+
+    std::vector<std::string> elements;
+
+    while (permutation.hasNext())
+    {
+        elements.push_back(permutation.nextElement<std::string>(data));
+    }
+
+    std::sort(elements.begin(), elements.end());
+
+    ASSERT_EQ(elements, data);
+}
+
+TEST_F(PermutationTest, shouldThrowWhenDataSizeDiffers)
+{
+    const std::vector<std::string> data{"apple", "banana", "cherry"};
+
+    Permutation permutation{2};
+
+    ASSERT_THROW(permutation.nextElement<std::string>(data), std::invalid_argument);
+}
@@ -2,47 +2,75 @@
 
 #include <format>
 
+#include "../../common/StringPool.h"
 #include "data/FirstNamesFemales.h"
 #include "data/FirstNamesMales.h"
 #include "data/Gender.h"
 #include "data/JobTitles.h"
 #include "data/LastNames.h"
 #include "faker-cxx/Helper.h"
+#include "faker-cxx/Number.h"
 
 namespace faker
 {
 namespace
 {
 const auto malePrefix{"Mr."};
-const std::vector<std::string> femalePrefixes{"Ms.", "Miss"};
-const std::vector<std::string> allPrefixes{"Mr.", "Ms.", "Miss"};
-const std::vector<std::string> sexes{"Male", "Female"};
+constexpr auto femalePrefixes = std::to_array<std::string_view>({"Ms.", "Miss"});
+constexpr auto allPrefixes = std::to_array<std::string_view>({"Mr.", "Ms.", "Miss"});
+constexpr auto sexes = std::to_array<std::string_view>({"Male", "Female"});
+
+constexpr auto namePool = StringPoolBuilder::build<firstNamesMales, firstNamesFemales, lastNames>();
+constexpr auto maleFirstNames = namePool.list(0);
+constexpr auto femaleFirstNames = namePool.list(1);
+constexpr auto allFirstNames = namePool.lists(0, 2);
+constexpr auto allLastNames = namePool.list(2);
+
+std::string_view randomName(StringPoolView names)
+{
+    return names[Number::integer<std::size_t>(names.size() - 1)];
+}
 }
 
 std::string Person::firstName(std::optional<Sex> sex)
 {
-    std::vector<std::string> firstNames;
+    return std::string{firstNameView(sex)};
+}
+
+std::string_view Person::firstNameView(std::optional<Sex> sex)
+{
+    const auto firstNames = firstNameDictionary(sex);
 
+    return firstNames[firstNames.randomIndex()];
+}
+
+Dictionary Person::firstNameDictionary(std::optional<Sex> sex)
+{
     if (sex == Sex::Male)
     {
-        firstNames.insert(firstNames.end(), firstNamesMales.begin(), firstNamesMales.end());
+        return Dictionary{maleFirstNames};
     }
     else if (sex == Sex::Female)
     {
-        firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
-    }
-    else
-    {
-        firstNames.insert(firstNames.end(), firstNamesMales.begin(), firstNamesMales.end());
-        firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
+        return Dictionary{femaleFirstNames};
     }
 
-    return Helper::arrayElement<std::string>(firstNames);
+    return Dictionary{allFirstNames};
 }
 
 std::string Person::lastName()
 {
-    return Helper::arrayElement<std::string>(lastNames);
+    return std::string{lastNameView()};
+}
+
+std::string_view Person::lastNameView()
+{
+    return randomName(allLastNames);
+}
+
+Dictionary Person::lastNameDictionary()
+{
+    return Dictionary{allLastNames};
 }
 
 std::string Person::fullName(std::optional<Sex> sex)
@@ -52,12 +80,32 @@ std::string Person::fullName(std::optional<Sex> sex)
 
 std::string Person::sex()
 {
-    return Helper::arrayElement<std::string>(sexes);
+    return std::string{sexView()};
+}
+
+std::string_view Person::sexView()
+{
+    return Helper::arrayElement<std::string_view>(sexes);
+}
+
+Dictionary Person::sexDictionary()
+{
+    return Dictionary{sexes};
 }
 
 std::string Person::gender()
 {
-    return Helper::arrayElement<std::string>(genders);
+    return std::string{genderView()};
+}
+
+std::string_view Person::genderView()
+{
+    return Helper::arrayElement<std::string_view>(genders);
+}
+
+Dictionary Person::genderDictionary()
+{
+    return Dictionary{genders};
 }
 
 std::string Person::jobTitle()
@@ -67,34 +115,62 @@ std::string Person::jobTitle()
 
 std::string Person::jobDescriptor()
 {
-    return Helper::arrayElement<std::string>(jobDescriptors);
+    return std::string{jobDescriptorView()};
+}
+
+std::string_view Person::jobDescriptorView()
+{
+    return Helper::arrayElement<std::string_view>(jobDescriptors);
+}
+
+Dictionary Person::jobDescriptorDictionary()
+{
+    return Dictionary{jobDescriptors};
 }
 
 std::string Person::jobArea()
 {
-    return Helper::arrayElement<std::string>(jobAreas);
+    return std::string{jobAreaView()};
+}
+
+std::string_view Person::jobAreaView()
+{
+    return Helper::arrayElement<std::string_view>(jobAreas);
+}
+
+Dictionary Person::jobAreaDictionary()
+{
+    return Dictionary{jobAreas};
 }
 
 std::string Person::jobType()
 {
-    return Helper::arrayElement<std::string>(jobTypes);
+    return std::string{jobTypeView()};
 }
 
-std::string Person::prefix(std::optional<Sex> sex)
+std::string_view Person::jobTypeView()
 {
-    std::vector<std::string> prefixes;
+    return Helper::arrayElement<std::string_view>(jobTypes);
+}
+
+Dictionary Person::jobTypeDictionary()
+{
+    return Dictionary{jobTypes};
+}
 
+std::string Person::prefix(std::optional<Sex> sex)
+{
     if (sex == Sex::Male)
     {
         return malePrefix;
     }
     else if (sex == Sex::Female)
     {
-        return Helper::arrayElement<std::string>(femalePrefixes);
+        return std::string{Helper::arrayElement<std::string_view>(femalePrefixes)};
     }
     else
     {
-        return Helper::arrayElement<std::string>(allPrefixes);
+        return std::string{Helper::arrayElement<std::string_view>(allPrefixes)};
     }
 }
 }
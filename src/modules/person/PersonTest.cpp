@@ -28,14 +28,14 @@ public:
 
 TEST_F(PersonTest, shouldGenerateFirstName)
 {
-    std::vector<std::string> firstNames{firstNamesMales};
+    std::vector<std::string_view> firstNames(firstNamesMales.begin(), firstNamesMales.end());
 
     firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
     const auto generatedFirstName = Person::firstName();
 
     ASSERT_TRUE(std::any_of(firstNames.begin(), firstNames.end(),
-                            [generatedFirstName](const std::string& firstName)
+                            [generatedFirstName](std::string_view firstName)
                             { return firstName == generatedFirstName; }));
 }
 
@@ -44,7 +44,7 @@ TEST_F(PersonTest, shouldGeneratemMaleFirstName)
     const auto generatedFirstName = Person::firstName(Sex::Male);
 
     ASSERT_TRUE(std::any_of(firstNamesMales.begin(), firstNamesMales.end(),
-                            [generatedFirstName](const std::string& firstName)
+                            [generatedFirstName](std::string_view firstName)
                             { return firstName == generatedFirstName; }));
 }
 
@@ -53,7 +53,7 @@ TEST_F(PersonTest, shouldGenerateFemaleFirstName)
     const auto generatedFirstName = Person::firstName(Sex::Female);
 
     ASSERT_TRUE(std::any_of(firstNamesFemales.begin(), firstNamesFemales.end(),
-                            [generatedFirstName](const std::string& firstName)
+                            [generatedFirstName](std::string_view firstName)
                             { return firstName == generatedFirstName; }));
 }
 
@@ -62,13 +62,47 @@ TEST_F(PersonTest, shouldGenerateLastName)
     const auto generatedLastName = Person::lastName();
 
     ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                            [generatedLastName](const std::string& lastName)
+                            [generatedLastName](std::string_view lastName)
                             { return lastName == generatedLastName; }));
 }
 
+TEST_F(PersonTest, shouldGenerateLastNameView)
+{
+    const auto generatedLastName = Person::lastNameView();
+
+    ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
+                            [generatedLastName](std::string_view lastName)
+                            { return lastName == generatedLastName; }));
+}
+
+TEST_F(PersonTest, shouldGenerateFemaleFirstNameView)
+{
+    const auto generatedFirstName = Person::firstNameView(Sex::Female);
+
+    ASSERT_TRUE(std::any_of(firstNamesFemales.begin(), firstNamesFemales.end(),
+                            [generatedFirstName](std::string_view firstName)
+                            { return firstName == generatedFirstName; }));
+}
+
+TEST_F(PersonTest, shouldReturnFirstNameDictionary)
+{
+    const auto femaleFirstNames = Person::firstNameDictionary(Sex::Female);
+    const auto allFirstNames = Person::firstNameDictionary();
+
+    ASSERT_EQ(femaleFirstNames.size(), firstNamesFemales.size());
+    ASSERT_EQ(allFirstNames.size(), firstNamesMales.size() + firstNamesFemales.size());
+
+    for (std::size_t i = 0; i < firstNamesFemales.size(); i++)
+    {
+        ASSERT_EQ(femaleFirstNames[i], firstNamesFemales[i]);
+    }
+
+    ASSERT_LT(femaleFirstNames.randomIndex(), femaleFirstNames.size());
+}
+
 TEST_F(PersonTest, shouldGenerateFullName)
 {
-    std::vector<std::string> firstNames{firstNamesMales};
+    std::vector<std::string_view> firstNames(firstNamesMales.begin(), firstNamesMales.end());
 
     firstNames.insert(firstNames.end(), firstNamesFemales.begin(), firstNamesFemales.end());
 
@@ -80,10 +114,10 @@ TEST_F(PersonTest, shouldGenerateFullName)
     const auto& generatedLastName = names[1];
 
     ASSERT_TRUE(std::any_of(firstNames.begin(), firstNames.end(),
-                            [generatedFirstName](const std::string& firstName)
+                            [generatedFirstName](std::string_view firstName)
                             { return firstName == generatedFirstName; }));
     ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                            [generatedLastName](const std::string& lastName)
+                            [generatedLastName](std::string_view lastName)
                             { return lastName == generatedLastName; }));
 }
 
@@ -97,10 +131,10 @@ TEST_F(PersonTest, shouldGenerateMaleFullName)
     const auto& generatedLastName = names[1];
 
     ASSERT_TRUE(std::any_of(firstNamesMales.begin(), firstNamesMales.end(),
-                            [generatedFirstName](const std::string& firstName)
+                            [generatedFirstName](std::string_view firstName)
                             { return firstName == generatedFirstName; }));
     ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                            [generatedLastName](const std::string& lastName)
+                            [generatedLastName](std::string_view lastName)
                             { return lastName == generatedLastName; }));
 }
 
@@ -114,10 +148,10 @@ TEST_F(PersonTest, shouldGenerateFemaleFullName)
     const auto& generatedLastName = names[1];
 
     ASSERT_TRUE(std::any_of(firstNamesFemales.begin(), firstNamesFemales.end(),
-                            [generatedFirstName](const std::string& firstName)
+                            [generatedFirstName](std::string_view firstName)
                             { return firstName == generatedFirstName; }));
     ASSERT_TRUE(std::any_of(lastNames.begin(), lastNames.end(),
-                            [generatedLastName](const std::string& lastName)
+                            [generatedLastName](std::string_view lastName)
                             { return lastName == generatedLastName; }));
 }
 
@@ -128,7 +162,7 @@ TEST_F(PersonTest, shouldGenerateSex)
     const auto generatedSex = Person::sex();
 
     ASSERT_TRUE(std::any_of(sexes.begin(), sexes.end(),
-                            [generatedSex](const std::string& sex) { return sex == generatedSex; }));
+                            [generatedSex](std::string_view sex) { return sex == generatedSex; }));
 }
 
 TEST_F(PersonTest, shouldGenerateGender)
@@ -136,7 +170,7 @@ TEST_F(PersonTest, shouldGenerateGender)
     const auto generatedGender = Person::gender();
 
     ASSERT_TRUE(std::any_of(genders.begin(), genders.end(),
-                            [generatedGender](const std::string& gender) { return gender == generatedGender; }));
+                            [generatedGender](std::string_view gender) { return gender == generatedGender; }));
 }
 
 TEST_F(PersonTest, shouldGenerateJobDescriptor)
@@ -144,7 +178,7 @@ TEST_F(PersonTest, shouldGenerateJobDescriptor)
     const auto generatedJobDescriptor = Person::jobDescriptor();
 
     ASSERT_TRUE(std::any_of(jobDescriptors.begin(), jobDescriptors.end(),
-                            [generatedJobDescriptor](const std::string& jobDescriptor)
+                            [generatedJobDescriptor](std::string_view jobDescriptor)
                             { return jobDescriptor == generatedJobDescriptor; }));
 }
 
@@ -153,7 +187,7 @@ TEST_F(PersonTest, shouldGenerateJobArea)
     const auto generatedJobArea = Person::jobArea();
 
     ASSERT_TRUE(std::any_of(jobAreas.begin(), jobAreas.end(),
-                            [generatedJobArea](const std::string& jobArea) { return jobArea == generatedJobArea; }));
+                            [generatedJobArea](std::string_view jobArea) { return jobArea == generatedJobArea; }));
 }
 
 TEST_F(PersonTest, shouldGenerateJobType)
@@ -161,7 +195,7 @@ TEST_F(PersonTest, shouldGenerateJobType)
     const auto generatedJobType = Person::jobType();
 
     ASSERT_TRUE(std::any_of(jobTypes.begin(), jobTypes.end(),
-                            [generatedJobType](const std::string& jobType) { return jobType == generatedJobType; }));
+                            [generatedJobType](std::string_view jobType) { return jobType == generatedJobType; }));
 }
 
 TEST_F(PersonTest, shouldGenerateJobTitle)
@@ -175,12 +209,12 @@ TEST_F(PersonTest, shouldGenerateJobTitle)
     const auto& generatedJobType = jobTitleElements[2];
 
     ASSERT_TRUE(std::any_of(jobDescriptors.begin(), jobDescriptors.end(),
-                            [generatedJobDescriptor](const std::string& jobDescriptor)
+                            [generatedJobDescriptor](std::string_view jobDescriptor)
                             { return jobDescriptor == generatedJobDescriptor; }));
     ASSERT_TRUE(std::any_of(jobAreas.begin(), jobAreas.end(),
-                            [generatedJobArea](const std::string& jobArea) { return jobArea == generatedJobArea; }));
+                            [generatedJobArea](std::string_view jobArea) { return jobArea == generatedJobArea; }));
     ASSERT_TRUE(std::any_of(jobTypes.begin(), jobTypes.end(),
-                            [generatedJobType](const std::string& jobType) { return jobType == generatedJobType; }));
+                            [generatedJobType](std::string_view jobType) { return jobType == generatedJobType; }));
 }
 
 TEST_F(PersonTest, shouldGeneratePrefix)
@@ -188,7 +222,7 @@ TEST_F(PersonTest, shouldGeneratePrefix)
     const auto generatedPrefix = Person::prefix();
 
     ASSERT_TRUE(std::any_of(allPrefixes.begin(), allPrefixes.end(),
-                            [generatedPrefix](const std::string& prefix) { return prefix == generatedPrefix; }));
+                            [generatedPrefix](std::string_view prefix) { return prefix == generatedPrefix; }));
 }
 
 TEST_F(PersonTest, shouldGenerateMalePrefix)
@@ -203,5 +237,5 @@ TEST_F(PersonTest, shouldGenerateFemalePrefix)
     const auto generatedPrefix = Person::prefix(Sex::Female);
 
     ASSERT_TRUE(std::any_of(femalePrefixes.begin(), femalePrefixes.end(),
-                            [generatedPrefix](const std::string& prefix) { return prefix == generatedPrefix; }));
+                            [generatedPrefix](std::string_view prefix) { return prefix == generatedPrefix; }));
 }
@@ -1,11 +1,11 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> firstNamesFemales = {
+inline constexpr auto firstNamesFemales = std::to_array<std::string_view>({
     "Mary",       "Patricia",   "Linda",     "Barbara",   "Elizabeth", "Jennifer",   "Maria",     "Susan",
     "Margaret",   "Dorothy",    "Lisa",      "Nancy",     "Karen",     "Betty",      "Helen",     "Sandra",
     "Donna",      "Carol",      "Ruth",      "Sharon",    "Michelle",  "Laura",      "Sarah",     "Kimberly",
@@ -69,5 +69,5 @@ const std::vector<std::string> firstNamesFemales = {
     "Dixie",      "Lucia",      "Marta",     "Faith",     "Lela",      "Johanna",    "Shari",     "Camille",
     "Tami",       "Shawna",     "Elisa",     "Ebony",     "Melba",     "Ora",        "Nettie",    "Tabitha",
     "Ollie",      "Jaime",      "Winifred",  "Kristie",
-};
+});
 }
@@ -1,11 +1,11 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> firstNamesMales = {
+inline constexpr auto firstNamesMales = std::to_array<std::string_view>({
     "James",     "John",      "Robert",      "Michael",   "William",   "David",      "Richard",  "Charles",
     "Joseph",    "Thomas",    "Christopher", "Daniel",    "Paul",      "Mark",       "Donald",   "George",
     "Kenneth",   "Steven",    "Edward",      "Brian",     "Ronald",    "Anthony",    "Kevin",    "Jason",
@@ -69,5 +69,5 @@ const std::vector<std::string> firstNamesMales = {
     "Winston",   "Brendan",   "Toby",        "Van",       "Abel",      "Dominick",   "Boyd",     "Courtney",
     "Jan",       "Emilio",    "Elijah",      "Cary",      "Domingo",   "Santos",     "Aubrey",   "Emmett",
     "Marlon",    "Emanuel",   "Jerald",      "Edmond",
-};
+});
 }
@@ -1,10 +1,10 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 // Source: https://en.wikipedia.org/wiki/List_of_gender_identities
-const std::vector<std::string> genders{
+inline constexpr auto genders = std::to_array<std::string_view>({
     "Agender",
     "Androgyne",
     "Androgynous",
@@ -81,4 +81,4 @@ const std::vector<std::string> genders{
     "Two-spirit",
     "Woman",
     "Xenogender",
-};
+});
@@ -1,29 +1,29 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> jobDescriptors = {
+inline constexpr auto jobDescriptors = std::to_array<std::string_view>({
     "Lead",          "Senior",   "Direct",   "Corporate", "Dynamic", "Future",   "Product",
     "National",      "Regional", "District", "Central",   "Global",  "Customer", "Investor",
     "International", "Legacy",   "Forward",  "Internal",  "Human",   "Chief",    "Principal",
-};
+});
 
-const std::vector<std::string> jobAreas = {
+inline constexpr auto jobAreas = std::to_array<std::string_view>({
     "Solutions",    "Program",        "Brand",          "Security",      "Research",       "Marketing",
     "Directives",   "Implementation", "Integration",    "Functionality", "Response",       "Paradigm",
     "Tactics",      "Identity",       "Markets",        "Group",         "Division",       "Applications",
     "Optimization", "Operations",     "Infrastructure", "Intranet",      "Communications", "Web",
     "Branding",     "Quality",        "Assurance",      "Mobility",      "Accounts",       "Data",
     "Creative",     "Configuration",  "Accountability", "Interactions",  "Factors",        "Usability",
-    "Metrics",      "Software"};
+    "Metrics",      "Software"});
 
-const std::vector<std::string> jobTypes = {
+inline constexpr auto jobTypes = std::to_array<std::string_view>({
     "Supervisor",  "Associate",    "Executive",      "Liaison",       "Officer",   "Manager",    "Engineer",
     "Specialist",  "Director",     "Coordinator",    "Administrator", "Architect", "Analyst",    "Designer",
     "Planner",     "Orchestrator", "Technician",     "Developer",     "Producer",  "Consultant", "Assistant",
     "Facilitator", "Agent",        "Representative", "Strategist",
-};
+});
 }
@@ -1,11 +1,11 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> lastNames = {
+inline constexpr auto lastNames = std::to_array<std::string_view>({
     "Abbott",      "Abernathy",     "Abshire",     "Adams",       "Altenwerth", "Anderson",     "Ankunding",
     "Armstrong",   "Auer",          "Aufderhar",   "Bahringer",   "Bailey",     "Balistreri",   "Barrows",
     "Bartell",     "Bartoletti",    "Barton",      "Bashirian",   "Batz",       "Bauch",        "Baumbach",
@@ -73,5 +73,5 @@ const std::vector<std::string> lastNames = {
     "Wisozk",      "Witting",       "Wiza",        "Wolf",        "Wolff",      "Wuckert",      "Wunsch",
     "Wyman",       "Yost",          "Yundt",       "Zboncak",     "Zemlak",     "Ziemann",      "Zieme",
     "Zulauf",
-};
+});
 }
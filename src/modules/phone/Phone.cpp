@@ -1,60 +1,183 @@
 #include "faker-cxx/Phone.h"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
+#include "../../common/EnumMap.h"
+#include "../../common/RandomDigits.h"
 #include "data/PhoneNumbers.h"
 #include "faker-cxx/Helper.h"
+#include "faker-cxx/Number.h"
 
 namespace faker
 {
-std::map<PhoneNumberCountryFormat, std::string> Phone::phoneNumberFormatMap = Phone::createPhoneNumberFormatMap();
+namespace
+{
+constexpr std::size_t maxPhoneNumberLength = 32;
+constexpr std::size_t maxPhoneNumberSlots = 16;
+constexpr std::size_t maxE164Digits = 15;
 
-std::string Phone::number(std::optional<std::string> format)
+// Every format fits in a single draw of random digits.
+static_assert(maxPhoneNumberSlots <= RandomDigits::digitsPerDraw);
+
+constexpr auto powersOfTen = []
 {
-    std::string selectedFormat;
+    std::array<std::uint64_t, maxE164Digits + 1> powers{};
+    powers[0] = 1;
 
-    if (!format.has_value() || format->empty())
+    for (std::size_t i = 1; i < powers.size(); i++)
+    {
+        powers[i] = powers[i - 1] * 10;
+    }
+
+    return powers;
+}();
+
+/**
+ * Positions of the characters of a format replaced with random digits, `#` by any digit and `!` by a digit from 2
+ * to 9, with the symbols of the slots kept in order. Literal digits of formats starting with a `+` country code form
+ * the E.164 prefix.
+ */
+struct PhoneNumberPlan {
+    std::string_view pattern;
+    std::array<std::uint8_t, maxPhoneNumberSlots> slots{};
+    std::array<char, maxPhoneNumberSlots> slotSymbols{};
+    std::size_t slotCount = 0;
+    bool hasCountryCode = false;
+    std::uint64_t e164Prefix = 0;
+};
+
+constexpr PhoneNumberPlan compilePhoneNumberFormat(std::string_view format)
+{
+    if (format.size() > maxPhoneNumberLength)
+    {
+        throw std::invalid_argument("Phone number format is too long.");
+    }
+
+    PhoneNumberPlan plan{.pattern = format, .hasCountryCode = format.starts_with('+')};
+    std::size_t prefixDigits = 0;
+
+    for (std::size_t i = 0; i < format.size(); i++)
     {
-        selectedFormat = Helper::arrayElement<std::string>(phoneNumbers);
+        const auto character = format[i];
+
+        if (character == '#' || character == '!')
+        {
+            if (plan.slotCount == maxPhoneNumberSlots)
+            {
+                throw std::invalid_argument("Phone number format has too many digits.");
+            }
+
+            plan.slotSymbols[plan.slotCount] = character;
+            plan.slots[plan.slotCount++] = static_cast<std::uint8_t>(i);
+        }
+        else if (character >= '0' && character <= '9')
+        {
+            if (plan.slotCount != 0)
+            {
+                throw std::invalid_argument("Literal digits of a phone number format must precede random digits.");
+            }
+
+            plan.e164Prefix = plan.e164Prefix * 10 + static_cast<std::uint64_t>(character - '0');
+            prefixDigits++;
+        }
     }
-    else
+
+    if (plan.hasCountryCode && prefixDigits + plan.slotCount > maxE164Digits)
     {
-        selectedFormat = format.value();
+        throw std::invalid_argument("Phone number format has more digits than E.164 allows.");
     }
 
-    return Helper::replaceSymbolWithNumber(selectedFormat);
+    return plan;
 }
 
-std::string Phone::number(PhoneNumberCountryFormat format)
+// Formats are listed in order of PhoneNumberCountryFormat enumerators, so a format is looked up by its enumerator.
+static_assert(phoneNumbers.size() == static_cast<std::size_t>(PhoneNumberCountryFormat::Zimbabwe) + 1);
+
+constexpr auto phoneNumberPlans = EnumMap<PhoneNumberCountryFormat, PhoneNumberPlan, phoneNumbers.size()>{[]
 {
-    std::string countryFormat = phoneNumberFormatMap.at(format);
+    std::array<PhoneNumberPlan, phoneNumbers.size()> plans{};
 
-    if (countryFormat.empty())
+    for (std::size_t i = 0; i < phoneNumbers.size(); i++)
     {
-        return phoneNumberFormatMap.at(PhoneNumberCountryFormat::Default);
+        plans[i] = compilePhoneNumberFormat(phoneNumbers[i]);
     }
 
-    return Helper::replaceSymbolWithNumber(countryFormat);
+    return plans;
+}()};
+
+// Digits of the slots in order, from a single pass of the digit kernel over the slot symbols.
+std::array<char, maxPhoneNumberSlots> randomSlotDigits(const PhoneNumberPlan& plan)
+{
+    auto digits = plan.slotSymbols;
+
+    RandomDigits::fillTemplate(std::span{digits}.first(plan.slotCount));
+
+    return digits;
 }
 
-std::string Phone::imei()
+std::string generatePhoneNumber(const PhoneNumberPlan& plan)
 {
-    return Helper::replaceCreditCardSymbols("##-######-######-L", '#');
+    std::array<char, maxPhoneNumberLength> buffer;
+    std::ranges::copy(plan.pattern, buffer.begin());
+
+    const auto digits = randomSlotDigits(plan);
+
+    for (std::size_t i = 0; i < plan.slotCount; i++)
+    {
+        buffer[plan.slots[i]] = digits[i];
+    }
+
+    return std::string(buffer.data(), plan.pattern.size());
+}
 }
 
-std::map<PhoneNumberCountryFormat, std::string> Phone::createPhoneNumberFormatMap()
+std::string Phone::number(std::optional<std::string> format)
 {
-    std::map<PhoneNumberCountryFormat, std::string> formatMap;
+    if (!format.has_value() || format->empty())
+    {
+        const auto index = Number::integer<std::size_t>(phoneNumberPlans.size() - 1);
 
-    // Loop through all the PhoneNumberCountryFormat enum values
-    for (auto i = static_cast<unsigned long>(PhoneNumberCountryFormat::Default);
-         i <= static_cast<unsigned long>(PhoneNumberCountryFormat::Zimbabwe); i++)
+        return generatePhoneNumber(phoneNumberPlans[static_cast<PhoneNumberCountryFormat>(index)]);
+    }
+
+    return Helper::replaceSymbolWithNumber(format.value());
+}
+
+std::string Phone::number(PhoneNumberCountryFormat format)
+{
+    return generatePhoneNumber(phoneNumberPlans.at(format));
+}
+
+std::uint64_t Phone::numberE164(PhoneNumberCountryFormat format)
+{
+    const auto& plan = phoneNumberPlans.at(format);
+
+    if (!plan.hasCountryCode)
     {
-        auto formatEnum = static_cast<PhoneNumberCountryFormat>(i);
-        
-        formatMap[formatEnum] = phoneNumbers[i];
+        throw std::invalid_argument("Phone number format has no country code.");
     }
 
-    return formatMap;
+    const auto digits = randomSlotDigits(plan);
+
+    auto nationalNumber = std::uint64_t{0};
+
+    for (std::size_t i = 0; i < plan.slotCount; i++)
+    {
+        nationalNumber = nationalNumber * 10 + static_cast<std::uint64_t>(digits[i] - '0');
+    }
+
+    return plan.e164Prefix * powersOfTen[plan.slotCount] + nationalNumber;
+}
+
+std::string Phone::imei()
+{
+    return Helper::replaceCreditCardSymbols("##-######-######-L", '#');
 }
 }
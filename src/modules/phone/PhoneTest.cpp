@@ -67,3 +67,65 @@ TEST_F(PhoneTest, NumberFormatTest)
     EXPECT_FALSE(phoneNumber.empty());
     ASSERT_TRUE(isStringNumericWithSpecialChars(phoneNumber));
 }
+
+TEST_F(PhoneTest, NumberFollowsCountryFormat)
+{
+    for (std::size_t i = 0; i < phoneNumbers.size(); i++)
+    {
+        const auto format = phoneNumbers[i];
+        const auto phoneNumber = Phone::number(static_cast<PhoneNumberCountryFormat>(i));
+
+        ASSERT_EQ(phoneNumber.size(), format.size());
+
+        for (std::size_t j = 0; j < format.size(); j++)
+        {
+            if (format[j] == '#')
+            {
+                ASSERT_TRUE(std::isdigit(phoneNumber[j]));
+            }
+            else if (format[j] == '!')
+            {
+                ASSERT_GE(phoneNumber[j], '2');
+                ASSERT_LE(phoneNumber[j], '9');
+            }
+            else
+            {
+                ASSERT_EQ(phoneNumber[j], format[j]);
+            }
+        }
+    }
+}
+
+TEST_F(PhoneTest, NumberE164)
+{
+    for (std::size_t i = 1; i < phoneNumbers.size(); i++)
+    {
+        const auto format = phoneNumbers[i];
+
+        std::string expectedPrefix;
+        std::size_t digitCount = 0;
+
+        for (const auto character : format)
+        {
+            if (std::isdigit(character))
+            {
+                expectedPrefix += character;
+                digitCount++;
+            }
+            else if (character == '#' || character == '!')
+            {
+                digitCount++;
+            }
+        }
+
+        const auto phoneNumber = std::to_string(Phone::numberE164(static_cast<PhoneNumberCountryFormat>(i)));
+
+        ASSERT_EQ(phoneNumber.size(), digitCount);
+        ASSERT_TRUE(phoneNumber.starts_with(expectedPrefix));
+    }
+}
+
+TEST_F(PhoneTest, NumberE164WithoutCountryCodeThrows)
+{
+    ASSERT_THROW(Phone::numberE164(PhoneNumberCountryFormat::Default), std::invalid_argument);
+}
@@ -1,11 +1,11 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> phoneNumbers = {"!##-###-###", //Default
+inline constexpr auto phoneNumbers = std::to_array<std::string_view>({"!##-###-###", //Default
                                             "+93 (###) ###-####", // Afghanistan
                                             "+358 (###) ###-####", // Aland Islands
                                             "+355 (###) ###-####", // Albania
@@ -235,6 +235,6 @@ const std::vector<std::string> phoneNumbers = {"!##-###-###", //Default
                                             "+967 (###) ###-####", // Yemen
                                             "+260 (###) ###-####", // Zambia
                                             "+263 (###) ####" // Zimbabwe
-};
+});
 }
 
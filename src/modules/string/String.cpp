@@ -1,9 +1,10 @@
 #include "faker-cxx/String.h"
 
-#include <map>
 #include <random>
 #include <sstream>
 
+#include "../../common/EnumMap.h"
+#include "../../common/RandomDigits.h"
 #include "data/Characters.h"
 #include "faker-cxx/Helper.h"
 
@@ -11,24 +12,26 @@ namespace faker
 {
 namespace
 {
-const std::map<StringCasing, std::string> stringCasingToAlphaCharactersMapping{
-    {StringCasing::Lower, lowerCharacters},
-    {StringCasing::Upper, upperCharacters},
-    {StringCasing::Mixed, mixedAlphaCharacters},
-};
-const std::map<StringCasing, std::string> stringCasingToAlphanumericCharactersMapping{
-    {StringCasing::Lower, lowerAlphanumericCharacters},
-    {StringCasing::Upper, upperAlphanumericCharacters},
-    {StringCasing::Mixed, mixedAlphanumericCharacters},
-};
-const std::map<HexCasing, std::string> hexCasingToCharactersMapping{
+constexpr auto stringCasingToAlphaCharactersMapping =
+    EnumMapBuilder::build<StringCasing, std::string_view, StringCasing::Upper>({
+        {StringCasing::Mixed, mixedAlphaCharacters},
+        {StringCasing::Lower, lowerCharacters},
+        {StringCasing::Upper, upperCharacters},
+    });
+constexpr auto stringCasingToAlphanumericCharactersMapping =
+    EnumMapBuilder::build<StringCasing, std::string_view, StringCasing::Upper>({
+        {StringCasing::Mixed, mixedAlphanumericCharacters},
+        {StringCasing::Lower, lowerAlphanumericCharacters},
+        {StringCasing::Upper, upperAlphanumericCharacters},
+    });
+constexpr auto hexCasingToCharactersMapping = EnumMapBuilder::build<HexCasing, std::string_view, HexCasing::Upper>({
     {HexCasing::Lower, hexLowerCharacters},
     {HexCasing::Upper, hexUpperCharacters},
-};
-const std::map<HexPrefix, std::string> hexPrefixToStringMapping{
+});
+constexpr auto hexPrefixToStringMapping = EnumMapBuilder::build<HexPrefix, std::string_view, HexPrefix::Hash>({
     {HexPrefix::ZeroX, "0x"},
     {HexPrefix::Hash, "#"},
-};
+});
 }
 
 // TODO: refactor
@@ -108,21 +111,16 @@ std::string String::alphanumeric(unsigned int length, StringCasing casing)
 
 std::string String::numeric(unsigned int length, bool allowLeadingZeros)
 {
-    std::string alphanumeric;
+    std::string numeric(length, '\0');
 
-    for (unsigned i = 0; i < length; i++)
+    RandomDigits::fill(numeric);
+
+    if (length > 0 && allowLeadingZeros)
     {
-        if (i == 0 && allowLeadingZeros)
-        {
-            alphanumeric += Helper::arrayElement<char>(numericCharactersWithoutZero);
-        }
-        else
-        {
-            alphanumeric += Helper::arrayElement<char>(numericCharacters);
-        }
+        numeric[0] = Helper::arrayElement<char>(numericCharactersWithoutZero);
     }
 
-    return alphanumeric;
+    return numeric;
 }
 
 std::string String::hexadecimal(unsigned int length, HexCasing casing, HexPrefix prefix)
@@ -1,17 +1,18 @@
 #pragma once
 
-#include <string>
+#include <string_view>
 
 namespace faker
 {
-const std::string upperCharacters = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
-const std::string lowerCharacters = "abcdefghijklmnopqrstuvwxyz";
-const std::string numericCharactersWithoutZero = "123456789";
-const std::string numericCharacters = "0123456789";
-const std::string mixedAlphaCharacters = upperCharacters + lowerCharacters;
-const std::string lowerAlphanumericCharacters = lowerCharacters + numericCharacters;
-const std::string upperAlphanumericCharacters = upperCharacters + numericCharacters;
-const std::string mixedAlphanumericCharacters = upperCharacters + lowerCharacters + numericCharacters;
-const std::string hexUpperCharacters = "0123456789ABCDEF";
-const std::string hexLowerCharacters = "0123456789abcdef";
+inline constexpr std::string_view upperCharacters = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+inline constexpr std::string_view lowerCharacters = "abcdefghijklmnopqrstuvwxyz";
+inline constexpr std::string_view numericCharactersWithoutZero = "123456789";
+inline constexpr std::string_view numericCharacters = "0123456789";
+inline constexpr std::string_view mixedAlphaCharacters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+inline constexpr std::string_view lowerAlphanumericCharacters = "abcdefghijklmnopqrstuvwxyz0123456789";
+inline constexpr std::string_view upperAlphanumericCharacters = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+inline constexpr std::string_view mixedAlphanumericCharacters =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+inline constexpr std::string_view hexUpperCharacters = "0123456789ABCDEF";
+inline constexpr std::string_view hexLowerCharacters = "0123456789abcdef";
 }
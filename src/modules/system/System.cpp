@@ -1,7 +1,51 @@
 #include "faker-cxx/System.h"
 
+#include "../../common/NumberFormatter.h"
+
 namespace faker
 {
+namespace
+{
+const std::vector<std::string_view>& fileExtensions()
+{
+    static const auto extensions = []()
+    {
+        std::set<std::string_view> extensionSet;
+
+        for (const auto& extension : mimeTypes)
+        {
+            size_t pos = extension.find_last_of('/');
+            extensionSet.insert(extension.substr(pos + 1));
+        }
+
+        return std::vector<std::string_view>(extensionSet.begin(), extensionSet.end());
+    }();
+
+    return extensions;
+}
+
+const std::vector<std::string_view>& fileTypes()
+{
+    static const auto types = []()
+    {
+        std::set<std::string_view> typeSet;
+
+        for (const auto& m : mimeTypes)
+        {
+            size_t pos = m.find('/');
+            if (pos != std::string_view::npos)
+            {
+                typeSet.insert(m.substr(0, pos));
+            }
+        }
+
+        return std::vector<std::string_view>(typeSet.begin(), typeSet.end());
+    }();
+
+    return types;
+}
+}
+
 std::string System::fileName(const FileOptions& options)
 {
     std::string baseName = Word::words();
@@ -44,23 +88,14 @@ std::string System::fileExt(const std::optional<std::string>& mimeType)
         auto it = std::find(mimeTypes.begin(), mimeTypes.end(), *mimeType);
         if (it != mimeTypes.end())
         {
-            const std::string& extension = *it;
+            const auto extension = *it;
             size_t pos = extension.find_last_of('/');
-            return extension.substr(pos + 1);
+            return std::string{extension.substr(pos + 1)};
         }
     }
     else
     {
-        std::set<std::string> extensionSet;
-
-        for (const auto& extension : mimeTypes)
-        {
-            size_t pos = extension.find_last_of('/');
-            extensionSet.insert(extension.substr(pos + 1));
-        }
-
-        std::vector<std::string> extensions(extensionSet.begin(), extensionSet.end());
-        return Helper::arrayElement<std::string>(extensions);
+        return std::string{Helper::arrayElement<std::string_view>(fileExtensions())};
     }
     return "";
 }
@@ -82,50 +117,68 @@ std::string System::commonFileName(const std::optional<std::string>& ext)
 
 std::string System::commonFileExt()
 {
-    std::optional<std::string> mimeType = Helper::arrayElement<std::string>(commonMimeTypes);
+    std::optional<std::string> mimeType = std::string{Helper::arrayElement<std::string_view>(commonMimeTypes)};
     return fileExt(mimeType);
 }
 
 std::string System::mimeType()
 {
-    std::vector<std::string> mimeTypeKeys;
-    for (const auto& entry : mimeTypes)
-    {
-        mimeTypeKeys.push_back(entry);
-    }
+    return std::string{mimeTypeView()};
+}
 
-    return Helper::arrayElement<std::string>(mimeTypeKeys);
+std::string_view System::mimeTypeView()
+{
+    return Helper::arrayElement<std::string_view>(mimeTypes);
+}
+
+Dictionary System::mimeTypeDictionary()
+{
+    return Dictionary{mimeTypes};
 }
 
 std::string System::commonFileType()
 {
-    return Helper::arrayElement<std::string>(commonFileTypes);
+    return std::string{commonFileTypeView()};
+}
+
+std::string_view System::commonFileTypeView()
+{
+    return Helper::arrayElement<std::string_view>(commonFileTypes);
+}
+
+Dictionary System::commonFileTypeDictionary()
+{
+    return Dictionary{commonFileTypes};
 }
 
 std::string System::fileType()
 {
-    std::set<std::string> typeSet;
-    const auto& localMimeTypes = mimeTypes;
+    return std::string{fileTypeView()};
+}
 
-    for (const auto& entry : localMimeTypes)
-    {
-        const std::string& m = entry;
-        size_t pos = m.find('/');
-        if (pos != std::string::npos)
-        {
-            std::string type = m.substr(0, pos);
-            typeSet.insert(type);
-        }
-    }
+std::string_view System::fileTypeView()
+{
+    return Helper::arrayElement<std::string_view>(fileTypes());
+}
 
-    std::vector<std::string> types(typeSet.begin(), typeSet.end());
-    return Helper::arrayElement<std::string>(types);
+Dictionary System::fileTypeDictionary()
+{
+    return Dictionary{fileTypes()};
 }
 
 std::string System::directoryPath()
 {
-    const std::vector<std::string> paths = directoryPaths;
-    return Helper::arrayElement<std::string>(paths);
+    return std::string{directoryPathView()};
+}
+
+std::string_view System::directoryPathView()
+{
+    return Helper::arrayElement<std::string_view>(directoryPaths);
+}
+
+Dictionary System::directoryPathDictionary()
+{
+    return Dictionary{directoryPaths};
 }
 std::string System::filePath()
 {
@@ -138,14 +191,12 @@ std::string System::semver()
     int minor = Number::integer(9);
     int patch = Number::integer(9);
 
-    std::stringstream ss;
-    ss << major << '.' << minor << '.' << patch;
-    return ss.str();
+    return NumberFormatter::format(major) + '.' + NumberFormatter::format(minor) + '.' + NumberFormatter::format(patch);
 }
 
 std::string System::networkInterface(const std::optional<NetworkInterfaceOptions>& options)
 {
-    const auto defaultInterfaceType = Helper::arrayElement<std::string>(commonInterfaceTypes);
+    const auto defaultInterfaceType = std::string{Helper::arrayElement<std::string_view>(commonInterfaceTypes)};
     const std::string defaultInterfaceSchema = Helper::objectKey(commonInterfaceSchemas);
 
     std::string interfaceType = defaultInterfaceType;
@@ -198,7 +249,7 @@ std::string System::cron(const CronOptions& options)
     std::vector<std::string> months = { std::to_string(Number::integer(1, 12)), "*" };
     std::vector<std::string> daysOfWeek = {
         std::to_string(Number::integer(6)),
-        cronDayOfWeek[static_cast<unsigned long>(Number::integer(0, static_cast<int>(cronDayOfWeek.size() - 1)))],
+        std::string{Helper::arrayElement<std::string_view>(cronDayOfWeek)},
         "*",
         "?"
     };
@@ -224,12 +275,11 @@ std::string System::cron(const CronOptions& options)
         standardExpression += " " + year;
     }
 
-    std::vector<std::string> nonStandardExpressions = {
-        "@annually", "@daily", "@hourly", "@monthly", "@reboot", "@weekly", "@yearly"
-    };
+    constexpr auto nonStandardExpressions = std::to_array<std::string_view>(
+        {"@annually", "@daily", "@hourly", "@monthly", "@reboot", "@weekly", "@yearly"});
 
     return (!includeNonStandard || Datatype::boolean(0)) ?
                standardExpression :
-               Helper::arrayElement<std::string>(nonStandardExpressions);
+               std::string{Helper::arrayElement<std::string_view>(nonStandardExpressions)};
 }
 }
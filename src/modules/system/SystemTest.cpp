@@ -72,6 +72,14 @@ TEST_F(SystemTest, MimeTypeTest)
     EXPECT_TRUE(isValidMimeType);
 }
 
+TEST_F(SystemTest, MimeTypeViewTest)
+{
+    const auto mimeTypeResult = System::mimeTypeView();
+
+    bool isValidMimeType = std::find(mimeTypes.begin(), mimeTypes.end(), mimeTypeResult) != mimeTypes.end();
+    EXPECT_TRUE(isValidMimeType);
+}
+
 TEST_F(SystemTest, CommonFileTypeTest)
 {
     std::string commonFileTypeResult = System::commonFileType();
@@ -86,11 +94,11 @@ TEST_F(SystemTest, FileTypeTest)
     std::set<std::string> typeSet;
     for (const auto& entry : mimeTypes)
     {
-        const std::string& m = entry;
+        const std::string_view m = entry;
         size_t pos = m.find('/');
         if (pos != std::string::npos)
         {
-            std::string type = m.substr(0, pos);
+            std::string type{m.substr(0, pos)};
             typeSet.insert(type);
         }
     }
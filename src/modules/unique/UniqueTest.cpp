@@ -0,0 +1,78 @@
+#include "faker-cxx/Unique.h"
+
+#include <set>
+#include <stdexcept>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "faker-cxx/Number.h"
+
+using namespace ::testing;
+using namespace faker;
+
+class UniqueTest : public Test
+{
+public:
+};
+
+TEST_F(UniqueTest, shouldGenerateUniqueValuesInExactMode)
+{
+    Unique uniqueNumber{[]() { return Number::integer<int>(199); }};
+
+    std::set<int> generatedNumbers;
+
+    for (int i = 0; i < 100; i++)
+    {
+        generatedNumbers.insert(uniqueNumber());
+    }
+
+    ASSERT_EQ(generatedNumbers.size(), 100);
+
+    const auto statistics = uniqueNumber.getStatistics();
+
+    ASSERT_EQ(statistics.uniqueValues, 100);
+    ASSERT_EQ(statistics.generatedValues, statistics.uniqueValues + statistics.rejectedValues);
+    ASSERT_GT(statistics.memoryBytes, 0);
+}
+
+TEST_F(UniqueTest, shouldGenerateUniqueStringsInApproximateMode)
+{
+    Unique uniqueString{[]() { return std::to_string(Number::integer<int>(999)); },
+                        {.mode = UniqueMode::Approximate, .expectedCount = 1000, .falsePositiveRate = 0.01}};
+
+    std::set<std::string> generatedStrings;
+
+    for (int i = 0; i < 100; i++)
+    {
+        generatedStrings.insert(uniqueString());
+    }
+
+    ASSERT_EQ(generatedStrings.size(), 100);
+    ASSERT_EQ(uniqueString.getStatistics().uniqueValues, 100);
+}
+
+TEST_F(UniqueTest, shouldThrowWhenRetryLimitIsExceeded)
+{
+    Unique uniqueConstant{[]() { return std::string{"constant"}; }, {.maxRetries = 3}};
+
+    ASSERT_EQ(uniqueConstant(), "constant");
+    ASSERT_THROW(uniqueConstant(), std::runtime_error);
+
+    const auto statistics = uniqueConstant.getStatistics();
+
+    ASSERT_EQ(statistics.generatedValues, 5);
+    ASSERT_EQ(statistics.rejectedValues, 4);
+    ASSERT_EQ(statistics.exhaustedCalls, 1);
+}
+
+TEST_F(UniqueTest, shouldForgetValuesAfterClear)
+{
+    Unique uniqueConstant{[]() { return 7; }, {.maxRetries = 0}};
+
+    ASSERT_EQ(uniqueConstant(), 7);
+
+    uniqueConstant.clear();
+
+    ASSERT_EQ(uniqueConstant(), 7);
+    ASSERT_EQ(uniqueConstant.getStatistics().uniqueValues, 1);
+}
@@ -1,6 +1,10 @@
 #include "faker-cxx/Word.h"
 
+#include <stdexcept>
+
+#include "../../common/LengthIndex.h"
 #include "../../common/StringHelper.h"
+#include "../../common/StringPool.h"
 #include "data/Adjectives.h"
 #include "data/Adverbs.h"
 #include "data/Conjunctions.h"
@@ -9,37 +13,90 @@
 #include "data/Prepositions.h"
 #include "data/Verbs.h"
 #include "faker-cxx/Helper.h"
+#include "faker-cxx/Number.h"
 #include "faker-cxx/String.h"
 
 namespace faker
 {
-std::string Word::sample(std::optional<unsigned int> length)
+namespace
 {
-    std::vector<std::string> allWords{adjectives};
+constexpr auto wordPool =
+    StringPoolBuilder::build<adjectives, adverbs, conjunctions, interjections, nouns, prepositions, verbs>();
+
+constexpr auto allWords = wordPool.all();
+constexpr auto adjectiveWords = wordPool.list(0);
+constexpr auto adverbWords = wordPool.list(1);
+constexpr auto conjunctionWords = wordPool.list(2);
+constexpr auto interjectionWords = wordPool.list(3);
+constexpr auto nounWords = wordPool.list(4);
+constexpr auto prepositionWords = wordPool.list(5);
+constexpr auto verbWords = wordPool.list(6);
+
+struct WordLengthIndexes {
+    LengthIndex allWordsIndex{allWords};
+    LengthIndex adjectivesIndex{adjectiveWords};
+    LengthIndex adverbsIndex{adverbWords};
+    LengthIndex conjunctionsIndex{conjunctionWords};
+    LengthIndex interjectionsIndex{interjectionWords};
+    LengthIndex nounsIndex{nounWords};
+    LengthIndex prepositionsIndex{prepositionWords};
+    LengthIndex verbsIndex{verbWords};
+};
+
+const WordLengthIndexes& wordLengthIndexes()
+{
+    static const WordLengthIndexes indexes;
 
-    allWords.insert(allWords.end(), adverbs.begin(), adverbs.end());
-    allWords.insert(allWords.end(), conjunctions.begin(), conjunctions.end());
-    allWords.insert(allWords.end(), interjections.begin(), interjections.end());
-    allWords.insert(allWords.end(), nouns.begin(), nouns.end());
-    allWords.insert(allWords.end(), prepositions.begin(), prepositions.end());
-    allWords.insert(allWords.end(), verbs.begin(), verbs.end());
+    return indexes;
+}
 
-    if (!length)
+std::string_view sampleWordWithLengthBetween(const LengthIndex& lengthIndex, unsigned minLength, unsigned maxLength)
+{
+    if (minLength > maxLength)
     {
-        return Helper::arrayElement<std::string>(allWords);
+        throw std::invalid_argument("Minimum length must be smaller than maximum length.");
     }
 
-    const auto shuffledWords = Helper::shuffle(allWords);
+    const auto matchingWords = lengthIndex.withLengthBetween(minLength, maxLength);
 
-    for (const auto& word : shuffledWords)
+    if (matchingWords.empty())
+    {
+        return Helper::arrayElement<std::string_view>(lengthIndex.all());
+    }
+
+    return Helper::arrayElement<std::string_view>(matchingWords);
+}
+
+std::string_view sampleWordWithLength(StringPoolView words, const LengthIndex& lengthIndex,
+                                      std::optional<unsigned int> length)
+{
+    if (!length)
     {
-        if (word.size() == length)
-        {
-            return word;
-        }
+        return words[Number::integer<std::size_t>(words.size() - 1)];
     }
 
-    return Helper::arrayElement<std::string>(shuffledWords);
+    return sampleWordWithLengthBetween(lengthIndex, *length, *length);
+}
+}
+
+std::string Word::sample(std::optional<unsigned int> length)
+{
+    return std::string{sampleView(length)};
+}
+
+std::string_view Word::sampleView(std::optional<unsigned int> length)
+{
+    return sampleWordWithLength(allWords, wordLengthIndexes().allWordsIndex, length);
+}
+
+Dictionary Word::sampleDictionary()
+{
+    return Dictionary{allWords};
+}
+
+std::string Word::sample(unsigned int minLength, unsigned int maxLength)
+{
+    return std::string{sampleWordWithLengthBetween(wordLengthIndexes().allWordsIndex, minLength, maxLength)};
 }
 
 std::string Word::words(unsigned numberOfWords)
@@ -56,141 +113,141 @@ std::string Word::words(unsigned numberOfWords)
 
 std::string Word::adjective(std::optional<unsigned int> length)
 {
-    if (!length)
-    {
-        return Helper::arrayElement<std::string>(adjectives);
-    }
+    return std::string{adjectiveView(length)};
+}
 
-    const auto shuffledAdjectives = Helper::shuffle(adjectives);
+std::string_view Word::adjectiveView(std::optional<unsigned int> length)
+{
+    return sampleWordWithLength(adjectiveWords, wordLengthIndexes().adjectivesIndex, length);
+}
 
-    for (const auto& adjective : shuffledAdjectives)
-    {
-        if (adjective.size() == length)
-        {
-            return adjective;
-        }
-    }
+Dictionary Word::adjectiveDictionary()
+{
+    return Dictionary{adjectiveWords};
+}
 
-    return Helper::arrayElement<std::string>(shuffledAdjectives);
+std::string Word::adjective(unsigned int minLength, unsigned int maxLength)
+{
+    return std::string{sampleWordWithLengthBetween(wordLengthIndexes().adjectivesIndex, minLength, maxLength)};
 }
 
 std::string Word::adverb(std::optional<unsigned int> length)
 {
-    if (!length)
-    {
-        return Helper::arrayElement<std::string>(adverbs);
-    }
+    return std::string{adverbView(length)};
+}
 
-    const auto shuffledAdverbs = Helper::shuffle(adverbs);
+std::string_view Word::adverbView(std::optional<unsigned int> length)
+{
+    return sampleWordWithLength(adverbWords, wordLengthIndexes().adverbsIndex, length);
+}
 
-    for (const auto& adverb : shuffledAdverbs)
-    {
-        if (adverb.size() == length)
-        {
-            return adverb;
-        }
-    }
+Dictionary Word::adverbDictionary()
+{
+    return Dictionary{adverbWords};
+}
 
-    return Helper::arrayElement<std::string>(shuffledAdverbs);
+std::string Word::adverb(unsigned int minLength, unsigned int maxLength)
+{
+    return std::string{sampleWordWithLengthBetween(wordLengthIndexes().adverbsIndex, minLength, maxLength)};
 }
 
 std::string Word::conjunction(std::optional<unsigned int> length)
 {
-    if (!length)
-    {
-        return Helper::arrayElement<std::string>(conjunctions);
-    }
+    return std::string{conjunctionView(length)};
+}
 
-    const auto shuffledConjunctions = Helper::shuffle(conjunctions);
+std::string_view Word::conjunctionView(std::optional<unsigned int> length)
+{
+    return sampleWordWithLength(conjunctionWords, wordLengthIndexes().conjunctionsIndex, length);
+}
 
-    for (const auto& conjunction : shuffledConjunctions)
-    {
-        if (conjunction.size() == length)
-        {
-            return conjunction;
-        }
-    }
+Dictionary Word::conjunctionDictionary()
+{
+    return Dictionary{conjunctionWords};
+}
 
-    return Helper::arrayElement<std::string>(shuffledConjunctions);
+std::string Word::conjunction(unsigned int minLength, unsigned int maxLength)
+{
+    return std::string{sampleWordWithLengthBetween(wordLengthIndexes().conjunctionsIndex, minLength, maxLength)};
 }
 
 std::string Word::interjection(std::optional<unsigned int> length)
 {
-    if (!length)
-    {
-        return Helper::arrayElement<std::string>(interjections);
-    }
+    return std::string{interjectionView(length)};
+}
 
-    const auto shuffledInterjections = Helper::shuffle(interjections);
+std::string_view Word::interjectionView(std::optional<unsigned int> length)
+{
+    return sampleWordWithLength(interjectionWords, wordLengthIndexes().interjectionsIndex, length);
+}
 
-    for (const auto& interjection : shuffledInterjections)
-    {
-        if (interjection.size() == length)
-        {
-            return interjection;
-        }
-    }
+Dictionary Word::interjectionDictionary()
+{
+    return Dictionary{interjectionWords};
+}
 
-    return Helper::arrayElement<std::string>(shuffledInterjections);
+std::string Word::interjection(unsigned int minLength, unsigned int maxLength)
+{
+    return std::string{sampleWordWithLengthBetween(wordLengthIndexes().interjectionsIndex, minLength, maxLength)};
 }
 
 std::string Word::noun(std::optional<unsigned int> length)
 {
-    if (!length)
-    {
-        return Helper::arrayElement<std::string>(nouns);
-    }
+    return std::string{nounView(length)};
+}
 
-    const auto shuffledNouns = Helper::shuffle(nouns);
+std::string_view Word::nounView(std::optional<unsigned int> length)
+{
+    return sampleWordWithLength(nounWords, wordLengthIndexes().nounsIndex, length);
+}
 
-    for (const auto& noun : shuffledNouns)
-    {
-        if (noun.size() == length)
-        {
-            return noun;
-        }
-    }
+Dictionary Word::nounDictionary()
+{
+    return Dictionary{nounWords};
+}
 
-    return Helper::arrayElement<std::string>(shuffledNouns);
+std::string Word::noun(unsigned int minLength, unsigned int maxLength)
+{
+    return std::string{sampleWordWithLengthBetween(wordLengthIndexes().nounsIndex, minLength, maxLength)};
 }
 
 std::string Word::preposition(std::optional<unsigned int> length)
 {
-    if (!length)
-    {
-        return Helper::arrayElement<std::string>(prepositions);
-    }
+    return std::string{prepositionView(length)};
+}
 
-    const auto shuffledPrepositions = Helper::shuffle(prepositions);
+std::string_view Word::prepositionView(std::optional<unsigned int> length)
+{
+    return sampleWordWithLength(prepositionWords, wordLengthIndexes().prepositionsIndex, length);
+}
 
-    for (const auto& preposition : shuffledPrepositions)
-    {
-        if (preposition.size() == length)
-        {
-            return preposition;
-        }
-    }
+Dictionary Word::prepositionDictionary()
+{
+    return Dictionary{prepositionWords};
+}
 
-    return Helper::arrayElement<std::string>(shuffledPrepositions);
+std::string Word::preposition(unsigned int minLength, unsigned int maxLength)
+{
+    return std::string{sampleWordWithLengthBetween(wordLengthIndexes().prepositionsIndex, minLength, maxLength)};
 }
 
 std::string Word::verb(std::optional<unsigned int> length)
 {
-    if (!length)
-    {
-        return Helper::arrayElement<std::string>(verbs);
-    }
+    return std::string{verbView(length)};
+}
 
-    const auto shuffledVerbs = Helper::shuffle(verbs);
+std::string_view Word::verbView(std::optional<unsigned int> length)
+{
+    return sampleWordWithLength(verbWords, wordLengthIndexes().verbsIndex, length);
+}
 
-    for (const auto& verb : shuffledVerbs)
-    {
-        if (verb.size() == length)
-        {
-            return verb;
-        }
-    }
+Dictionary Word::verbDictionary()
+{
+    return Dictionary{verbWords};
+}
 
-    return Helper::arrayElement<std::string>(shuffledVerbs);
+std::string Word::verb(unsigned int minLength, unsigned int maxLength)
+{
+    return std::string{sampleWordWithLengthBetween(wordLengthIndexes().verbsIndex, minLength, maxLength)};
 }
 }
@@ -38,7 +38,7 @@ TEST_F(WordTest, shouldGenerateAdjective)
     const auto generatedAdjective = Word::adjective();
 
     ASSERT_TRUE(std::any_of(adjectives.begin(), adjectives.end(),
-                            [generatedAdjective](const std::string& word) { return word == generatedAdjective; }));
+                            [generatedAdjective](std::string_view word) { return word == generatedAdjective; }));
 }
 
 TEST_F(WordTest, shouldGenerateAdjectiveWithExistingLength)
@@ -46,7 +46,7 @@ TEST_F(WordTest, shouldGenerateAdjectiveWithExistingLength)
     const auto generatedAdjective = Word::adjective(5);
 
     ASSERT_TRUE(std::any_of(adjectives.begin(), adjectives.end(),
-                            [generatedAdjective](const std::string& word) { return word == generatedAdjective; }));
+                            [generatedAdjective](std::string_view word) { return word == generatedAdjective; }));
 }
 
 TEST_F(WordTest, shouldGenerateAdjectiveWithNonExistingLength)
@@ -54,7 +54,7 @@ TEST_F(WordTest, shouldGenerateAdjectiveWithNonExistingLength)
     const auto generatedAdjective = Word::adjective(100);
 
     ASSERT_TRUE(std::any_of(adjectives.begin(), adjectives.end(),
-                            [generatedAdjective](const std::string& word) { return word == generatedAdjective; }));
+                            [generatedAdjective](std::string_view word) { return word == generatedAdjective; }));
 }
 
 TEST_F(WordTest, shouldGenerateAdverb)
@@ -62,7 +62,7 @@ TEST_F(WordTest, shouldGenerateAdverb)
     const auto generatedAdverb = Word::adverb();
 
     ASSERT_TRUE(std::any_of(adverbs.begin(), adverbs.end(),
-                            [generatedAdverb](const std::string& word) { return word == generatedAdverb; }));
+                            [generatedAdverb](std::string_view word) { return word == generatedAdverb; }));
 }
 
 TEST_F(WordTest, shouldGenerateAdverbWithExistingLength)
@@ -70,7 +70,7 @@ TEST_F(WordTest, shouldGenerateAdverbWithExistingLength)
     const auto generatedAdverb = Word::adverb(5);
 
     ASSERT_TRUE(std::any_of(adverbs.begin(), adverbs.end(),
-                            [generatedAdverb](const std::string& word) { return word == generatedAdverb; }));
+                            [generatedAdverb](std::string_view word) { return word == generatedAdverb; }));
 }
 
 TEST_F(WordTest, shouldGenerateAdverbWithNonExistingLength)
@@ -78,7 +78,7 @@ TEST_F(WordTest, shouldGenerateAdverbWithNonExistingLength)
     const auto generatedAdverb = Word::adverb(100);
 
     ASSERT_TRUE(std::any_of(adverbs.begin(), adverbs.end(),
-                            [generatedAdverb](const std::string& word) { return word == generatedAdverb; }));
+                            [generatedAdverb](std::string_view word) { return word == generatedAdverb; }));
 }
 
 TEST_F(WordTest, shouldGenerateConjunction)
@@ -86,7 +86,7 @@ TEST_F(WordTest, shouldGenerateConjunction)
     const auto generatedConjunction = Word::conjunction();
 
     ASSERT_TRUE(std::any_of(conjunctions.begin(), conjunctions.end(),
-                            [generatedConjunction](const std::string& word) { return word == generatedConjunction; }));
+                            [generatedConjunction](std::string_view word) { return word == generatedConjunction; }));
 }
 
 TEST_F(WordTest, shouldGenerateConjunctionWithExistingLength)
@@ -94,7 +94,7 @@ TEST_F(WordTest, shouldGenerateConjunctionWithExistingLength)
     const auto generatedConjunction = Word::conjunction(5);
 
     ASSERT_TRUE(std::any_of(conjunctions.begin(), conjunctions.end(),
-                            [generatedConjunction](const std::string& word) { return word == generatedConjunction; }));
+                            [generatedConjunction](std::string_view word) { return word == generatedConjunction; }));
 }
 
 TEST_F(WordTest, shouldGenerateConjunctionWithNonExistingLength)
@@ -102,7 +102,7 @@ TEST_F(WordTest, shouldGenerateConjunctionWithNonExistingLength)
     const auto generatedConjunction = Word::conjunction(100);
 
     ASSERT_TRUE(std::any_of(conjunctions.begin(), conjunctions.end(),
-                            [generatedConjunction](const std::string& word) { return word == generatedConjunction; }));
+                            [generatedConjunction](std::string_view word) { return word == generatedConjunction; }));
 }
 
 TEST_F(WordTest, shouldGenerateInterjection)
@@ -110,7 +110,7 @@ TEST_F(WordTest, shouldGenerateInterjection)
     const auto generatedInterjection = Word::interjection();
 
     ASSERT_TRUE(std::any_of(interjections.begin(), interjections.end(),
-                            [generatedInterjection](const std::string& word)
+                            [generatedInterjection](std::string_view word)
                             { return word == generatedInterjection; }));
 }
 
@@ -119,7 +119,7 @@ TEST_F(WordTest, shouldGenerateInterjectionWithExistingLength)
     const auto generatedInterjection = Word::interjection(5);
 
     ASSERT_TRUE(std::any_of(interjections.begin(), interjections.end(),
-                            [generatedInterjection](const std::string& word)
+                            [generatedInterjection](std::string_view word)
                             { return word == generatedInterjection; }));
 }
 
@@ -128,7 +128,7 @@ TEST_F(WordTest, shouldGenerateInterjectionWithNonExistingLength)
     const auto generatedInterjection = Word::interjection(100);
 
     ASSERT_TRUE(std::any_of(interjections.begin(), interjections.end(),
-                            [generatedInterjection](const std::string& word)
+                            [generatedInterjection](std::string_view word)
                             { return word == generatedInterjection; }));
 }
 
@@ -137,7 +137,36 @@ TEST_F(WordTest, shouldGenerateNoun)
     const auto generatedNoun = Word::noun();
 
     ASSERT_TRUE(std::any_of(nouns.begin(), nouns.end(),
-                            [generatedNoun](const std::string& word) { return word == generatedNoun; }));
+                            [generatedNoun](std::string_view word) { return word == generatedNoun; }));
+}
+
+TEST_F(WordTest, shouldGenerateNounView)
+{
+    const auto generatedNoun = Word::nounView();
+
+    ASSERT_TRUE(std::any_of(nouns.begin(), nouns.end(),
+                            [generatedNoun](std::string_view word) { return word == generatedNoun; }));
+}
+
+TEST_F(WordTest, shouldReturnNounDictionary)
+{
+    const auto nounDictionary = Word::nounDictionary();
+
+    ASSERT_EQ(nounDictionary.size(), nouns.size());
+
+    for (std::size_t i = 0; i < nouns.size(); i++)
+    {
+        ASSERT_EQ(nounDictionary[i], nouns[i]);
+    }
+}
+
+TEST_F(WordTest, shouldGenerateVerbViewWithExistingLength)
+{
+    const auto generatedVerb = Word::verbView(5);
+
+    ASSERT_EQ(generatedVerb.size(), 5);
+    ASSERT_TRUE(std::any_of(verbs.begin(), verbs.end(),
+                            [generatedVerb](std::string_view word) { return word == generatedVerb; }));
 }
 
 TEST_F(WordTest, shouldGenerateNounWithExistingLength)
@@ -145,7 +174,7 @@ TEST_F(WordTest, shouldGenerateNounWithExistingLength)
     const auto generatedNoun = Word::noun(5);
 
     ASSERT_TRUE(std::any_of(nouns.begin(), nouns.end(),
-                            [generatedNoun](const std::string& word) { return word == generatedNoun; }));
+                            [generatedNoun](std::string_view word) { return word == generatedNoun; }));
 }
 
 TEST_F(WordTest, shouldGenerateNounWithNonExistingLength)
@@ -153,7 +182,7 @@ TEST_F(WordTest, shouldGenerateNounWithNonExistingLength)
     const auto generatedNoun = Word::noun(100);
 
     ASSERT_TRUE(std::any_of(nouns.begin(), nouns.end(),
-                            [generatedNoun](const std::string& word) { return word == generatedNoun; }));
+                            [generatedNoun](std::string_view word) { return word == generatedNoun; }));
 }
 
 TEST_F(WordTest, shouldGeneratePreposition)
@@ -161,7 +190,7 @@ TEST_F(WordTest, shouldGeneratePreposition)
     const auto generatedPreposition = Word::preposition();
 
     ASSERT_TRUE(std::any_of(prepositions.begin(), prepositions.end(),
-                            [generatedPreposition](const std::string& word) { return word == generatedPreposition; }));
+                            [generatedPreposition](std::string_view word) { return word == generatedPreposition; }));
 }
 
 TEST_F(WordTest, shouldGeneratePrepositionWithExistingLength)
@@ -169,7 +198,7 @@ TEST_F(WordTest, shouldGeneratePrepositionWithExistingLength)
     const auto generatedPreposition = Word::preposition(5);
 
     ASSERT_TRUE(std::any_of(prepositions.begin(), prepositions.end(),
-                            [generatedPreposition](const std::string& word) { return word == generatedPreposition; }));
+                            [generatedPreposition](std::string_view word) { return word == generatedPreposition; }));
 }
 
 TEST_F(WordTest, shouldGeneratePrepositionWithNonExistingLength)
@@ -177,7 +206,7 @@ TEST_F(WordTest, shouldGeneratePrepositionWithNonExistingLength)
     const auto generatedPreposition = Word::preposition(100);
 
     ASSERT_TRUE(std::any_of(prepositions.begin(), prepositions.end(),
-                            [generatedPreposition](const std::string& word) { return word == generatedPreposition; }));
+                            [generatedPreposition](std::string_view word) { return word == generatedPreposition; }));
 }
 
 TEST_F(WordTest, shouldGenerateVerb)
@@ -185,7 +214,7 @@ TEST_F(WordTest, shouldGenerateVerb)
     const auto generatedVerb = Word::verb();
 
     ASSERT_TRUE(std::any_of(verbs.begin(), verbs.end(),
-                            [generatedVerb](const std::string& word) { return word == generatedVerb; }));
+                            [generatedVerb](std::string_view word) { return word == generatedVerb; }));
 }
 
 TEST_F(WordTest, shouldGenerateVerbWithExistingLength)
@@ -193,7 +222,7 @@ TEST_F(WordTest, shouldGenerateVerbWithExistingLength)
     const auto generatedVerb = Word::verb(5);
 
     ASSERT_TRUE(std::any_of(verbs.begin(), verbs.end(),
-                            [generatedVerb](const std::string& word) { return word == generatedVerb; }));
+                            [generatedVerb](std::string_view word) { return word == generatedVerb; }));
 }
 
 TEST_F(WordTest, shouldGenerateVerbWithNonExistingLength)
@@ -201,7 +230,7 @@ TEST_F(WordTest, shouldGenerateVerbWithNonExistingLength)
     const auto generatedVerb = Word::verb(100);
 
     ASSERT_TRUE(std::any_of(verbs.begin(), verbs.end(),
-                            [generatedVerb](const std::string& word) { return word == generatedVerb; }));
+                            [generatedVerb](std::string_view word) { return word == generatedVerb; }));
 }
 
 TEST_F(WordTest, shouldGenerateSample)
@@ -209,7 +238,7 @@ TEST_F(WordTest, shouldGenerateSample)
     const auto generatedSample = Word::sample();
 
     ASSERT_TRUE(std::any_of(allWords.begin(), allWords.end(),
-                            [generatedSample](const std::string& word) { return word == generatedSample; }));
+                            [generatedSample](std::string_view word) { return word == generatedSample; }));
 }
 
 TEST_F(WordTest, shouldGenerateSampleWithExistingLength)
@@ -217,7 +246,7 @@ TEST_F(WordTest, shouldGenerateSampleWithExistingLength)
     const auto generatedSample = Word::sample(5);
 
     ASSERT_TRUE(std::any_of(allWords.begin(), allWords.end(),
-                            [generatedSample](const std::string& word) { return word == generatedSample; }));
+                            [generatedSample](std::string_view word) { return word == generatedSample; }));
 }
 
 TEST_F(WordTest, shouldGenerateSampleWithNonExistingLength)
@@ -225,7 +254,7 @@ TEST_F(WordTest, shouldGenerateSampleWithNonExistingLength)
     const auto generatedSample = Word::sample(100);
 
     ASSERT_TRUE(std::any_of(allWords.begin(), allWords.end(),
-                            [generatedSample](const std::string& word) { return word == generatedSample; }));
+                            [generatedSample](std::string_view word) { return word == generatedSample; }));
 }
 
 TEST_F(WordTest, shouldGenerateWords)
@@ -235,6 +264,48 @@ TEST_F(WordTest, shouldGenerateWords)
     const auto separatedWords = StringHelper::split(generatedWords, " ");
 
     ASSERT_TRUE(std::all_of(separatedWords.begin(), separatedWords.end(),
-                            [this](const std::string& separatedWord)
+                            [this](std::string_view separatedWord)
                             { return std::find(allWords.begin(), allWords.end(), separatedWord) != allWords.end(); }));
 }
+
+TEST_F(WordTest, shouldGenerateNounWithExactLength)
+{
+    const auto generatedNoun = Word::noun(8);
+
+    ASSERT_EQ(generatedNoun.size(), 8);
+    ASSERT_TRUE(std::any_of(nouns.begin(), nouns.end(),
+                            [generatedNoun](std::string_view word) { return word == generatedNoun; }));
+}
+
+TEST_F(WordTest, shouldGenerateNounWithLengthInRange)
+{
+    const auto generatedNoun = Word::noun(4, 6);
+
+    ASSERT_GE(generatedNoun.size(), 4);
+    ASSERT_LE(generatedNoun.size(), 6);
+    ASSERT_TRUE(std::any_of(nouns.begin(), nouns.end(),
+                            [generatedNoun](std::string_view word) { return word == generatedNoun; }));
+}
+
+TEST_F(WordTest, shouldGenerateAdjectiveWithNonExistingLengthRange)
+{
+    const auto generatedAdjective = Word::adjective(100, 200);
+
+    ASSERT_TRUE(std::any_of(adjectives.begin(), adjectives.end(),
+                            [generatedAdjective](std::string_view word) { return word == generatedAdjective; }));
+}
+
+TEST_F(WordTest, shouldGenerateSampleWithLengthInRange)
+{
+    const auto generatedSample = Word::sample(3, 4);
+
+    ASSERT_GE(generatedSample.size(), 3);
+    ASSERT_LE(generatedSample.size(), 4);
+    ASSERT_TRUE(std::any_of(allWords.begin(), allWords.end(),
+                            [generatedSample](std::string_view word) { return word == generatedSample; }));
+}
+
+TEST_F(WordTest, shouldThrowWhenMinLengthIsGreaterThanMaxLength)
+{
+    ASSERT_THROW(Word::verb(6, 5), std::invalid_argument);
+}
@@ -1,11 +1,11 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> adverbs = {
+inline constexpr auto adverbs = std::to_array<std::string_view>({
     "abnormally",
     "absentmindedly",
     "accidentally",
@@ -331,5 +331,5 @@ const std::vector<std::string> adverbs = {
     "yesterday",
     "yieldingly",
     "youthfully",
-};
+});
 }
@@ -1,11 +1,11 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> prepositions = {
+inline constexpr auto prepositions = std::to_array<std::string_view>({
     "a",
     "abaft",
     "aboard",
@@ -115,5 +115,5 @@ const std::vector<std::string> prepositions = {
     "within",
     "without",
     "worth",
-};
+});
 }
@@ -1,11 +1,11 @@
 #pragma once
 
-#include <string>
-#include <vector>
+#include <array>
+#include <string_view>
 
 namespace faker
 {
-const std::vector<std::string> verbs = {
+inline constexpr auto verbs = std::to_array<std::string_view>({
         "abandon",
         "abase",
         "abate",
@@ -5916,5 +5916,5 @@ const std::vector<std::string> verbs = {
         "zip",
         "zone",
         "zoom"
-};
+});
 }